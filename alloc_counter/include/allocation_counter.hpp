@@ -0,0 +1,63 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef ALLOCATION_COUNTER_H
+#define ALLOCATION_COUNTER_H
+
+#include <cstdint>
+
+namespace AstarteDeviceSdk {
+
+/** @brief Number and size of heap allocations. */
+struct AllocationCount {
+  /** @brief Number of allocations. */
+  uint64_t allocations{0};
+  /** @brief Bytes requested by the allocations. */
+  uint64_t bytes{0};
+
+  /**
+   * @brief Get the allocations made between two counts.
+   * @param other The earlier count.
+   * @return The difference between the counts.
+   */
+  [[nodiscard]] auto operator-(const AllocationCount& other) const -> AllocationCount {
+    return {.allocations = allocations - other.allocations, .bytes = bytes - other.bytes};
+  }
+};
+
+/**
+ * @brief Get the allocations made by the calling thread since it started.
+ * @details Always counted, the allocations made by the calling thread are deterministic and do not
+ * include those of the gRPC threads or of an in-process server.
+ * @return The allocations of the thread.
+ */
+auto thread_allocations() -> AllocationCount;
+/**
+ * @brief Enable or disable the counting of the allocations of all the threads.
+ * @param enabled True to count the allocations of the process from now on.
+ */
+void set_process_allocation_counting(bool enabled);
+/**
+ * @brief Get the allocations of all the threads counted while enabled.
+ * @return The allocations of the process.
+ */
+auto process_allocations() -> AllocationCount;
+
+/** @brief Counts the allocations made by the calling thread during its lifetime. */
+class ThreadAllocationScope {
+ public:
+  ThreadAllocationScope() : start_(thread_allocations()) {}
+  /**
+   * @brief Get the allocations made since the scope was created.
+   * @return The allocations of the calling thread.
+   */
+  [[nodiscard]] auto get() const -> AllocationCount { return thread_allocations() - start_; }
+
+ private:
+  AllocationCount start_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // ALLOCATION_COUNTER_H
@@ -0,0 +1,98 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "allocation_counter.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace AstarteDeviceSdk {
+
+namespace {
+
+// Plain thread local data, accessed without any initialization from the allocation functions
+constinit thread_local AllocationCount thread_count;
+
+std::atomic_bool process_counting{false};
+std::atomic<uint64_t> process_allocations_count{0};
+std::atomic<uint64_t> process_bytes_count{0};
+
+void record(std::size_t size) {
+  thread_count.allocations++;
+  thread_count.bytes += size;
+  if (process_counting.load(std::memory_order_relaxed)) {
+    process_allocations_count.fetch_add(1, std::memory_order_relaxed);
+    process_bytes_count.fetch_add(size, std::memory_order_relaxed);
+  }
+}
+
+}  // namespace
+
+auto thread_allocations() -> AllocationCount { return thread_count; }
+
+void set_process_allocation_counting(bool enabled) {
+  process_counting.store(enabled, std::memory_order_relaxed);
+}
+
+auto process_allocations() -> AllocationCount {
+  return {.allocations = process_allocations_count.load(std::memory_order_relaxed),
+          .bytes = process_bytes_count.load(std::memory_order_relaxed)};
+}
+
+}  // namespace AstarteDeviceSdk
+
+#if defined(__GLIBC__)
+
+// With glibc the C allocation functions are interposed, so that the allocations of the C
+// libraries, such as the gRPC core, are counted together with the ones of operator new.
+extern "C" {
+
+auto __libc_malloc(std::size_t size) -> void*;
+auto __libc_calloc(std::size_t count, std::size_t size) -> void*;
+auto __libc_realloc(void* pointer, std::size_t size) -> void*;
+
+// NOLINTBEGIN(readability-identifier-naming): the names of the interposed functions are fixed
+auto malloc(std::size_t size) -> void* {
+  AstarteDeviceSdk::record(size);
+  return __libc_malloc(size);
+}
+
+auto calloc(std::size_t count, std::size_t size) -> void* {
+  AstarteDeviceSdk::record(count * size);
+  return __libc_calloc(count, size);
+}
+
+auto realloc(void* pointer, std::size_t size) -> void* {
+  AstarteDeviceSdk::record(size);
+  return __libc_realloc(pointer, size);
+}
+// NOLINTEND(readability-identifier-naming)
+}
+
+#else  // defined(__GLIBC__)
+
+// Elsewhere only the allocations made with operator new are counted
+auto operator new(std::size_t size) -> void* {
+  AstarteDeviceSdk::record(size);
+  void* pointer = std::malloc(size);
+  if (pointer == nullptr) {
+    throw std::bad_alloc();
+  }
+  return pointer;
+}
+
+auto operator new[](std::size_t size) -> void* { return operator new(size); }
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+
+void operator delete[](void* pointer) noexcept { std::free(pointer); }
+
+void operator delete(void* pointer, std::size_t /*size*/) noexcept { std::free(pointer); }
+
+void operator delete[](void* pointer, std::size_t /*size*/) noexcept { std::free(pointer); }
+
+#endif  // defined(__GLIBC__)
@@ -0,0 +1,41 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include "allocation_counter.hpp"
+
+using AstarteDeviceSdk::AllocationCount;
+using AstarteDeviceSdk::process_allocations;
+using AstarteDeviceSdk::set_process_allocation_counting;
+
+namespace {
+
+// Reports the allocations of each benchmark as allocs_per_iter in the results. The allocations
+// are counted in a separate run, so that counting them doesn't affect the timings.
+class AllocationManager : public benchmark::MemoryManager {
+ public:
+  void Start() override {
+    set_process_allocation_counting(true);
+    start_ = process_allocations();
+  }
+
+  void Stop(Result& result) override {
+    const AllocationCount count = process_allocations() - start_;
+    set_process_allocation_counting(false);
+    result.num_allocs = static_cast<int64_t>(count.allocations);
+    result.total_allocated_bytes = static_cast<int64_t>(count.bytes);
+  }
+
+ private:
+  AllocationCount start_;
+};
+
+AllocationManager manager;
+// Registered before the main of Google Benchmark runs the benchmarks
+const bool registered = (benchmark::RegisterMemoryManager(&manager), true);
+
+}  // namespace
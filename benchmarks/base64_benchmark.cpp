@@ -0,0 +1,96 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "astarte_device_sdk/base64.hpp"
+#include "base64_kernels.hpp"
+
+using AstarteDeviceSdk::base64_decode;
+using AstarteDeviceSdk::base64_encode;
+using AstarteDeviceSdk::base64_encoded_size;
+using AstarteDeviceSdk::base64_supported_kernels;
+using AstarteDeviceSdk::Base64Kernels;
+
+namespace {
+
+auto blob(std::size_t size) -> std::vector<uint8_t> {
+  std::vector<uint8_t> data(size);
+  for (std::size_t index = 0; index < size; index++) {
+    data[index] = static_cast<uint8_t>((index * 131) ^ (index >> 8));
+  }
+  return data;
+}
+
+// The throughput is counted on the binary side for both the directions
+void BM_Base64Encode(benchmark::State& state, const Base64Kernels* kernels) {
+  const std::vector<uint8_t> data = blob(static_cast<std::size_t>(state.range(0)));
+  std::string text(base64_encoded_size(data.size()), '\0');
+  for (auto _ : state) {
+    const std::size_t encoded = kernels->encode(data, text.data());
+    benchmark::DoNotOptimize(encoded);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// The kernels don't decode the padding, the blob is cut to whole blocks
+void BM_Base64Decode(benchmark::State& state, const Base64Kernels* kernels) {
+  const std::size_t size = static_cast<std::size_t>(state.range(0)) / 3 * 3;
+  const std::string text = base64_encode(blob(size));
+  std::vector<uint8_t> data(size);
+  for (auto _ : state) {
+    const std::size_t decoded = kernels->decode(text, data.data());
+    benchmark::DoNotOptimize(decoded);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size));
+}
+
+// The public functions, with the selected kernels, the tail and the allocations
+void BM_Base64EncodeString(benchmark::State& state) {
+  const std::vector<uint8_t> data = blob(static_cast<std::size_t>(state.range(0)));
+  std::string text;
+  for (auto _ : state) {
+    text.clear();
+    base64_encode(data, text);
+    benchmark::DoNotOptimize(text.data());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_Base64DecodeString(benchmark::State& state) {
+  const std::string text = base64_encode(blob(static_cast<std::size_t>(state.range(0))));
+  for (auto _ : state) {
+    const std::vector<uint8_t> data = base64_decode(text);
+    benchmark::DoNotOptimize(data.data());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// One benchmark for each of the kernels this CPU supports, from 1 KiB to 1 MiB
+const bool kernels_registered = [] {
+  for (const Base64Kernels* kernels : base64_supported_kernels()) {
+    const std::string name(kernels->name);
+    benchmark::RegisterBenchmark(("BM_Base64Encode/" + name).c_str(), BM_Base64Encode, kernels)
+        ->ArgName("size")
+        ->RangeMultiplier(32)
+        ->Range(1 << 10, 1 << 20);
+    benchmark::RegisterBenchmark(("BM_Base64Decode/" + name).c_str(), BM_Base64Decode, kernels)
+        ->ArgName("size")
+        ->RangeMultiplier(32)
+        ->Range(1 << 10, 1 << 20);
+  }
+  return true;
+}();
+
+}  // namespace
+
+BENCHMARK(BM_Base64EncodeString)->ArgName("size")->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_Base64DecodeString)->ArgName("size")->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
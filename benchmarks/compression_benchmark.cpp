@@ -0,0 +1,118 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <astarteplatform/msghub/astarte_message.pb.h>
+#include <benchmark/benchmark.h>
+#include <zlib.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+#include "grpc_converter.hpp"
+
+using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::gRPCAstarteDatastreamIndividual;
+using AstarteDeviceSdk::GrpcConverterTo;
+using gRPCAstarteMessage = astarteplatform::msghub::AstarteMessage;
+
+namespace {
+
+const char* const INTERFACE = "org.astarte-platform.benchmark.Payloads";
+const char* const PATH = "/sensor0/payload";
+
+// Same window bits used by gRPC for its message compression
+constexpr int DEFLATE_WINDOW_BITS = 15;
+constexpr int GZIP_WINDOW_BITS = 15 + 16;
+constexpr int NO_COMPRESSION = 0;
+
+auto make_message(const AstarteData& data) -> gRPCAstarteMessage {
+  const auto timestamp = std::chrono::system_clock::now();
+  gRPCAstarteMessage message;
+  message.set_interface_name(INTERFACE);
+  message.set_path(PATH);
+  std::unique_ptr<gRPCAstarteDatastreamIndividual> individual = GrpcConverterTo()(data, &timestamp);
+  message.set_allocated_datastream_individual(individual.release());
+  return message;
+}
+
+auto make_scalar() -> gRPCAstarteMessage { return make_message(AstarteData(21.5)); }
+
+// Log lines sharing most of their text
+auto make_string_array() -> gRPCAstarteMessage {
+  std::vector<std::string> lines;
+  for (int index = 0; index < 64; index++) {
+    lines.push_back("2025-06-01T12:00:" + std::to_string(10 + (index % 50)) +
+                    "Z INFO sensor0 sample " + std::to_string(index) + " within range");
+  }
+  return make_message(AstarteData(lines));
+}
+
+// Buffers of 16 bit samples of a slow signal
+auto make_binaryblob_array() -> gRPCAstarteMessage {
+  std::vector<std::vector<uint8_t>> blobs;
+  for (int blob = 0; blob < 8; blob++) {
+    std::vector<uint8_t> buffer;
+    for (int index = 0; index < 256; index++) {
+      const auto sample = static_cast<int16_t>(1000.0 * std::sin((blob * 256 + index) * 0.01));
+      buffer.push_back(static_cast<uint8_t>(sample & 0xFF));
+      buffer.push_back(static_cast<uint8_t>((sample >> 8) & 0xFF));
+    }
+    blobs.push_back(std::move(buffer));
+  }
+  return make_message(AstarteData(blobs));
+}
+
+// Compresses the message as gRPC does, returning the compressed size
+auto compress(const std::string& input, int window_bits, std::vector<uint8_t>& output)
+    -> std::size_t {
+  z_stream stream{};
+  deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, window_bits, 8, Z_DEFAULT_STRATEGY);
+  output.resize(deflateBound(&stream, input.size()));
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+  stream.avail_in = static_cast<uInt>(input.size());
+  stream.next_out = output.data();
+  stream.avail_out = static_cast<uInt>(output.size());
+  deflate(&stream, Z_FINISH);
+  const std::size_t size = stream.total_out;
+  deflateEnd(&stream);
+  return size;
+}
+
+// Serialization and compression of a message, as performed by a send
+template <typename MakeMessage>
+void BM_Send(benchmark::State& state, MakeMessage make, int window_bits) {
+  const gRPCAstarteMessage message = make();
+  std::string encoded;
+  std::vector<uint8_t> compressed;
+  std::size_t wire_bytes = 0;
+  for (auto _ : state) {
+    encoded.clear();
+    message.SerializeToString(&encoded);
+    wire_bytes = (window_bits == NO_COMPRESSION) ? encoded.size()
+                                                 : compress(encoded, window_bits, compressed);
+    benchmark::DoNotOptimize(wire_bytes);
+  }
+  state.counters["payload_bytes"] = static_cast<double>(encoded.size());
+  state.counters["wire_bytes"] = static_cast<double>(wire_bytes);
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+BENCHMARK_CAPTURE(BM_Send, scalar_none, make_scalar, NO_COMPRESSION);
+BENCHMARK_CAPTURE(BM_Send, scalar_deflate, make_scalar, DEFLATE_WINDOW_BITS);
+BENCHMARK_CAPTURE(BM_Send, scalar_gzip, make_scalar, GZIP_WINDOW_BITS);
+BENCHMARK_CAPTURE(BM_Send, string_array_none, make_string_array, NO_COMPRESSION);
+BENCHMARK_CAPTURE(BM_Send, string_array_deflate, make_string_array, DEFLATE_WINDOW_BITS);
+BENCHMARK_CAPTURE(BM_Send, string_array_gzip, make_string_array, GZIP_WINDOW_BITS);
+BENCHMARK_CAPTURE(BM_Send, binaryblob_array_none, make_binaryblob_array, NO_COMPRESSION);
+BENCHMARK_CAPTURE(BM_Send, binaryblob_array_deflate, make_binaryblob_array, DEFLATE_WINDOW_BITS);
+BENCHMARK_CAPTURE(BM_Send, binaryblob_array_gzip, make_binaryblob_array, GZIP_WINDOW_BITS);
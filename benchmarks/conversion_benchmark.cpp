@@ -0,0 +1,130 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <astarteplatform/msghub/astarte_data.pb.h>
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/formatter.hpp"
+#include "astarte_device_sdk/type.hpp"
+#include "grpc_converter.hpp"
+
+using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::AstarteType;
+using AstarteDeviceSdk::GrpcConverterFrom;
+using AstarteDeviceSdk::GrpcConverterTo;
+using gRPCAstarteData = astarteplatform::msghub::AstarteData;
+using std::chrono::system_clock;
+
+namespace {
+
+// Strings and binary blobs are sized in bytes, arrays in elements
+auto make_data(AstarteType type, std::size_t size) -> AstarteData {
+  const system_clock::time_point now = system_clock::now();
+  const std::string text(size, 'a');
+  const std::vector<uint8_t> blob(size, 0xA5);
+  switch (type) {
+    case AstarteType::kBinaryBlob:
+      return AstarteData(blob);
+    case AstarteType::kBoolean:
+      return AstarteData(true);
+    case AstarteType::kDatetime:
+      return AstarteData(now);
+    case AstarteType::kDouble:
+      return AstarteData(23.5);
+    case AstarteType::kInteger:
+      return AstarteData(static_cast<int32_t>(42));
+    case AstarteType::kLongInteger:
+      return AstarteData(static_cast<int64_t>(1) << 40);
+    case AstarteType::kString:
+      return AstarteData(text);
+    case AstarteType::kBinaryBlobArray:
+      return AstarteData(std::vector<std::vector<uint8_t>>(size, std::vector<uint8_t>(16, 0xA5)));
+    case AstarteType::kBooleanArray:
+      return AstarteData(std::vector<bool>(size, true));
+    case AstarteType::kDatetimeArray:
+      return AstarteData(std::vector<system_clock::time_point>(size, now));
+    case AstarteType::kDoubleArray:
+      return AstarteData(std::vector<double>(size, 23.5));
+    case AstarteType::kIntegerArray:
+      return AstarteData(std::vector<int32_t>(size, 42));
+    case AstarteType::kLongIntegerArray:
+      return AstarteData(std::vector<int64_t>(size, static_cast<int64_t>(1) << 40));
+    case AstarteType::kStringArray:
+      return AstarteData(std::vector<std::string>(size, std::string(16, 'a')));
+  }
+  return AstarteData(false);
+}
+
+auto is_scalar(AstarteType type) -> bool {
+  return (type == AstarteType::kBoolean) || (type == AstarteType::kDatetime) ||
+         (type == AstarteType::kDouble) || (type == AstarteType::kInteger) ||
+         (type == AstarteType::kLongInteger);
+}
+
+// Scalars have a single size, the other types are measured from one to a few thousand elements
+void all_types(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgNames({"type", "size"});
+  for (int type = AstarteType::kBinaryBlob; type <= AstarteType::kStringArray; type++) {
+    if (is_scalar(static_cast<AstarteType>(type))) {
+      benchmark->Args({type, 1});
+      continue;
+    }
+    for (const int64_t size : {1, 16, 256, 4096}) {
+      benchmark->Args({type, size});
+    }
+  }
+}
+
+void set_label(benchmark::State& state) {
+  state.SetLabel(ASTARTE_NS_FORMAT::format("{}", static_cast<AstarteType>(state.range(0))));
+}
+
+void BM_ConvertToGrpc(benchmark::State& state) {
+  const AstarteData data =
+      make_data(static_cast<AstarteType>(state.range(0)), static_cast<std::size_t>(state.range(1)));
+  for (auto _ : state) {
+    auto individual = GrpcConverterTo{}(data, nullptr);
+    benchmark::DoNotOptimize(individual);
+  }
+  set_label(state);
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_ConvertFromGrpc(benchmark::State& state) {
+  const AstarteData data =
+      make_data(static_cast<AstarteType>(state.range(0)), static_cast<std::size_t>(state.range(1)));
+  const gRPCAstarteData grpc_data = GrpcConverterTo{}(data, nullptr)->data();
+  for (auto _ : state) {
+    AstarteData converted = GrpcConverterFrom{}(grpc_data);
+    benchmark::DoNotOptimize(converted);
+  }
+  set_label(state);
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(grpc_data.ByteSizeLong()));
+}
+
+void BM_CopyData(benchmark::State& state) {
+  const AstarteData data =
+      make_data(static_cast<AstarteType>(state.range(0)), static_cast<std::size_t>(state.range(1)));
+  for (auto _ : state) {
+    AstarteData copy = data;
+    benchmark::DoNotOptimize(copy);
+  }
+  set_label(state);
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+BENCHMARK(BM_ConvertToGrpc)->Apply(all_types);
+BENCHMARK(BM_ConvertFromGrpc)->Apply(all_types);
+BENCHMARK(BM_CopyData)->Apply(all_types);
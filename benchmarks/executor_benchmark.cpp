@@ -0,0 +1,85 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <astarteplatform/msghub/astarte_message.pb.h>
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/executor.hpp"
+#include "astarte_device_sdk/msg.hpp"
+#include "astarte_device_sdk/object.hpp"
+#include "executor_strand.hpp"
+#include "grpc_converter.hpp"
+
+using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::AstarteDatastreamObject;
+using AstarteDeviceSdk::AstarteExecutor;
+using AstarteDeviceSdk::AstarteMessage;
+using AstarteDeviceSdk::AstarteWorkStealingExecutor;
+using AstarteDeviceSdk::ExecutorStrand;
+using AstarteDeviceSdk::GrpcConverterFrom;
+using AstarteDeviceSdk::GrpcConverterTo;
+using gRPCAstarteMessage = astarteplatform::msghub::AstarteMessage;
+
+namespace {
+
+constexpr int64_t EVENTS_PER_DEVICE = 64;
+
+auto make_event() -> gRPCAstarteMessage {
+  const AstarteDatastreamObject object = {{"/temperature", AstarteData(23.5)},
+                                          {"/humidity", AstarteData(48.0)},
+                                          {"/label", AstarteData(std::string("sensor"))}};
+  gRPCAstarteMessage message;
+  message.set_interface_name("org.astarte-platform.benchmark.Sensors");
+  message.set_path("/room");
+  message.set_allocated_datastream_object(GrpcConverterTo{}(object, nullptr).release());
+  return message;
+}
+
+// Each device owns a strand, as AstarteDeviceGRPC does, and receives a burst of events that are
+// converted on the executor. A thread count of zero runs the conversions inline.
+void BM_EventDispatch(benchmark::State& state) {
+  const auto num_devices = static_cast<std::size_t>(state.range(0));
+  const auto num_threads = static_cast<std::size_t>(state.range(1));
+
+  std::shared_ptr<AstarteExecutor> executor;
+  if (num_threads > 0) {
+    executor = std::make_shared<AstarteWorkStealingExecutor>(num_threads);
+  }
+  std::vector<ExecutorStrand> strands(num_devices);
+  for (ExecutorStrand& strand : strands) {
+    strand.set_executor(executor);
+  }
+  const gRPCAstarteMessage event = make_event();
+
+  for (auto _ : state) {
+    for (int64_t i = 0; i < EVENTS_PER_DEVICE; i++) {
+      for (ExecutorStrand& strand : strands) {
+        strand.post([&event] {
+          AstarteMessage message = GrpcConverterFrom{}(event);
+          benchmark::DoNotOptimize(message);
+        });
+      }
+    }
+    for (ExecutorStrand& strand : strands) {
+      strand.wait_idle();
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_devices) *
+                          EVENTS_PER_DEVICE);
+}
+
+}  // namespace
+
+BENCHMARK(BM_EventDispatch)
+    ->ArgNames({"devices", "threads"})
+    ->ArgsProduct({{1, 8, 64, 256}, {0, 1, 2, 4, 8}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,75 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/formatter.hpp"
+#include "astarte_device_sdk/individual.hpp"
+#include "astarte_device_sdk/msg.hpp"
+#include "astarte_device_sdk/object.hpp"
+
+using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::AstarteDatastreamIndividual;
+using AstarteDeviceSdk::AstarteDatastreamObject;
+using AstarteDeviceSdk::AstarteMessage;
+
+namespace {
+
+template <typename T>
+void format_repeatedly(benchmark::State& state, const T& value) {
+  std::size_t bytes = 0;
+  for (auto _ : state) {
+    std::string formatted = ASTARTE_NS_FORMAT::format("{}", value);
+    bytes += formatted.size();
+    benchmark::DoNotOptimize(formatted);
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(static_cast<int64_t>(bytes));
+}
+
+void BM_FormatScalar(benchmark::State& state) { format_repeatedly(state, AstarteData(23.5)); }
+
+void BM_FormatDatetime(benchmark::State& state) {
+  format_repeatedly(state, AstarteData(std::chrono::system_clock::now()));
+}
+
+void BM_FormatDoubleArray(benchmark::State& state) {
+  format_repeatedly(
+      state, AstarteData(std::vector<double>(static_cast<std::size_t>(state.range(0)), 0.5)));
+}
+
+void BM_FormatBinaryBlob(benchmark::State& state) {
+  format_repeatedly(
+      state, AstarteData(std::vector<uint8_t>(static_cast<std::size_t>(state.range(0)), 0xA5)));
+}
+
+void BM_FormatObjectMessage(benchmark::State& state) {
+  const AstarteDatastreamObject object = {{"/temperature", AstarteData(23.5)},
+                                          {"/humidity", AstarteData(48.0)},
+                                          {"/label", AstarteData(std::string("sensor"))}};
+  format_repeatedly(state,
+                    AstarteMessage("org.astarte-platform.benchmark.Sensors", "/room", object));
+}
+
+void BM_FormatIndividualMessage(benchmark::State& state) {
+  format_repeatedly(state, AstarteMessage("org.astarte-platform.benchmark.Sensors",
+                                          "/room/temperature",
+                                          AstarteDatastreamIndividual(AstarteData(23.5))));
+}
+
+}  // namespace
+
+BENCHMARK(BM_FormatScalar);
+BENCHMARK(BM_FormatDatetime);
+BENCHMARK(BM_FormatDoubleArray)->ArgName("size")->RangeMultiplier(16)->Range(1, 4096);
+BENCHMARK(BM_FormatBinaryBlob)->ArgName("size")->RangeMultiplier(16)->Range(1, 4096);
+BENCHMARK(BM_FormatObjectMessage);
+BENCHMARK(BM_FormatIndividualMessage);
@@ -0,0 +1,81 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/individual.hpp"
+#include "astarte_device_sdk/json.hpp"
+#include "astarte_device_sdk/msg.hpp"
+#include "astarte_device_sdk/object.hpp"
+
+using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::AstarteDatastreamIndividual;
+using AstarteDeviceSdk::AstarteDatastreamObject;
+using AstarteDeviceSdk::AstarteJsonWriter;
+using AstarteDeviceSdk::AstarteMessage;
+
+namespace {
+
+// Same values as the formatter benchmarks, written by a single reused writer
+template <typename T>
+void write_repeatedly(benchmark::State& state, const T& value) {
+  AstarteJsonWriter writer;
+  std::size_t bytes = 0;
+  for (auto _ : state) {
+    writer.clear();
+    writer.write(value);
+    const std::string_view json = writer.view();
+    bytes += json.size();
+    benchmark::DoNotOptimize(json.data());
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(static_cast<int64_t>(bytes));
+}
+
+void BM_JsonScalar(benchmark::State& state) { write_repeatedly(state, AstarteData(23.5)); }
+
+void BM_JsonDatetime(benchmark::State& state) {
+  write_repeatedly(state, AstarteData(std::chrono::system_clock::now()));
+}
+
+void BM_JsonDoubleArray(benchmark::State& state) {
+  write_repeatedly(
+      state, AstarteData(std::vector<double>(static_cast<std::size_t>(state.range(0)), 0.5)));
+}
+
+void BM_JsonBinaryBlob(benchmark::State& state) {
+  write_repeatedly(
+      state, AstarteData(std::vector<uint8_t>(static_cast<std::size_t>(state.range(0)), 0xA5)));
+}
+
+void BM_JsonObjectMessage(benchmark::State& state) {
+  const AstarteDatastreamObject object = {{"/temperature", AstarteData(23.5)},
+                                          {"/humidity", AstarteData(48.0)},
+                                          {"/label", AstarteData(std::string("sensor"))}};
+  write_repeatedly(state,
+                   AstarteMessage("org.astarte-platform.benchmark.Sensors", "/room", object));
+}
+
+void BM_JsonIndividualMessage(benchmark::State& state) {
+  write_repeatedly(state, AstarteMessage("org.astarte-platform.benchmark.Sensors",
+                                         "/room/temperature",
+                                         AstarteDatastreamIndividual(AstarteData(23.5))));
+}
+
+}  // namespace
+
+BENCHMARK(BM_JsonScalar);
+BENCHMARK(BM_JsonDatetime);
+BENCHMARK(BM_JsonDoubleArray)->ArgName("size")->RangeMultiplier(16)->Range(1, 4096);
+BENCHMARK(BM_JsonBinaryBlob)->ArgName("size")->RangeMultiplier(16)->Range(1, 4096);
+BENCHMARK(BM_JsonObjectMessage);
+BENCHMARK(BM_JsonIndividualMessage);
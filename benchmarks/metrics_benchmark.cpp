@@ -0,0 +1,41 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstdint>
+
+#include "metrics_registry.hpp"
+
+using AstarteDeviceSdk::Counter;
+using AstarteDeviceSdk::LatencyHistogram;
+
+namespace {
+
+// Shared between the threads, as the metrics of the library are
+Counter counter;
+LatencyHistogram histogram;
+
+void BM_CounterAdd(benchmark::State& state) {
+  for (auto _ : state) {
+    counter.add();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_HistogramRecord(benchmark::State& state) {
+  int64_t latency = 1000;
+  for (auto _ : state) {
+    histogram.record(std::chrono::nanoseconds(latency));
+    // Spread the samples over the buckets
+    latency = (latency * 3) % 1000000000;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+BENCHMARK(BM_CounterAdd)->ThreadRange(1, 8);
+BENCHMARK(BM_HistogramRecord)->ThreadRange(1, 8);
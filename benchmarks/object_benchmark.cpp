@@ -0,0 +1,73 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/object.hpp"
+
+using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::AstarteDatastreamObject;
+
+namespace {
+
+auto make_paths(std::size_t count) -> std::vector<std::string> {
+  std::vector<std::string> paths;
+  paths.reserve(count);
+  for (std::size_t index = 0; index < count; index++) {
+    paths.push_back("/sensor" + std::to_string(index) + "/value");
+  }
+  return paths;
+}
+
+auto make_object(const std::vector<std::string>& paths) -> AstarteDatastreamObject {
+  AstarteDatastreamObject object;
+  for (std::size_t index = 0; index < paths.size(); index++) {
+    object.insert(paths[index], AstarteData(static_cast<double>(index)));
+  }
+  return object;
+}
+
+void BM_ObjectConstruction(benchmark::State& state) {
+  const std::vector<std::string> paths = make_paths(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    AstarteDatastreamObject object = make_object(paths);
+    benchmark::DoNotOptimize(object);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ObjectInitializerList(benchmark::State& state) {
+  for (auto _ : state) {
+    AstarteDatastreamObject object = {{"/temperature", AstarteData(23.5)},
+                                      {"/humidity", AstarteData(48.0)},
+                                      {"/pressure", AstarteData(1013.0)},
+                                      {"/label", AstarteData(std::string("sensor"))}};
+    benchmark::DoNotOptimize(object);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_ObjectLookup(benchmark::State& state) {
+  const std::vector<std::string> paths = make_paths(static_cast<std::size_t>(state.range(0)));
+  const AstarteDatastreamObject object = make_object(paths);
+  std::size_t index = 0;
+  for (auto _ : state) {
+    const AstarteData& value = object.at(paths[index]);
+    benchmark::DoNotOptimize(value);
+    index = (index + 1) % paths.size();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+BENCHMARK(BM_ObjectConstruction)->ArgName("fields")->RangeMultiplier(4)->Range(1, 256);
+BENCHMARK(BM_ObjectInitializerList);
+BENCHMARK(BM_ObjectLookup)->ArgName("fields")->RangeMultiplier(4)->Range(1, 256);
@@ -0,0 +1,96 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <spdlog/spdlog.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/device_grpc.hpp"
+#include "astarte_device_sdk/object.hpp"
+#include "fake_message_hub.hpp"
+
+using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::AstarteDatastreamObject;
+using AstarteDeviceSdk::AstarteDeviceGRPC;
+using AstarteDeviceSdk::FakeMessageHub;
+using AstarteDeviceSdk::FakeMessageHubServer;
+
+namespace {
+
+const char* const INTERFACE = "org.astarte-platform.benchmark.Sensors";
+
+// A fake hub listening on the loopback interface and a device connected to it
+class FakeHubDevice {
+ public:
+  FakeHubDevice() {
+    spdlog::set_level(spdlog::level::warn);
+    device_ = std::make_unique<AstarteDeviceGRPC>(server_.get_address(), "benchmark-node");
+    device_->connect();
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!device_->is_connected() && (std::chrono::steady_clock::now() < deadline)) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+  }
+  ~FakeHubDevice() { device_->disconnect(); }
+  FakeHubDevice(const FakeHubDevice& other) = delete;
+  FakeHubDevice(FakeHubDevice&& other) = delete;
+  auto operator=(const FakeHubDevice& other) -> FakeHubDevice& = delete;
+  auto operator=(FakeHubDevice&& other) -> FakeHubDevice& = delete;
+
+  static auto shared() -> FakeHubDevice& {
+    static FakeHubDevice instance;
+    return instance;
+  }
+  auto device() -> AstarteDeviceGRPC& { return *device_; }
+  auto hub() -> FakeMessageHub& { return server_.hub(); }
+
+ private:
+  // Declared first, so that it outlives the device
+  FakeMessageHubServer server_;
+  std::unique_ptr<AstarteDeviceGRPC> device_;
+};
+
+// Conversion, scheduling, the gRPC call over the loopback and the acknowledgement of the hub
+void BM_SendIndividual(benchmark::State& state) {
+  FakeHubDevice& fixture = FakeHubDevice::shared();
+  if (!fixture.device().is_connected()) {
+    state.SkipWithError("The device could not connect to the fake message hub.");
+    return;
+  }
+  const uint64_t received = fixture.hub().get_stats().messages_received;
+  for (auto _ : state) {
+    fixture.device().send_individual(INTERFACE, "/room/temperature", AstarteData(23.5), nullptr);
+  }
+  state.SetItemsProcessed(state.iterations());
+  if (state.thread_index() == 0) {
+    const uint64_t total = fixture.hub().get_stats().messages_received;
+    state.counters["received"] = static_cast<double>(total - received);
+  }
+}
+
+void BM_SendObject(benchmark::State& state) {
+  FakeHubDevice& fixture = FakeHubDevice::shared();
+  if (!fixture.device().is_connected()) {
+    state.SkipWithError("The device could not connect to the fake message hub.");
+    return;
+  }
+  const AstarteDatastreamObject object = {{"temperature", AstarteData(23.5)},
+                                          {"humidity", AstarteData(48.0)},
+                                          {"label", AstarteData(std::string("sensor"))}};
+  for (auto _ : state) {
+    fixture.device().send_object(INTERFACE, "/room", object, nullptr);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+BENCHMARK(BM_SendIndividual)->ThreadRange(1, 8)->UseRealTime()->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_SendObject)->ThreadRange(1, 8)->UseRealTime()->Unit(benchmark::kMicrosecond);
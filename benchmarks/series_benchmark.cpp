@@ -0,0 +1,96 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <astarteplatform/msghub/astarte_message.pb.h>
+#include <benchmark/benchmark.h>
+#include <google/protobuf/arena.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+#include "grpc_converter.hpp"
+
+using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::encode_series;
+using AstarteDeviceSdk::gRPCAstarteDatastreamIndividual;
+using AstarteDeviceSdk::GrpcConverterTo;
+using gRPCAstarteMessage = astarteplatform::msghub::AstarteMessage;
+using std::chrono::system_clock;
+
+namespace {
+
+const char* const INTERFACE = "org.astarte-platform.benchmark.Signal";
+const char* const PATH = "/channel0/value";
+// Same as the device
+constexpr std::size_t ARENA_BLOCK_SIZE = 256 * 1024;
+
+// A 1 kHz signal
+void make_signal(std::size_t count, std::vector<double>& values,
+                 std::vector<system_clock::time_point>& timestamps) {
+  const system_clock::time_point start = system_clock::now();
+  values.resize(count);
+  timestamps.resize(count);
+  for (std::size_t index = 0; index < count; index++) {
+    values[index] = static_cast<double>(index % 1000) * 0.001;
+    timestamps[index] = start + std::chrono::milliseconds(index);
+  }
+}
+
+// Conversion performed by a send_individual call for each sample
+void BM_IndividualEncode(benchmark::State& state) {
+  std::vector<double> values;
+  std::vector<system_clock::time_point> timestamps;
+  make_signal(static_cast<std::size_t>(state.range(0)), values, timestamps);
+
+  for (auto _ : state) {
+    std::vector<gRPCAstarteMessage> messages;
+    messages.reserve(values.size());
+    for (std::size_t index = 0; index < values.size(); index++) {
+      const AstarteData data(values[index]);
+      gRPCAstarteMessage& message = messages.emplace_back();
+      message.set_interface_name(INTERFACE);
+      message.set_path(PATH);
+      std::unique_ptr<gRPCAstarteDatastreamIndividual> individual =
+          GrpcConverterTo()(data, &timestamps[index]);
+      message.set_allocated_datastream_individual(individual.release());
+    }
+    benchmark::DoNotOptimize(messages.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Conversion performed by send_series
+void BM_SeriesEncode(benchmark::State& state) {
+  std::vector<double> values;
+  std::vector<system_clock::time_point> timestamps;
+  make_signal(static_cast<std::size_t>(state.range(0)), values, timestamps);
+
+  for (auto _ : state) {
+    google::protobuf::ArenaOptions options;
+    options.start_block_size = ARENA_BLOCK_SIZE;
+    options.max_block_size = ARENA_BLOCK_SIZE;
+    google::protobuf::Arena arena(options);
+    std::vector<gRPCAstarteMessage*> messages =
+        encode_series<double>(arena, INTERFACE, PATH, values, timestamps);
+    benchmark::DoNotOptimize(messages.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_IndividualEncode)
+    ->ArgName("samples")
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_SeriesEncode)
+    ->ArgName("samples")
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000)
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,54 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/individual.hpp"
+#include "astarte_device_sdk/msg.hpp"
+#include "shared_queue.hpp"
+
+using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::AstarteDatastreamIndividual;
+using AstarteDeviceSdk::AstarteMessage;
+using AstarteDeviceSdk::SharedQueue;
+
+namespace {
+
+auto make_message() -> AstarteMessage {
+  return {"org.astarte-platform.benchmark.Sensors", "/room/temperature",
+          AstarteDatastreamIndividual(AstarteData(23.5))};
+}
+
+// Even threads produce and odd threads consume, as the gRPC and application threads of a device
+void BM_SharedQueuePushPop(benchmark::State& state) {
+  static SharedQueue<AstarteMessage> queue;
+  const AstarteMessage message = make_message();
+  const bool producer = (state.threads() == 1) || ((state.thread_index() % 2) == 0);
+  const bool consumer = (state.threads() == 1) || ((state.thread_index() % 2) == 1);
+  for (auto _ : state) {
+    if (producer) {
+      queue.push(message);
+    }
+    if (consumer) {
+      std::optional<AstarteMessage> popped = queue.pop(std::chrono::milliseconds(1));
+      benchmark::DoNotOptimize(popped);
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+  // Leave the queue empty for the next run
+  if (state.thread_index() == 0) {
+    while (queue.pop(std::chrono::milliseconds(0)).has_value()) {
+    }
+  }
+}
+
+}  // namespace
+
+BENCHMARK(BM_SharedQueuePushPop)->ThreadRange(1, 8)->UseRealTime();
@@ -0,0 +1,219 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef FAKE_MESSAGE_HUB_H
+#define FAKE_MESSAGE_HUB_H
+
+#include <astarteplatform/msghub/astarte_data.pb.h>
+#include <astarteplatform/msghub/astarte_message.pb.h>
+#include <astarteplatform/msghub/interface.pb.h>
+#include <astarteplatform/msghub/message_hub_service.grpc.pb.h>
+#include <astarteplatform/msghub/node.pb.h>
+#include <astarteplatform/msghub/property.pb.h>
+#include <google/protobuf/empty.pb.h>
+#include <grpcpp/grpcpp.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace AstarteDeviceSdk {
+
+/** @brief Counters of the calls handled by a FakeMessageHub. */
+struct FakeMessageHubStats {
+  /** @brief Number of Attach streams opened. */
+  uint64_t attaches{0};
+  /** @brief Number of Detach calls. */
+  uint64_t detaches{0};
+  /** @brief Number of messages received with Send, including the failed ones. */
+  uint64_t messages_received{0};
+  /** @brief Encoded size of the messages received with Send. */
+  uint64_t bytes_received{0};
+  /** @brief Number of events written on the Attach streams. */
+  uint64_t events_sent{0};
+  /** @brief Number of interfaces added, on attach or with AddInterfaces. */
+  uint64_t interfaces_added{0};
+  /** @brief Number of interfaces removed with RemoveInterfaces. */
+  uint64_t interfaces_removed{0};
+  /** @brief Number of GetProperty, GetProperties and GetAllProperties calls. */
+  uint64_t property_requests{0};
+};
+
+/**
+ * @brief Message hub service without any network dependency, for tests and benchmarks.
+ * @details Accepts the messages sent by the devices, stores their properties and keeps their
+ * Attach streams open. Server to device events can be pushed once or generated at a fixed rate,
+ * streams can be failed on demand and every call can be delayed, so that throughput and
+ * reconnections can be measured deterministically. Each Attach stream occupies a server thread.
+ */
+class FakeMessageHub : public astarteplatform::msghub::MessageHub::Service {
+ public:
+  /** @brief Event sent to the devices on their Attach stream. */
+  using Event = astarteplatform::msghub::MessageHubEvent;
+  /** @brief Function creating the generated events, from their sequence number on the stream. */
+  using EventFactory = std::function<Event(uint64_t sequence)>;
+
+  /**
+   * @brief Delay every call, as a remote message hub would.
+   * @param latency The delay added before handling each call.
+   */
+  void set_latency(std::chrono::microseconds latency);
+  /**
+   * @brief Set the status returned by Send, to simulate a failing message hub.
+   * @param status The status, OK to accept the messages again.
+   */
+  void set_send_status(grpc::Status status);
+  /**
+   * @brief Keep a copy of the messages received with Send.
+   * @param enabled True to record the messages, false to only count them.
+   */
+  void set_record_messages(bool enabled);
+  /**
+   * @brief Generate events on each Attach stream at a fixed rate.
+   * @param events_per_second The rate of each stream, zero to stop generating events.
+   * @param factory The function creating the events.
+   */
+  void set_event_rate(double events_per_second, EventFactory factory);
+  /**
+   * @brief Send an event on every open Attach stream.
+   * @param event The event.
+   */
+  void push_event(const Event& event);
+  /**
+   * @brief End every open Attach stream with a status, the devices will reconnect.
+   * @param status The status of the streams.
+   */
+  void fail_streams(const grpc::Status& status);
+  /**
+   * @brief Store a server owned property, returned by the property calls.
+   * @param interface_name The interface of the property.
+   * @param path The path of the property.
+   * @param data The value of the property.
+   */
+  void set_server_property(const std::string& interface_name, const std::string& path,
+                           const astarteplatform::msghub::AstarteData& data);
+  /**
+   * @brief Wait until a number of Attach streams are open.
+   * @param count The number of streams.
+   * @param timeout The maximum time to wait.
+   * @return True if the streams are open, false on timeout.
+   */
+  auto wait_for_streams(std::size_t count, std::chrono::milliseconds timeout) -> bool;
+  /**
+   * @brief Get the counters of the handled calls.
+   * @return The counters.
+   */
+  [[nodiscard]] auto get_stats() const -> FakeMessageHubStats;
+  /**
+   * @brief Take the messages recorded since the last call.
+   * @return The messages, in their reception order.
+   */
+  auto take_messages() -> std::vector<astarteplatform::msghub::AstarteMessage>;
+  /** @brief End the open streams and refuse the new ones, before shutting down the server. */
+  void stop();
+
+  // Calls of the MessageHub service
+  auto Attach(grpc::ServerContext* context, const astarteplatform::msghub::Node* request,
+              grpc::ServerWriter<Event>* writer) -> grpc::Status override;
+  auto Send(grpc::ServerContext* context, const astarteplatform::msghub::AstarteMessage* request,
+            google::protobuf::Empty* response) -> grpc::Status override;
+  auto Detach(grpc::ServerContext* context, const google::protobuf::Empty* request,
+              google::protobuf::Empty* response) -> grpc::Status override;
+  auto AddInterfaces(grpc::ServerContext* context,
+                     const astarteplatform::msghub::InterfacesJson* request,
+                     google::protobuf::Empty* response) -> grpc::Status override;
+  auto RemoveInterfaces(grpc::ServerContext* context,
+                        const astarteplatform::msghub::InterfacesName* request,
+                        google::protobuf::Empty* response) -> grpc::Status override;
+  auto GetProperties(grpc::ServerContext* context,
+                     const astarteplatform::msghub::InterfaceName* request,
+                     astarteplatform::msghub::StoredProperties* response) -> grpc::Status override;
+  auto GetAllProperties(grpc::ServerContext* context,
+                        const astarteplatform::msghub::PropertyFilter* request,
+                        astarteplatform::msghub::StoredProperties* response)
+      -> grpc::Status override;
+  auto GetProperty(grpc::ServerContext* context,
+                   const astarteplatform::msghub::PropertyIdentifier* request,
+                   astarteplatform::msghub::AstartePropertyIndividual* response)
+      -> grpc::Status override;
+
+ private:
+  struct Stream {
+    std::list<Event> pending;
+    std::optional<grpc::Status> failure;
+  };
+
+  void delay() const;
+  auto run_stream(grpc::ServerContext* context, grpc::ServerWriter<Event>* writer, Stream& stream)
+      -> grpc::Status;
+
+  mutable std::mutex mutex_;
+  std::condition_variable cv_;
+  bool stopping_{false};
+  std::chrono::microseconds latency_{0};
+  grpc::Status send_status_;
+  bool record_messages_{false};
+  std::vector<astarteplatform::msghub::AstarteMessage> messages_;
+  double event_rate_{0};
+  uint64_t event_rate_generation_{0};
+  EventFactory event_factory_;
+  std::list<Stream*> streams_;
+  std::map<std::pair<std::string, std::string>, astarteplatform::msghub::Property> properties_;
+  FakeMessageHubStats stats_;
+};
+
+/** @brief gRPC server running a FakeMessageHub, torn down with the object. */
+class FakeMessageHubServer {
+ public:
+  /**
+   * @brief Start the server.
+   * @param address The listening address, the port 0 picks a free port.
+   */
+  explicit FakeMessageHubServer(const std::string& address = "127.0.0.1:0");
+  /** @brief Stop the fake message hub and shut down the server. */
+  ~FakeMessageHubServer();
+  FakeMessageHubServer(const FakeMessageHubServer& other) = delete;
+  FakeMessageHubServer(FakeMessageHubServer&& other) = delete;
+  auto operator=(const FakeMessageHubServer& other) -> FakeMessageHubServer& = delete;
+  auto operator=(FakeMessageHubServer&& other) -> FakeMessageHubServer& = delete;
+
+  /**
+   * @brief Get the address the devices connect to.
+   * @return The address, with the port picked by the server.
+   */
+  [[nodiscard]] auto get_address() const -> const std::string&;
+  /**
+   * @brief Get the fake message hub.
+   * @return The service handling the calls.
+   */
+  auto hub() -> FakeMessageHub&;
+  /**
+   * @brief Create a channel calling the server without a socket.
+   * @details The devices only connect to addresses, this is meant for the tests using a stub.
+   * @param interceptors The interceptors of the channel.
+   * @return The channel.
+   */
+  auto in_process_channel(
+      std::vector<std::unique_ptr<grpc::experimental::ClientInterceptorFactoryInterface>>
+          interceptors = {}) -> std::shared_ptr<grpc::Channel>;
+
+ private:
+  FakeMessageHub hub_;
+  std::unique_ptr<grpc::Server> server_;
+  std::string address_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // FAKE_MESSAGE_HUB_H
@@ -0,0 +1,338 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "fake_message_hub.hpp"
+
+#include <astarteplatform/msghub/astarte_data.pb.h>
+#include <astarteplatform/msghub/astarte_message.pb.h>
+#include <astarteplatform/msghub/interface.pb.h>
+#include <astarteplatform/msghub/node.pb.h>
+#include <astarteplatform/msghub/property.pb.h>
+#include <google/protobuf/empty.pb.h>
+#include <grpcpp/grpcpp.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace AstarteDeviceSdk {
+
+using astarteplatform::msghub::AstarteMessage;
+using astarteplatform::msghub::Property;
+using std::chrono::steady_clock;
+
+namespace {
+
+// Bounds the time a stream takes to notice a cancellation by the device
+constexpr std::chrono::milliseconds CANCELLATION_POLL(10);
+
+}  // namespace
+
+void FakeMessageHub::set_latency(std::chrono::microseconds latency) {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  latency_ = latency;
+}
+
+void FakeMessageHub::set_send_status(grpc::Status status) {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  send_status_ = std::move(status);
+}
+
+void FakeMessageHub::set_record_messages(bool enabled) {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  record_messages_ = enabled;
+}
+
+void FakeMessageHub::set_event_rate(double events_per_second, EventFactory factory) {
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    event_rate_ = std::max(events_per_second, 0.0);
+    event_factory_ = std::move(factory);
+    event_rate_generation_++;
+  }
+  cv_.notify_all();
+}
+
+void FakeMessageHub::push_event(const Event& event) {
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    for (Stream* stream : streams_) {
+      stream->pending.push_back(event);
+    }
+  }
+  cv_.notify_all();
+}
+
+void FakeMessageHub::fail_streams(const grpc::Status& status) {
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    for (Stream* stream : streams_) {
+      stream->failure = status;
+    }
+  }
+  cv_.notify_all();
+}
+
+void FakeMessageHub::set_server_property(const std::string& interface_name,
+                                         const std::string& path,
+                                         const astarteplatform::msghub::AstarteData& data) {
+  Property property;
+  property.set_interface_name(interface_name);
+  property.set_path(path);
+  property.set_ownership(astarteplatform::msghub::SERVER);
+  *property.mutable_data() = data;
+  const std::lock_guard<std::mutex> lock(mutex_);
+  properties_.insert_or_assign({interface_name, path}, std::move(property));
+}
+
+auto FakeMessageHub::wait_for_streams(std::size_t count, std::chrono::milliseconds timeout)
+    -> bool {
+  std::unique_lock<std::mutex> lock(mutex_);
+  return cv_.wait_for(lock, timeout, [this, count] { return streams_.size() >= count; });
+}
+
+auto FakeMessageHub::get_stats() const -> FakeMessageHubStats {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  return stats_;
+}
+
+auto FakeMessageHub::take_messages() -> std::vector<AstarteMessage> {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  return std::exchange(messages_, {});
+}
+
+void FakeMessageHub::stop() {
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  cv_.notify_all();
+}
+
+void FakeMessageHub::delay() const {
+  std::chrono::microseconds latency;
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    latency = latency_;
+  }
+  if (latency.count() > 0) {
+    std::this_thread::sleep_for(latency);
+  }
+}
+
+auto FakeMessageHub::Attach(grpc::ServerContext* context,
+                            const astarteplatform::msghub::Node* request,
+                            grpc::ServerWriter<Event>* writer) -> grpc::Status {
+  delay();
+  Stream stream;
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    if (stopping_) {
+      return {grpc::StatusCode::UNAVAILABLE, "The fake message hub is stopping."};
+    }
+    stats_.attaches++;
+    stats_.interfaces_added += static_cast<uint64_t>(request->interfaces_json_size());
+  }
+  // The devices refuse a stream without metadata
+  context->AddInitialMetadata("fake-message-hub", "true");
+  writer->SendInitialMetadata();
+
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    streams_.push_back(&stream);
+  }
+  cv_.notify_all();
+  grpc::Status status = run_stream(context, writer, stream);
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    streams_.remove(&stream);
+  }
+  return status;
+}
+
+auto FakeMessageHub::run_stream(grpc::ServerContext* context, grpc::ServerWriter<Event>* writer,
+                                Stream& stream) -> grpc::Status {
+  std::unique_lock<std::mutex> lock(mutex_);
+  uint64_t generation = event_rate_generation_;
+  uint64_t sequence = 0;
+  steady_clock::time_point next_event = steady_clock::now();
+  while (!stopping_ && !context->IsCancelled()) {
+    if (stream.failure.has_value()) {
+      return *stream.failure;
+    }
+
+    std::optional<Event> event;
+    if (!stream.pending.empty()) {
+      event = std::move(stream.pending.front());
+      stream.pending.pop_front();
+    } else if (event_rate_ > 0) {
+      if (generation != event_rate_generation_) {
+        // The rate changed, restart the pacing from now
+        generation = event_rate_generation_;
+        next_event = steady_clock::now();
+      }
+      if (steady_clock::now() >= next_event) {
+        event = event_factory_(sequence++);
+        next_event += std::chrono::duration_cast<steady_clock::duration>(
+            std::chrono::duration<double>(1.0 / event_rate_));
+      }
+    }
+
+    if (event.has_value()) {
+      lock.unlock();
+      const bool written = writer->Write(*event);
+      lock.lock();
+      if (!written) {
+        return {grpc::StatusCode::CANCELLED, "The device closed the stream."};
+      }
+      stats_.events_sent++;
+      continue;
+    }
+
+    steady_clock::time_point wake_up = steady_clock::now() + CANCELLATION_POLL;
+    if (event_rate_ > 0) {
+      wake_up = std::min(wake_up, next_event);
+    }
+    cv_.wait_until(lock, wake_up);
+  }
+  return grpc::Status::OK;
+}
+
+auto FakeMessageHub::Send(grpc::ServerContext* /*context*/, const AstarteMessage* request,
+                          google::protobuf::Empty* /*response*/) -> grpc::Status {
+  delay();
+  const std::lock_guard<std::mutex> lock(mutex_);
+  stats_.messages_received++;
+  stats_.bytes_received += request->ByteSizeLong();
+  if (!send_status_.ok()) {
+    return send_status_;
+  }
+  if (record_messages_) {
+    messages_.push_back(*request);
+  }
+  if (request->has_property_individual()) {
+    const std::pair<std::string, std::string> key{request->interface_name(), request->path()};
+    if (request->property_individual().has_data()) {
+      Property property;
+      property.set_interface_name(request->interface_name());
+      property.set_path(request->path());
+      property.set_ownership(astarteplatform::msghub::DEVICE);
+      *property.mutable_data() = request->property_individual().data();
+      properties_.insert_or_assign(key, std::move(property));
+    } else {
+      properties_.erase(key);
+    }
+  }
+  return grpc::Status::OK;
+}
+
+auto FakeMessageHub::Detach(grpc::ServerContext* /*context*/,
+                            const google::protobuf::Empty* /*request*/,
+                            google::protobuf::Empty* /*response*/) -> grpc::Status {
+  delay();
+  const std::lock_guard<std::mutex> lock(mutex_);
+  stats_.detaches++;
+  return grpc::Status::OK;
+}
+
+auto FakeMessageHub::AddInterfaces(grpc::ServerContext* /*context*/,
+                                   const astarteplatform::msghub::InterfacesJson* request,
+                                   google::protobuf::Empty* /*response*/) -> grpc::Status {
+  delay();
+  const std::lock_guard<std::mutex> lock(mutex_);
+  stats_.interfaces_added += static_cast<uint64_t>(request->interfaces_json_size());
+  return grpc::Status::OK;
+}
+
+auto FakeMessageHub::RemoveInterfaces(grpc::ServerContext* /*context*/,
+                                      const astarteplatform::msghub::InterfacesName* request,
+                                      google::protobuf::Empty* /*response*/) -> grpc::Status {
+  delay();
+  const std::lock_guard<std::mutex> lock(mutex_);
+  stats_.interfaces_removed += static_cast<uint64_t>(request->names_size());
+  for (const std::string& name : request->names()) {
+    std::erase_if(properties_, [&name](const auto& entry) { return entry.first.first == name; });
+  }
+  return grpc::Status::OK;
+}
+
+auto FakeMessageHub::GetProperties(grpc::ServerContext* /*context*/,
+                                   const astarteplatform::msghub::InterfaceName* request,
+                                   astarteplatform::msghub::StoredProperties* response)
+    -> grpc::Status {
+  delay();
+  const std::lock_guard<std::mutex> lock(mutex_);
+  stats_.property_requests++;
+  for (const auto& [key, property] : properties_) {
+    if (key.first == request->name()) {
+      *response->add_properties() = property;
+    }
+  }
+  return grpc::Status::OK;
+}
+
+auto FakeMessageHub::GetAllProperties(grpc::ServerContext* /*context*/,
+                                      const astarteplatform::msghub::PropertyFilter* request,
+                                      astarteplatform::msghub::StoredProperties* response)
+    -> grpc::Status {
+  delay();
+  const std::lock_guard<std::mutex> lock(mutex_);
+  stats_.property_requests++;
+  for (const auto& [key, property] : properties_) {
+    if (!request->has_ownership() || (request->ownership() == property.ownership())) {
+      *response->add_properties() = property;
+    }
+  }
+  return grpc::Status::OK;
+}
+
+auto FakeMessageHub::GetProperty(grpc::ServerContext* /*context*/,
+                                 const astarteplatform::msghub::PropertyIdentifier* request,
+                                 astarteplatform::msghub::AstartePropertyIndividual* response)
+    -> grpc::Status {
+  delay();
+  const std::lock_guard<std::mutex> lock(mutex_);
+  stats_.property_requests++;
+  auto iter = properties_.find({request->interface_name(), request->path()});
+  if (iter != properties_.end()) {
+    *response->mutable_data() = iter->second.data();
+  }
+  return grpc::Status::OK;
+}
+
+FakeMessageHubServer::FakeMessageHubServer(const std::string& address) {
+  int port = 0;
+  grpc::ServerBuilder builder;
+  builder.AddListeningPort(address, grpc::InsecureServerCredentials(), &port);
+  builder.RegisterService(&hub_);
+  server_ = builder.BuildAndStart();
+  // Replace the port requested with the one picked by the server
+  address_ = address.substr(0, address.rfind(':') + 1) + std::to_string(port);
+}
+
+FakeMessageHubServer::~FakeMessageHubServer() {
+  hub_.stop();
+  server_->Shutdown();
+}
+
+auto FakeMessageHubServer::get_address() const -> const std::string& { return address_; }
+
+auto FakeMessageHubServer::hub() -> FakeMessageHub& { return hub_; }
+
+auto FakeMessageHubServer::in_process_channel(
+    std::vector<std::unique_ptr<grpc::experimental::ClientInterceptorFactoryInterface>>
+        interceptors) -> std::shared_ptr<grpc::Channel> {
+  return server_->experimental().InProcessChannelWithInterceptors(grpc::ChannelArguments(),
+                                                                  std::move(interceptors));
+}
+
+}  // namespace AstarteDeviceSdk
@@ -104,6 +104,12 @@ file_patterns=(
     "private/"*.hpp
     "samples/"*/*.cpp
     "unit/"*.cpp
+    "alloc_counter/src/"*.cpp
+    "alloc_counter/include/"*.hpp
+    "fake_hub/src/"*.cpp
+    "fake_hub/include/"*.hpp
+    "loadgen/src/"*.cpp
+    "loadgen/include/"*.hpp
     "end_to_end/src/"*.cpp
     "end_to_end/include/"*.hpp
     "end_to_end/include/constants/"*.hpp
@@ -139,6 +145,9 @@ fi
 cmake_files=(
     "CMakeLists.txt"
     "unit/CMakeLists.txt"
+    "alloc_counter/CMakeLists.txt"
+    "fake_hub/CMakeLists.txt"
+    "loadgen/CMakeLists.txt"
     "end_to_end/CMakeLists.txt"
     "samples/qt/CMakeLists.txt"
     "samples/simple/CMakeLists.txt"
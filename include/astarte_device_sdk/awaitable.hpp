@@ -0,0 +1,156 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef ASTARTE_DEVICE_SDK_AWAITABLE_H
+#define ASTARTE_DEVICE_SDK_AWAITABLE_H
+
+/**
+ * @file astarte_device_sdk/awaitable.hpp
+ * @brief Awaitable results of the asynchronous operations of the Astarte device.
+ */
+
+#include <atomic>
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "astarte_device_sdk/executor.hpp"
+
+/** @brief Umbrella namespace for the Astarte device SDK */
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief State shared between an asynchronous operation and the coroutine awaiting it.
+ * @details This class is used internally by the library to complete the awaitables.
+ * @tparam T The type of the result of the operation.
+ */
+template <typename T>
+class AstarteAsyncState {
+ public:
+  /** @brief Type used to store the result, std::monostate for operations without a result. */
+  using ValueType = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+
+  /**
+   * @brief Constructor for the asynchronous state class.
+   * @param executor The executor on which the awaiting coroutine is resumed. When nullptr the
+   * coroutine is resumed on the thread completing the operation.
+   */
+  explicit AstarteAsyncState(std::shared_ptr<AstarteExecutor> executor = nullptr)
+      : executor_(std::move(executor)) {}
+
+  /**
+   * @brief Complete the operation successfully.
+   * @param value The result of the operation.
+   */
+  void set_value(ValueType value = {}) {
+    value_.emplace(std::move(value));
+    complete();
+  }
+  /**
+   * @brief Complete the operation with an error.
+   * @param error The exception that will be thrown to the awaiting coroutine.
+   */
+  void set_exception(std::exception_ptr error) {
+    error_ = std::move(error);
+    complete();
+  }
+  /**
+   * @brief Check if the operation has completed.
+   * @return True if the operation has completed, false otherwise.
+   */
+  [[nodiscard]] auto is_completed() const -> bool {
+    return stage_.load(std::memory_order_acquire) == Stage::kCompleted;
+  }
+  /**
+   * @brief Register the coroutine awaiting the operation.
+   * @param handle The handle of the awaiting coroutine.
+   * @return False if the operation completed in the meantime and the coroutine should not be
+   * suspended, true otherwise.
+   */
+  auto suspend(std::coroutine_handle<> handle) -> bool {
+    handle_ = handle;
+    Stage expected = Stage::kPending;
+    return stage_.compare_exchange_strong(expected, Stage::kSuspended, std::memory_order_acq_rel,
+                                          std::memory_order_acquire);
+  }
+  /**
+   * @brief Get the result of a completed operation.
+   * @return The result of the operation, throws the operation error if any.
+   */
+  auto take() -> T {
+    if (error_) {
+      std::rethrow_exception(error_);
+    }
+    if constexpr (!std::is_void_v<T>) {
+      return std::move(*value_);
+    }
+  }
+
+ private:
+  enum class Stage : uint8_t { kPending, kSuspended, kCompleted };
+
+  void complete() {
+    // Whoever comes last between the completion and the suspension resumes the coroutine
+    if (stage_.exchange(Stage::kCompleted, std::memory_order_acq_rel) != Stage::kSuspended) {
+      return;
+    }
+    if (executor_) {
+      executor_->post([handle = handle_] { handle.resume(); });
+    } else {
+      handle_.resume();
+    }
+  }
+
+  std::atomic<Stage> stage_{Stage::kPending};
+  std::coroutine_handle<> handle_;
+  std::optional<ValueType> value_;
+  std::exception_ptr error_;
+  std::shared_ptr<AstarteExecutor> executor_;
+};
+
+/**
+ * @brief Result of an asynchronous operation of the Astarte device, to be used with co_await.
+ * @details The operation is started when the awaitable is created, and it keeps running even if the
+ * awaitable is destroyed without being awaited. An awaitable should be awaited at most once.
+ * @tparam T The type of the result of the operation.
+ */
+template <typename T>
+class AstarteAwaitable {
+ public:
+  /**
+   * @brief Constructor for the awaitable class.
+   * @param state The state shared with the asynchronous operation.
+   */
+  explicit AstarteAwaitable(std::shared_ptr<AstarteAsyncState<T>> state)
+      : state_(std::move(state)) {}
+
+  /**
+   * @brief Check if the result is already available.
+   * @return True if the operation has completed, false otherwise.
+   */
+  [[nodiscard]] auto await_ready() const -> bool { return state_->is_completed(); }
+  /**
+   * @brief Suspend the awaiting coroutine until the operation completes.
+   * @param handle The handle of the awaiting coroutine.
+   * @return False if the operation has already completed, true otherwise.
+   */
+  auto await_suspend(std::coroutine_handle<> handle) -> bool { return state_->suspend(handle); }
+  /**
+   * @brief Get the result of the operation.
+   * @return The result of the operation, throws the operation error if any.
+   */
+  auto await_resume() -> T { return state_->take(); }
+
+ private:
+  std::shared_ptr<AstarteAsyncState<T>> state_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // ASTARTE_DEVICE_SDK_AWAITABLE_H
@@ -0,0 +1,62 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef ASTARTE_DEVICE_SDK_BASE64_H
+#define ASTARTE_DEVICE_SDK_BASE64_H
+
+/**
+ * @file astarte_device_sdk/base64.hpp
+ * @brief Base64 encoding of the binary blobs.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief Get the length of the base64 encoding of some bytes.
+ * @param size The number of bytes.
+ * @return The number of characters of the encoding, padding included.
+ */
+constexpr auto base64_encoded_size(std::size_t size) -> std::size_t { return ((size + 2) / 3) * 4; }
+
+/**
+ * @brief Append the base64 encoding of some bytes to a string.
+ * @details Uses the standard alphabet with padding, as Astarte does for the binary blobs. The
+ * bytes are encoded with the vector instructions of the CPU when available.
+ * @param data The bytes to encode.
+ * @param out The string the encoding is appended to.
+ */
+void base64_encode(std::span<const uint8_t> data, std::string& out);
+
+/**
+ * @brief Encode some bytes in base64.
+ * @param data The bytes to encode.
+ * @return The encoding, with the standard alphabet and padding.
+ */
+auto base64_encode(std::span<const uint8_t> data) -> std::string;
+
+/**
+ * @brief Decode a base64 text.
+ * @details The text must use the standard alphabet with padding, without spaces or new lines.
+ * An AstarteInvalidInputException is thrown when it doesn't.
+ * @param text The text to decode.
+ * @return The decoded bytes.
+ */
+auto base64_decode(std::string_view text) -> std::vector<uint8_t>;
+
+/**
+ * @brief Get the instruction set used by the base64 functions on this CPU.
+ * @return One of "avx2", "ssse3", "neon" and "scalar".
+ */
+auto base64_implementation() -> std::string_view;
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // ASTARTE_DEVICE_SDK_BASE64_H
@@ -0,0 +1,68 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef ASTARTE_DEVICE_SDK_COMPRESSION_H
+#define ASTARTE_DEVICE_SDK_COMPRESSION_H
+
+/**
+ * @file astarte_device_sdk/compression.hpp
+ * @brief Compression of the messages sent to the Astarte message hub.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief Compression settings of a connection to the message hub.
+ * @details The algorithm is the default of the whole gRPC channel. Data and property messages
+ * smaller than the minimum size are sent uncompressed, since compressing small scalar values costs
+ * CPU time without saving any byte. The message hub must support the chosen algorithm.
+ */
+class AstarteCompression {
+ public:
+  /** @brief Compression algorithm. */
+  enum class Algorithm : uint8_t {
+    /** @brief No compression. */
+    kNone,
+    /** @brief Deflate compression. */
+    kDeflate,
+    /** @brief Gzip compression. */
+    kGzip
+  };
+
+  /** @brief Default minimum size of the compressed messages, in bytes. */
+  static constexpr std::size_t DEFAULT_MIN_SIZE = 1024;
+
+  /**
+   * @brief Constructor for the AstarteCompression class.
+   * @param algorithm The compression algorithm.
+   */
+  explicit AstarteCompression(Algorithm algorithm);
+  /**
+   * @brief Set the minimum size of the compressed messages.
+   * @param bytes Data and property messages with a smaller encoded size are sent uncompressed.
+   * @return A reference to these settings.
+   */
+  auto with_min_size(std::size_t bytes) -> AstarteCompression&;
+  /**
+   * @brief Get the compression algorithm.
+   * @return The compression algorithm.
+   */
+  [[nodiscard]] auto get_algorithm() const -> Algorithm;
+  /**
+   * @brief Get the minimum size of the compressed messages.
+   * @return The minimum size, in bytes.
+   */
+  [[nodiscard]] auto get_min_size() const -> std::size_t;
+
+ private:
+  Algorithm algorithm_;
+  std::size_t min_size_{DEFAULT_MIN_SIZE};
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // ASTARTE_DEVICE_SDK_COMPRESSION_H
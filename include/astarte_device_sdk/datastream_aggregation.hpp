@@ -0,0 +1,66 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef ASTARTE_DEVICE_SDK_DATASTREAM_AGGREGATION_H
+#define ASTARTE_DEVICE_SDK_DATASTREAM_AGGREGATION_H
+
+/**
+ * @file astarte_device_sdk/datastream_aggregation.hpp
+ * @brief Aggregation of individual datastream samples into datastream objects.
+ */
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief Configuration packing the samples of an individual datastream into objects.
+ * @details Samples sent on the same common path, the path without its last segment, are buffered
+ * for a time window and then sent as a single object on an object aggregated interface. The last
+ * segment of the sample path is used as the name of the object field.
+ */
+class AstarteDatastreamAggregation {
+ public:
+  /**
+   * @brief Constructor for the AstarteDatastreamAggregation class.
+   * @param object_interface_name The object aggregated interface the objects are sent to.
+   * @param window The time a window stays open after its first sample, before being sent.
+   */
+  AstarteDatastreamAggregation(std::string object_interface_name,
+                               std::chrono::milliseconds window);
+  /**
+   * @brief Set the fields making up a complete object.
+   * @details A window is sent as soon as all the fields have been received, without waiting for its
+   * expiry. Without fields, windows are only sent on expiry.
+   * @param fields The names of the fields, without leading slash.
+   * @return A reference to this aggregation.
+   */
+  auto with_fields(std::vector<std::string> fields) -> AstarteDatastreamAggregation&;
+  /**
+   * @brief Get the object aggregated interface the objects are sent to.
+   * @return The interface name.
+   */
+  [[nodiscard]] auto get_object_interface_name() const -> const std::string&;
+  /**
+   * @brief Get the duration of the time window.
+   * @return The duration of the window.
+   */
+  [[nodiscard]] auto get_window() const -> std::chrono::milliseconds;
+  /**
+   * @brief Get the fields making up a complete object.
+   * @return The field names, empty if windows are only sent on expiry.
+   */
+  [[nodiscard]] auto get_fields() const -> const std::vector<std::string>&;
+
+ private:
+  std::string object_interface_name_;
+  std::chrono::milliseconds window_;
+  std::vector<std::string> fields_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // ASTARTE_DEVICE_SDK_DATASTREAM_AGGREGATION_H
@@ -0,0 +1,99 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef ASTARTE_DEVICE_SDK_DATASTREAM_FILTER_H
+#define ASTARTE_DEVICE_SDK_DATASTREAM_FILTER_H
+
+/**
+ * @file astarte_device_sdk/datastream_filter.hpp
+ * @brief Filters dropping redundant datastream samples before they are sent.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief Filter deciding which samples of a datastream are worth sending.
+ * @details Each sample is compared with the last sample sent on the same path. Numeric values
+ * (integer, long integer and double) are compared against the deadband of the filter, while all
+ * the other types are only sent when their value changes. A maximum silence can be added, so that a
+ * sample is always sent when nothing has been sent for that long.
+ */
+class AstarteDatastreamFilter {
+ public:
+  /** @brief Kind of comparison performed on the numeric values. */
+  enum class Kind : uint8_t {
+    /** @brief Send when the value changes. */
+    kChangeOnly,
+    /** @brief Send when the value differs from the last one by more than a fixed amount. */
+    kAbsoluteDeadband,
+    /** @brief Send when the value differs from the last one by more than a fraction of it. */
+    kRelativeDeadband
+  };
+
+  /**
+   * @brief Create a filter sending only the samples whose value changed.
+   * @return The filter.
+   */
+  static auto change_only() -> AstarteDatastreamFilter;
+  /**
+   * @brief Create a filter with an absolute deadband.
+   * @param threshold The minimum difference from the last sent value for a sample to be sent.
+   * @return The filter.
+   */
+  static auto absolute_deadband(double threshold) -> AstarteDatastreamFilter;
+  /**
+   * @brief Create a filter with a relative deadband.
+   * @param ratio The minimum difference from the last sent value, as a fraction of the last sent
+   * value, for a sample to be sent.
+   * @return The filter.
+   */
+  static auto relative_deadband(double ratio) -> AstarteDatastreamFilter;
+  /**
+   * @brief Set the maximum silence of the filter.
+   * @param max_silence A sample is always sent when no sample has been sent for this long.
+   * @return A reference to this filter.
+   */
+  auto with_max_silence(std::chrono::milliseconds max_silence) -> AstarteDatastreamFilter&;
+  /**
+   * @brief Get the kind of the filter.
+   * @return The kind of the filter.
+   */
+  [[nodiscard]] auto get_kind() const -> Kind;
+  /**
+   * @brief Get the threshold of the filter.
+   * @return The absolute threshold or the ratio of the deadband, zero for change only filters.
+   */
+  [[nodiscard]] auto get_threshold() const -> double;
+  /**
+   * @brief Get the maximum silence of the filter.
+   * @return The maximum silence, std::nullopt if not set.
+   */
+  [[nodiscard]] auto get_max_silence() const -> const std::optional<std::chrono::milliseconds>&;
+
+ private:
+  AstarteDatastreamFilter(Kind kind, double threshold);
+
+  Kind kind_;
+  double threshold_;
+  std::optional<std::chrono::milliseconds> max_silence_;
+};
+
+/**
+ * @brief Counters of the samples processed by the datastream filters.
+ * @details Only the samples on paths with a filter are counted.
+ */
+struct AstarteDatastreamFilterStats {
+  /** @brief Number of samples dropped by the filters. */
+  uint64_t filtered{0};
+  /** @brief Number of samples that passed the filters and were sent. */
+  uint64_t sent{0};
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // ASTARTE_DEVICE_SDK_DATASTREAM_FILTER_H
@@ -11,19 +11,34 @@
  */
 
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
+#include <functional>
 #include <list>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
+#include <vector>
 
+#include "astarte_device_sdk/awaitable.hpp"
+#include "astarte_device_sdk/compression.hpp"
 #include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/datastream_aggregation.hpp"
+#include "astarte_device_sdk/datastream_filter.hpp"
 #include "astarte_device_sdk/device.hpp"
+#include "astarte_device_sdk/executor.hpp"
+#include "astarte_device_sdk/hub_connection.hpp"
 #include "astarte_device_sdk/msg.hpp"
 #include "astarte_device_sdk/object.hpp"
 #include "astarte_device_sdk/ownership.hpp"
 #include "astarte_device_sdk/property.hpp"
+#include "astarte_device_sdk/property_update.hpp"
+#include "astarte_device_sdk/rate_limit.hpp"
+#include "astarte_device_sdk/rpc_stats.hpp"
+#include "astarte_device_sdk/send_priority.hpp"
 #include "astarte_device_sdk/stored_property.hpp"
 
 /** @brief Umbrella namespace for the Astarte device SDK */
@@ -41,6 +56,25 @@ class AstarteDeviceGRPC : public AstarteDevice {
    * @param node_uuid The UUID identifier for this device with the Astarte message hub.
    */
   AstarteDeviceGRPC(const std::string& server_addr, const std::string& node_uuid);
+  /**
+   * @brief Constructor for the Astarte device class with compression.
+   * @details To share a compressed connection between multiple devices, pass the compression
+   * settings to the AstarteHubConnection instead.
+   * @param server_addr The gRPC server address of the Astarte message hub.
+   * @param node_uuid The UUID identifier for this device with the Astarte message hub.
+   * @param compression The compression of the messages sent to the message hub.
+   */
+  AstarteDeviceGRPC(const std::string& server_addr, const std::string& node_uuid,
+                    const AstarteCompression& compression);
+  /**
+   * @brief Constructor for the Astarte device class using a shared hub connection.
+   * @details Multiple devices can be constructed over the same connection, each one with its own
+   * node UUID. All of them will share the same gRPC channel toward the message hub.
+   * @param hub_connection The connection to the Astarte message hub.
+   * @param node_uuid The UUID identifier for this device with the Astarte message hub.
+   */
+  AstarteDeviceGRPC(const std::shared_ptr<AstarteHubConnection>& hub_connection,
+                    const std::string& node_uuid);
   /** @brief Destructor for the Astarte device class. */
   ~AstarteDeviceGRPC() override;
   /** @brief Copy constructor for the Astarte device class. */
@@ -69,8 +103,8 @@ class AstarteDeviceGRPC : public AstarteDevice {
   void remove_interface(const std::string& interface_name) override;
   /**
    * @brief Connect the device to Astarte.
-   * @details This is an asynchronous funciton. It will start a management thread that will
-   * manage the device connectivity.
+   * @details This is an asynchronous funciton. The device connectivity is managed in the
+   * background by the gRPC callbacks, no dedicated thread is spawned.
    */
   void connect() override;
   /**
@@ -101,8 +135,47 @@ class AstarteDeviceGRPC : public AstarteDevice {
   void send_object(std::string_view interface_name, std::string_view path,
                    const AstarteDatastreamObject& object,
                    const std::chrono::system_clock::time_point* timestamp) override;
+  /**
+   * @brief Send a series of samples of an integer datastream.
+   * @details The columns are converted in a single pass directly to the message hub format,
+   * without building an AstarteData for each sample. The samples are then sent concurrently, as
+   * for set_properties, and the function returns once all of them have been acknowledged. An
+   * exception is thrown if the columns differ in size or if any sample has been rejected.
+   * Datastream filters and aggregations are not applied to series.
+   * @param interface_name The name of the interface on which to send the data.
+   * @param path The path to the interface endpoint to use for sending.
+   * @param values The values of the samples.
+   * @param timestamps The timestamp of each sample, with the same size as the values.
+   */
+  void send_series(std::string_view interface_name, std::string_view path,
+                   std::span<const int32_t> values,
+                   std::span<const std::chrono::system_clock::time_point> timestamps);
+  /**
+   * @brief Send a series of samples of a long integer datastream.
+   * @details See the integer overload.
+   * @param interface_name The name of the interface on which to send the data.
+   * @param path The path to the interface endpoint to use for sending.
+   * @param values The values of the samples.
+   * @param timestamps The timestamp of each sample, with the same size as the values.
+   */
+  void send_series(std::string_view interface_name, std::string_view path,
+                   std::span<const int64_t> values,
+                   std::span<const std::chrono::system_clock::time_point> timestamps);
+  /**
+   * @brief Send a series of samples of a double datastream.
+   * @details See the integer overload.
+   * @param interface_name The name of the interface on which to send the data.
+   * @param path The path to the interface endpoint to use for sending.
+   * @param values The values of the samples.
+   * @param timestamps The timestamp of each sample, with the same size as the values.
+   */
+  void send_series(std::string_view interface_name, std::string_view path,
+                   std::span<const double> values,
+                   std::span<const std::chrono::system_clock::time_point> timestamps);
   /**
    * @brief Set a device property.
+   * @details Properties are never deferred by the rate limits, kDefer waits as kBlock so that the
+   * updates of a property reach the message hub in order.
    * @param interface_name The name of the interface for the property.
    * @param path The property full path.
    * @param data The property data.
@@ -115,6 +188,30 @@ class AstarteDeviceGRPC : public AstarteDevice {
    * @param path The property full path.
    */
   void unset_property(std::string_view interface_name, std::string_view path) override;
+  /**
+   * @brief Set or unset many device properties.
+   * @details All the updates are converted in a single pass, then sent to the message hub
+   * concurrently instead of waiting for each acknowledgment in turn. Updates of the same property
+   * are always sent in order. Each update is checked against the rate limits: the dropped ones are
+   * reported as failed, while the others are started once their limits allow. Updates exceeding a
+   * kDefer limit are not deferred, they are waited for as with kBlock, since a deferred update
+   * could reach the message hub after a newer value of the same property and overwrite it.
+   * Bulk property operations are refused in manual drive mode, as they wait for the concurrent
+   * sends to complete.
+   * @param updates The property updates.
+   * @return The status of each update, in the same order as the updates.
+   */
+  auto set_properties(std::span<const AstartePropertyUpdate> updates)
+      -> std::vector<AstartePropertyUpdateStatus>;
+  /**
+   * @brief Unset many device properties of an interface.
+   * @details The unsets are sent concurrently, as for set_properties.
+   * @param interface_name The name of the interface for the properties.
+   * @param paths The properties full paths.
+   * @return The status of each unset, in the same order as the paths.
+   */
+  auto unset_properties(std::string_view interface_name, std::span<const std::string> paths)
+      -> std::vector<AstartePropertyUpdateStatus>;
   /**
    * @brief Poll incoming messages.
    * @param timeout Will block for this timeout if no message is present.
@@ -129,6 +226,24 @@ class AstarteDeviceGRPC : public AstarteDevice {
    */
   auto get_all_properties(const std::optional<AstarteOwnership>& ownership)
       -> std::list<AstarteStoredProperty>;
+  /**
+   * @brief Get all stored properties matching the input filter, as a vector.
+   * @details Properties of the same interface share a single copy of the interface name, which
+   * makes this function preferable to get_all_properties for devices with many properties.
+   * @param ownership Optional ownership filter.
+   * @return A vector of stored properties, as returned by the message hub.
+   */
+  auto get_all_properties_vector(const std::optional<AstarteOwnership>& ownership)
+      -> std::vector<AstarteStoredProperty>;
+  /**
+   * @brief Visit all stored properties matching the input filter.
+   * @details The properties are decoded one at a time, without building a container holding all
+   * of them.
+   * @param ownership Optional ownership filter.
+   * @param callback The function called for each stored property.
+   */
+  void for_each_property(const std::optional<AstarteOwnership>& ownership,
+                         const std::function<void(const AstarteStoredProperty&)>& callback);
   /**
    * @brief Get stored properties matching the interface.
    * @param interface_name The name of the interface for the properties.
@@ -143,6 +258,244 @@ class AstarteDeviceGRPC : public AstarteDevice {
    */
   auto get_property(std::string_view interface_name, std::string_view path)
       -> AstartePropertyIndividual;
+  /**
+   * @brief Send individual data to Astarte asynchronously.
+   * @details The operation is performed using the asynchronous gRPC API, no thread is blocked
+   * while waiting for its completion. Errors are thrown when awaiting the result.
+   * @param interface_name The name of the interface on which to send the data.
+   * @param path The path to the interface endpoint to use for sending.
+   * @param data The data to send.
+   * @param timestamp The timestamp for the data, this might be a nullptr.
+   * @return An awaitable completed when the message hub acknowledges the data.
+   */
+  auto async_send_individual(std::string_view interface_name, std::string_view path,
+                             const AstarteData& data,
+                             const std::chrono::system_clock::time_point* timestamp)
+      -> AstarteAwaitable<void>;
+  /**
+   * @brief Send object data to Astarte asynchronously.
+   * @param interface_name The name of the interface on which to send the data.
+   * @param path The common path to the interface endpoint to use for sending.
+   * @param object The data to send.
+   * @param timestamp The timestamp for the data, this might be a nullptr.
+   * @return An awaitable completed when the message hub acknowledges the data.
+   */
+  auto async_send_object(std::string_view interface_name, std::string_view path,
+                         const AstarteDatastreamObject& object,
+                         const std::chrono::system_clock::time_point* timestamp)
+      -> AstarteAwaitable<void>;
+  /**
+   * @brief Set a device property asynchronously.
+   * @param interface_name The name of the interface for the property.
+   * @param path The property full path.
+   * @param data The property data.
+   * @return An awaitable completed when the message hub acknowledges the property.
+   */
+  auto async_set_property(std::string_view interface_name, std::string_view path,
+                          const AstarteData& data) -> AstarteAwaitable<void>;
+  /**
+   * @brief Unset a device property asynchronously.
+   * @param interface_name The name of the interface for the property.
+   * @param path The property full path.
+   * @return An awaitable completed when the message hub acknowledges the unset.
+   */
+  auto async_unset_property(std::string_view interface_name, std::string_view path)
+      -> AstarteAwaitable<void>;
+  /**
+   * @brief Get all stored properties matching the input filter asynchronously.
+   * @param ownership Optional ownership filter.
+   * @return An awaitable for the list of stored properties, as returned by the message hub.
+   */
+  auto async_get_all_properties(const std::optional<AstarteOwnership>& ownership)
+      -> AstarteAwaitable<std::list<AstarteStoredProperty>>;
+  /**
+   * @brief Get stored properties matching the interface asynchronously.
+   * @param interface_name The name of the interface for the properties.
+   * @return An awaitable for the list of stored properties, as returned by the message hub.
+   */
+  auto async_get_properties(std::string_view interface_name)
+      -> AstarteAwaitable<std::list<AstarteStoredProperty>>;
+  /**
+   * @brief Get a single stored property matching the interface name and path asynchronously.
+   * @param interface_name The name of the interface for the property.
+   * @param path Exact path for the property.
+   * @return An awaitable for the stored property, as returned by the message hub.
+   */
+  auto async_get_property(std::string_view interface_name, std::string_view path)
+      -> AstarteAwaitable<AstartePropertyIndividual>;
+  /**
+   * @brief Wait asynchronously for the next received message.
+   * @details Messages are delivered to the awaiting coroutines in the order of the calls to this
+   * function, and are queued for poll_incoming() only when no coroutine is waiting. An awaitable
+   * destroyed without being awaited gives up its place and receives no message.
+   * @return An awaitable for the received message.
+   */
+  auto next_message() -> AstarteAwaitable<AstarteMessage>;
+  /**
+   * @brief Enable or disable the manual drive mode.
+   * @details In manual drive mode the device does not rely on any background thread. The
+   * connection state machine, the reception of events and the transmission of data are advanced
+   * only when the application calls run_once() or process_events(). The send functions only
+   * enqueue the data, which will be transmitted by the next call to run_once(). Transmission errors
+   * are logged instead of being thrown, and data still enqueued on disconnection is discarded.
+   * All the methods of the device should be called from the same thread.
+   * This function must be called while the device is disconnected.
+   * @param enabled True to enable the manual drive mode, false to disable it.
+   */
+  void set_manual_drive(bool enabled);
+  /**
+   * @brief Enable or disable the device side property cache.
+   * @details When enabled, all the stored properties are fetched from the message hub on each
+   * connection, and then kept up to date with the received server properties and with the
+   * successfully sent device properties. The property getters are then served from the cache, and
+   * perform a call to the message hub only on cache misses.
+   * This function must be called while the device is disconnected.
+   * @param enabled True to enable the property cache, false to disable it.
+   */
+  void set_property_cache(bool enabled);
+  /**
+   * @brief Configure a filter dropping redundant datastream samples.
+   * @details The filter is applied by send_individual, send_object and their coroutine
+   * counterparts, before any conversion or call to the message hub. Dropped samples are reported
+   * as successfully sent. A filter configured for a path takes precedence over the filter of its
+   * interface.
+   * @param interface_name The interface to filter.
+   * @param path The path to filter, an empty path applies the filter to the whole interface.
+   * @param filter The filter.
+   */
+  void set_datastream_filter(std::string_view interface_name, std::string_view path,
+                             const AstarteDatastreamFilter& filter);
+  /**
+   * @brief Remove a datastream filter.
+   * @param interface_name The filtered interface.
+   * @param path The filtered path, empty for a filter on the whole interface.
+   */
+  void remove_datastream_filter(std::string_view interface_name, std::string_view path);
+  /**
+   * @brief Get the counters of the datastream filters.
+   * @return The counters of the filtered and sent samples.
+   */
+  [[nodiscard]] auto get_datastream_filter_stats() const -> AstarteDatastreamFilterStats;
+  /**
+   * @brief Pack the samples of an individual datastream into objects of its aggregated twin.
+   * @details Samples passed to send_individual and async_send_individual are buffered, after the
+   * datastream filters, by interface and common path. Each window is sent as a single object when
+   * all the configured fields have been received, when one of its fields is received again or when
+   * it expires. Expired windows are sent in the background, or by run_once in manual drive mode.
+   * The object carries the timestamp of the first sample of the window, if any.
+   * @param interface_name The individual datastream interface to aggregate.
+   * @param aggregation The aggregation configuration.
+   */
+  void set_datastream_aggregation(std::string_view interface_name,
+                                  const AstarteDatastreamAggregation& aggregation);
+  /**
+   * @brief Remove the aggregation of an interface, sending its open windows.
+   * @param interface_name The aggregated interface.
+   */
+  void remove_datastream_aggregation(std::string_view interface_name);
+  /**
+   * @brief Send all the open aggregation windows without waiting for their expiry.
+   * @details Also performed by disconnect.
+   */
+  void flush_datastream_aggregations();
+  /**
+   * @brief Limit the rate of all the messages sent by the device.
+   * @details Messages are checked against the limits before being sent to the message hub,
+   * including the bulk operations, the series and the aggregated objects. The asynchronous sends
+   * never block, with kBlock and kDefer their awaitable completes once the message is sent. In
+   * manual drive mode the messages over the limit stay queued, in order, until run_once can send
+   * them, unless they are dropped.
+   * @param limit The limit.
+   */
+  void set_rate_limit(const AstarteRateLimit& limit);
+  /** @brief Remove the limit on the rate of all the messages sent by the device. */
+  void remove_rate_limit();
+  /**
+   * @brief Limit the rate of the messages sent on an interface.
+   * @details The messages must fit both the interface and the device limits, each applying its own
+   * over limit behavior.
+   * @param interface_name The interface name.
+   * @param limit The limit.
+   */
+  void set_interface_rate_limit(std::string_view interface_name, const AstarteRateLimit& limit);
+  /**
+   * @brief Remove the limit on the rate of the messages sent on an interface.
+   * @param interface_name The interface name.
+   */
+  void remove_interface_rate_limit(std::string_view interface_name);
+  /**
+   * @brief Get the counters of the messages checked against the rate limits.
+   * @return The counters.
+   */
+  [[nodiscard]] auto get_rate_limit_stats() const -> AstarteRateLimitStats;
+  /**
+   * @brief Override the priority lane of the messages of an interface.
+   * @details Messages are sent on two lanes, each with its own window of concurrent sends, so that
+   * a backlog of bulk datastreams never delays the urgent messages. Properties default to the high
+   * priority lane and datastreams to the normal one. Messages queued in manual drive mode are sent
+   * by run_once in their submission order.
+   * @param interface_name The interface name.
+   * @param priority The priority of its messages.
+   */
+  void set_interface_priority(std::string_view interface_name, AstarteSendPriority priority);
+  /**
+   * @brief Get the counters of a priority lane, including the time spent waiting for a free slot.
+   * @param priority The lane.
+   * @return The counters of the lane.
+   */
+  [[nodiscard]] auto get_send_lane_stats(AstarteSendPriority priority) const
+      -> AstarteSendLaneStats;
+  /**
+   * @brief Enable or disable the statistics of the gRPC calls toward the message hub.
+   * @details The calls are timed from the start to the reception of their status, telling a slow
+   * message hub apart from a slow conversion on the device. The statistics belong to the
+   * connection, and are shared with the other devices using the same AstarteHubConnection.
+   * @param enabled True to collect the statistics of the calls started afterwards.
+   */
+  void set_rpc_stats(bool enabled);
+  /**
+   * @brief Get the statistics of the gRPC calls toward the message hub.
+   * @return The latency, sizes and status codes of each method called while enabled.
+   */
+  [[nodiscard]] auto get_rpc_stats() const -> std::vector<AstarteRpcStats>;
+  /**
+   * @brief Enable or disable the suppression of redundant property sends.
+   * @details When enabled, the device remembers the last value successfully sent for each device
+   * property, and set_property returns without contacting the message hub when called with the
+   * same value. The remembered values are dropped when the property is unset and on each
+   * disconnection.
+   * @param enabled True to enable the suppression, false to disable it.
+   */
+  void set_property_dedup(bool enabled);
+  /**
+   * @brief Get the number of property sends suppressed as redundant.
+   * @return The number of suppressed sends since the device creation.
+   */
+  [[nodiscard]] auto get_suppressed_property_sends() const -> uint64_t;
+  /**
+   * @brief Set the executor used to run the background tasks of the device.
+   * @details By default the background tasks, such as the parsing of the received events and the
+   * reconnection attempts, are run on the gRPC callback threads. The same executor can be shared by
+   * multiple devices. The executor is not used in manual drive mode.
+   * This function must be called while the device is disconnected.
+   * @param executor The executor, nullptr to restore the default behaviour.
+   */
+  void set_executor(std::shared_ptr<AstarteExecutor> executor);
+  /**
+   * @brief Advance the device when in manual drive mode.
+   * @details Performs pending reconnections and sends, then handles the completed gRPC operations.
+   * Waits up to the budget for the first completion, following completions are handled only if
+   * already available.
+   * @param budget The maximum time spent in this call.
+   * @return The number of completed gRPC operations that have been handled.
+   */
+  auto run_once(const std::chrono::milliseconds& budget) -> std::size_t;
+  /**
+   * @brief Advance the device when in manual drive mode, without blocking.
+   * @details Equivalent to run_once() with a zero budget.
+   * @return The number of completed gRPC operations that have been handled.
+   */
+  auto process_events() -> std::size_t;
 
  private:
   struct AstarteDeviceGRPCImpl;
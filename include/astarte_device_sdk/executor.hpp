@@ -0,0 +1,96 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef ASTARTE_DEVICE_SDK_EXECUTOR_H
+#define ASTARTE_DEVICE_SDK_EXECUTOR_H
+
+/**
+ * @file astarte_device_sdk/executor.hpp
+ * @brief Executors used by the Astarte device to run its background work.
+ */
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+/** @brief Umbrella namespace for the Astarte device SDK */
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief Interface for the executors running the background work of the Astarte devices.
+ * @details Implement this interface to run the device background tasks on an existing thread pool
+ * or event loop, such as an Asio io_context or a Qt event loop.
+ */
+class AstarteExecutor {
+ public:
+  /** @brief Default constructor for the Astarte executor class. */
+  AstarteExecutor() = default;
+  /** @brief Destructor for the Astarte executor class. */
+  virtual ~AstarteExecutor() = default;
+  /** @brief Copy constructor for the Astarte executor class. */
+  AstarteExecutor(const AstarteExecutor& other) = delete;
+  /** @brief Move constructor for the Astarte executor class. */
+  AstarteExecutor(AstarteExecutor&& other) = delete;
+  /** @brief Copy assignment operator for the Astarte executor class. */
+  auto operator=(const AstarteExecutor& other) -> AstarteExecutor& = delete;
+  /** @brief Move assignment operator for the Astarte executor class. */
+  auto operator=(AstarteExecutor&& other) -> AstarteExecutor& = delete;
+
+  /**
+   * @brief Schedule a task for execution.
+   * @details This function may be called concurrently from multiple threads and should not block.
+   * Each task must be run exactly once, on any thread. The device guarantees by itself the ordering
+   * of the tasks that depend on each other.
+   * @param task The task to run.
+   */
+  virtual void post(std::function<void()> task) = 0;
+};
+
+/**
+ * @brief Executor running the tasks on a pool of threads using work stealing.
+ * @details Each thread of the pool owns a queue of tasks. Tasks posted from a pool thread are
+ * queued on the queue of that thread, other tasks are distributed round robin. Idle threads steal
+ * the oldest tasks from the queues of the other threads.
+ */
+class AstarteWorkStealingExecutor : public AstarteExecutor {
+ public:
+  /**
+   * @brief Constructor for the work stealing executor class.
+   * @param num_threads The number of threads of the pool. When zero, the number of concurrent
+   * threads supported by the hardware is used.
+   */
+  explicit AstarteWorkStealingExecutor(std::size_t num_threads = 0);
+  /**
+   * @brief Destructor for the work stealing executor class.
+   * @details Runs all the pending tasks and then joins the threads of the pool.
+   */
+  ~AstarteWorkStealingExecutor() override;
+  /** @brief Copy constructor for the work stealing executor class. */
+  AstarteWorkStealingExecutor(const AstarteWorkStealingExecutor& other) = delete;
+  /** @brief Move constructor for the work stealing executor class. */
+  AstarteWorkStealingExecutor(AstarteWorkStealingExecutor&& other) = delete;
+  /** @brief Copy assignment operator for the work stealing executor class. */
+  auto operator=(const AstarteWorkStealingExecutor& other) -> AstarteWorkStealingExecutor& = delete;
+  /** @brief Move assignment operator for the work stealing executor class. */
+  auto operator=(AstarteWorkStealingExecutor&& other) -> AstarteWorkStealingExecutor& = delete;
+
+  /**
+   * @brief Schedule a task for execution on the pool.
+   * @param task The task to run.
+   */
+  void post(std::function<void()> task) override;
+  /**
+   * @brief Get the number of threads of the pool.
+   * @return The number of threads of the pool.
+   */
+  [[nodiscard]] auto get_num_threads() const -> std::size_t;
+
+ private:
+  struct AstarteWorkStealingExecutorImpl;
+  std::shared_ptr<AstarteWorkStealingExecutorImpl> executor_impl_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // ASTARTE_DEVICE_SDK_EXECUTOR_H
@@ -21,6 +21,7 @@
 #define ASTARTE_NS_FORMAT fmt
 #endif  // (__cplusplus >= 202002L) && (__has_include(<format>))
 
+#include "astarte_device_sdk/base64.hpp"
 #include "astarte_device_sdk/individual.hpp"
 #include "astarte_device_sdk/msg.hpp"
 #include "astarte_device_sdk/object.hpp"
@@ -35,7 +36,6 @@
 namespace utils {
 // These functions are only used for pretty printing
 // NOLINTBEGIN(concurrency-mt-unsafe)
-// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
 /**
  * @brief Format a vector of bytes into a Base64 string literal.
  * @tparam OutputIt The type of the output iterator.
@@ -44,42 +44,11 @@ namespace utils {
  */
 template <typename OutputIt>
 void format_base64(OutputIt& out, const std::vector<uint8_t>& data) {
-  static constexpr std::string_view base64_chars =
-      "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-      "abcdefghijklmnopqrstuvwxyz"
-      "0123456789+/";
-
-  size_t idx = 0;
-  const size_t len = data.size();
-
-  out = ASTARTE_NS_FORMAT::format_to(out, "\"");
-
-  while (idx + 2 < len) {
-    const uint32_t chunk = (data[idx] << 16) | (data[idx + 1] << 8) | data[idx + 2];
-    out = ASTARTE_NS_FORMAT::format_to(
-        out, "{}{}{}{}", base64_chars[(chunk >> 18) & 0x3F], base64_chars[(chunk >> 12) & 0x3F],
-        base64_chars[(chunk >> 6) & 0x3F], base64_chars[chunk & 0x3F]);
-    idx += 3;
-  }
-
-  if (idx < len) {
-    uint32_t chunk = data[idx] << 16;
-    if (idx + 1 < len) {
-      chunk |= data[idx + 1] << 8;
-    }
-
-    out = ASTARTE_NS_FORMAT::format_to(out, "{}{}", base64_chars[(chunk >> 18) & 0x3F],
-                                       base64_chars[(chunk >> 12) & 0x3F]);
-    if (idx + 1 < len) {
-      out = ASTARTE_NS_FORMAT::format_to(out, "{}=", base64_chars[(chunk >> 6) & 0x3F]);
-    } else {
-      out = ASTARTE_NS_FORMAT::format_to(out, "==");
-    }
-  }
-
-  out = ASTARTE_NS_FORMAT::format_to(out, "\"");
+  std::string encoded = "\"";
+  AstarteDeviceSdk::base64_encode(data, encoded);
+  encoded += '"';
+  out = ASTARTE_NS_FORMAT::format_to(out, "{}", encoded);
 }
-// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
 
 /**
  * @brief Format a timestamp into an ISO 8601 string literal.
@@ -0,0 +1,87 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef ASTARTE_DEVICE_SDK_HUB_CONNECTION_H
+#define ASTARTE_DEVICE_SDK_HUB_CONNECTION_H
+
+/**
+ * @file astarte_device_sdk/hub_connection.hpp
+ * @brief Connection to the Astarte message hub, shareable between multiple devices.
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "astarte_device_sdk/compression.hpp"
+#include "astarte_device_sdk/rpc_stats.hpp"
+
+/** @brief Umbrella namespace for the Astarte device SDK */
+namespace AstarteDeviceSdk {
+
+class AstarteDeviceGRPC;
+
+/**
+ * @brief Connection to an Astarte message hub.
+ * @details A single instance of this class owns a single gRPC channel toward the message hub.
+ * Multiple AstarteDeviceGRPC instances, each one with its own node UUID, can be multiplexed over
+ * the same connection. This keeps the number of sockets constant regardless of the number of
+ * nodes served by a single process.
+ */
+class AstarteHubConnection {
+ public:
+  /**
+   * @brief Constructor for the Astarte hub connection class.
+   * @param server_addr The gRPC server address of the Astarte message hub.
+   */
+  explicit AstarteHubConnection(const std::string& server_addr);
+  /**
+   * @brief Constructor for the Astarte hub connection class with compression.
+   * @param server_addr The gRPC server address of the Astarte message hub.
+   * @param compression The compression of the messages sent over the connection.
+   */
+  AstarteHubConnection(const std::string& server_addr, const AstarteCompression& compression);
+  /** @brief Destructor for the Astarte hub connection class. */
+  ~AstarteHubConnection();
+  /** @brief Copy constructor for the Astarte hub connection class. */
+  AstarteHubConnection(AstarteHubConnection& other) = delete;
+  /** @brief Move constructor for the Astarte hub connection class. */
+  AstarteHubConnection(AstarteHubConnection&& other) = delete;
+  /** @brief Copy assignment operator for the Astarte hub connection class. */
+  auto operator=(AstarteHubConnection& other) -> AstarteHubConnection& = delete;
+  /** @brief Move assignment operator for the Astarte hub connection class. */
+  auto operator=(AstarteHubConnection&& other) -> AstarteHubConnection& = delete;
+
+  /**
+   * @brief Get the address of the Astarte message hub.
+   * @return The gRPC server address of the Astarte message hub.
+   */
+  [[nodiscard]] auto get_server_addr() const -> const std::string&;
+  /**
+   * @brief Get the compression settings of the connection.
+   * @return The compression of the messages sent over the connection.
+   */
+  [[nodiscard]] auto get_compression() const -> const AstarteCompression&;
+  /**
+   * @brief Enable or disable the statistics of the gRPC calls over the connection.
+   * @details When enabled, an interceptor times each call and counts its messages, bytes and
+   * status codes. The calls started while disabled are not intercepted and cost nothing.
+   * @param enabled True to collect the statistics of the calls started afterwards.
+   */
+  void set_rpc_stats(bool enabled);
+  /**
+   * @brief Get the statistics of the gRPC calls over the connection.
+   * @return The statistics of each method called while enabled, ordered by method name.
+   */
+  [[nodiscard]] auto get_rpc_stats() const -> std::vector<AstarteRpcStats>;
+
+ private:
+  friend class AstarteDeviceGRPC;
+  struct AstarteHubConnectionImpl;
+  std::shared_ptr<AstarteHubConnectionImpl> hub_connection_impl_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // ASTARTE_DEVICE_SDK_HUB_CONNECTION_H
@@ -0,0 +1,93 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef ASTARTE_DEVICE_SDK_JSON_H
+#define ASTARTE_DEVICE_SDK_JSON_H
+
+/**
+ * @file astarte_device_sdk/json.hpp
+ * @brief Serialization of the Astarte data types to JSON.
+ */
+
+#include <string>
+#include <string_view>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/individual.hpp"
+#include "astarte_device_sdk/msg.hpp"
+#include "astarte_device_sdk/object.hpp"
+#include "astarte_device_sdk/property.hpp"
+#include "astarte_device_sdk/stored_property.hpp"
+
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief Streaming JSON writer for the Astarte data types.
+ * @details Appends compact JSON to an internal buffer, which is kept across clear calls so that
+ * serializing many values doesn't allocate. Binary blobs are written as base64 strings, date-times
+ * as ISO 8601 strings with milliseconds in UTC, and non finite doubles as null.
+ */
+class AstarteJsonWriter {
+ public:
+  /**
+   * @brief Remove the written JSON, keeping the buffer for the next values.
+   */
+  void clear();
+  /**
+   * @brief Get the JSON written since the last clear.
+   * @return The JSON text, valid until the writer is modified.
+   */
+  [[nodiscard]] auto view() const -> std::string_view;
+  /**
+   * @brief Write a value.
+   * @param data The value to write.
+   */
+  void write(const AstarteData& data);
+  /**
+   * @brief Write the value of an individual datastream.
+   * @param data The datastream to write.
+   */
+  void write(const AstarteDatastreamIndividual& data);
+  /**
+   * @brief Write an object datastream as a JSON object.
+   * @param data The object to write.
+   */
+  void write(const AstarteDatastreamObject& data);
+  /**
+   * @brief Write the value of a property, null if it's unset.
+   * @param data The property to write.
+   */
+  void write(const AstartePropertyIndividual& data);
+  /**
+   * @brief Write a message as a JSON object with its interface, path and value.
+   * @param msg The message to write.
+   */
+  void write(const AstarteMessage& msg);
+  /**
+   * @brief Write a stored property as a JSON object with its interface, major version, path,
+   * ownership and value.
+   * @param prop The property to write.
+   */
+  void write(const AstarteStoredProperty& prop);
+
+ private:
+  std::string buffer_;
+};
+
+/**
+ * @brief Serialize a value to JSON.
+ * @details Creates a new string for each call, use AstarteJsonWriter to serialize many values.
+ * @param value The value to serialize.
+ * @return The JSON text.
+ */
+template <typename T>
+auto to_json(const T& value) -> std::string {
+  AstarteJsonWriter writer;
+  writer.write(value);
+  return std::string(writer.view());
+}
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // ASTARTE_DEVICE_SDK_JSON_H
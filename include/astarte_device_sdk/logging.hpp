@@ -0,0 +1,62 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef ASTARTE_DEVICE_SDK_LOGGING_H
+#define ASTARTE_DEVICE_SDK_LOGGING_H
+
+/**
+ * @file astarte_device_sdk/logging.hpp
+ * @brief Configuration of the logs of the library.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+
+namespace AstarteDeviceSdk {
+
+/** @brief Severity of a log line of the library. */
+enum class AstarteLogLevel : uint8_t {
+  /** @brief Detailed tracing of the data exchanged with the message hub. */
+  kTrace,
+  /** @brief Diagnostic information on the calls of the device. */
+  kDebug,
+  /** @brief Connection state changes. */
+  kInfo,
+  /** @brief Recoverable failures, such as rejected calls or dropped messages. */
+  kWarn,
+  /** @brief Failures reported by the message hub. */
+  kError,
+  /** @brief Unrecoverable failures. */
+  kCritical
+};
+
+/**
+ * @brief Callback receiving the log lines of the library.
+ * @details Called on the logging thread of the library, one line at a time.
+ */
+using AstarteLogCallback = std::function<void(AstarteLogLevel level, std::string_view message)>;
+
+/** @brief Maximum number of log lines waiting for the logging thread, newer ones are dropped. */
+constexpr std::size_t ASTARTE_LOG_QUEUE_CAPACITY = 8192;
+
+/**
+ * @brief Deliver the log lines of the library to a callback.
+ * @details The logs are shared by all the devices of the process. The calls of the devices only
+ * queue the lines, which are delivered by a dedicated thread, so neither the callback nor a slow
+ * standard output ever block a device. The log level is still set with spdlog::set_level.
+ * @param callback The callback receiving the lines, empty to print them on the standard output.
+ */
+void set_log_callback(AstarteLogCallback callback);
+
+/**
+ * @brief Get the number of log lines dropped because the logging thread was behind.
+ * @return The number of lines dropped since the start of the process.
+ */
+auto get_dropped_log_count() -> uint64_t;
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // ASTARTE_DEVICE_SDK_LOGGING_H
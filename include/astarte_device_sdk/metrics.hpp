@@ -0,0 +1,95 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef ASTARTE_DEVICE_SDK_METRICS_H
+#define ASTARTE_DEVICE_SDK_METRICS_H
+
+/**
+ * @file astarte_device_sdk/metrics.hpp
+ * @brief Metrics collected by the library, and their Prometheus text exposition.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace AstarteDeviceSdk {
+
+/** @brief Value of a counter metric. */
+struct AstarteCounterMetric {
+  /** @brief Name of the metric. */
+  std::string name;
+  /** @brief Description of the metric. */
+  std::string help;
+  /** @brief Number of events counted since the start of the process. */
+  uint64_t value{0};
+};
+
+/** @brief Value of a gauge metric. */
+struct AstarteGaugeMetric {
+  /** @brief Name of the metric. */
+  std::string name;
+  /** @brief Description of the metric. */
+  std::string help;
+  /** @brief Current value. */
+  int64_t value{0};
+};
+
+/**
+ * @brief Distribution of a latency metric.
+ * @details Buckets grow exponentially, each power of two being split in four buckets, so that the
+ * relative error of a percentile is below 25%.
+ */
+struct AstarteHistogramMetric {
+  /** @brief Name of the metric. */
+  std::string name;
+  /** @brief Description of the metric. */
+  std::string help;
+  /** @brief Number of samples. */
+  uint64_t count{0};
+  /** @brief Sum of all the samples. */
+  std::chrono::nanoseconds sum{0};
+  /** @brief Upper bound and number of samples of each bucket, ordered by bound. */
+  std::vector<std::pair<std::chrono::nanoseconds, uint64_t>> buckets;
+
+  /**
+   * @brief Estimate a percentile of the distribution.
+   * @param quantile The quantile, between 0 and 1.
+   * @return The upper bound of the bucket holding the percentile, zero without samples.
+   */
+  [[nodiscard]] auto percentile(double quantile) const -> std::chrono::nanoseconds;
+};
+
+/**
+ * @brief Values of all the metrics of the library.
+ * @details Metrics are shared by all the devices of the process.
+ */
+struct AstarteMetricsSnapshot {
+  /** @brief Counters, ordered by name. */
+  std::vector<AstarteCounterMetric> counters;
+  /** @brief Gauges, ordered by name. */
+  std::vector<AstarteGaugeMetric> gauges;
+  /** @brief Latency histograms, ordered by name. */
+  std::vector<AstarteHistogramMetric> histograms;
+};
+
+/**
+ * @brief Read the current value of all the metrics of the library.
+ * @return The snapshot of the metrics.
+ */
+auto get_metrics_snapshot() -> AstarteMetricsSnapshot;
+
+/**
+ * @brief Serialize metrics in the Prometheus text exposition format.
+ * @details Latencies are exported in seconds, with a bucket for each power of two.
+ * @param snapshot The metrics to serialize.
+ * @return The text, ready to be served on a metrics endpoint.
+ */
+auto to_prometheus_text(const AstarteMetricsSnapshot& snapshot) -> std::string;
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // ASTARTE_DEVICE_SDK_METRICS_H
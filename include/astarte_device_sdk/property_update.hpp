@@ -0,0 +1,88 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef ASTARTE_DEVICE_SDK_PROPERTY_UPDATE_H
+#define ASTARTE_DEVICE_SDK_PROPERTY_UPDATE_H
+
+/**
+ * @file astarte_device_sdk/property_update.hpp
+ * @brief Astarte property update classes, used by the bulk property operations.
+ */
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "astarte_device_sdk/data.hpp"
+
+namespace AstarteDeviceSdk {
+
+/** @brief A single set or unset of a device property, part of a bulk property operation. */
+class AstartePropertyUpdate {
+ public:
+  /**
+   * @brief Constructor for the AstartePropertyUpdate class, setting a property.
+   * @param interface_name The name of the interface for the property.
+   * @param path The property full path.
+   * @param data The property data.
+   */
+  explicit AstartePropertyUpdate(std::string_view interface_name, std::string_view path,
+                                 AstarteData data);
+  /**
+   * @brief Constructor for the AstartePropertyUpdate class, unsetting a property.
+   * @param interface_name The name of the interface for the property.
+   * @param path The property full path.
+   */
+  explicit AstartePropertyUpdate(std::string_view interface_name, std::string_view path);
+  /**
+   * @brief Get the interface name of the property.
+   * @return The interface name.
+   */
+  [[nodiscard]] auto get_interface_name() const -> const std::string&;
+  /**
+   * @brief Get the path of the property.
+   * @return The property path.
+   */
+  [[nodiscard]] auto get_path() const -> const std::string&;
+  /**
+   * @brief Get the new value of the property.
+   * @return The property data, std::nullopt when the property is unset.
+   */
+  [[nodiscard]] auto get_value() const -> const std::optional<AstarteData>&;
+
+ private:
+  std::string interface_name_;
+  std::string path_;
+  std::optional<AstarteData> data_;
+};
+
+/** @brief Outcome of a single update of a bulk property operation. */
+class AstartePropertyUpdateStatus {
+ public:
+  /** @brief Constructor for a successful AstartePropertyUpdateStatus. */
+  AstartePropertyUpdateStatus() = default;
+  /**
+   * @brief Constructor for a failed AstartePropertyUpdateStatus.
+   * @param error The description of the error.
+   */
+  explicit AstartePropertyUpdateStatus(std::string_view error);
+  /**
+   * @brief Check if the update has been acknowledged by the message hub.
+   * @return True if the update succeeded, false otherwise.
+   */
+  [[nodiscard]] auto is_ok() const -> bool;
+  /**
+   * @brief Get the description of the error of a failed update.
+   * @return The error description, empty for successful updates.
+   */
+  [[nodiscard]] auto get_error() const -> const std::string&;
+
+ private:
+  bool ok_{true};
+  std::string error_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // ASTARTE_DEVICE_SDK_PROPERTY_UPDATE_H
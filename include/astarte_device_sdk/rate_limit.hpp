@@ -0,0 +1,105 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef ASTARTE_DEVICE_SDK_RATE_LIMIT_H
+#define ASTARTE_DEVICE_SDK_RATE_LIMIT_H
+
+/**
+ * @file astarte_device_sdk/rate_limit.hpp
+ * @brief Limits on the rate of the messages sent by a device.
+ */
+
+#include <cstdint>
+#include <optional>
+
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief Limit on the messages and bytes sent per second.
+ * @details Each rate comes with a burst, the amount that can be sent at once after a period of
+ * inactivity. Messages larger than the byte burst are admitted only when the byte budget is full.
+ */
+class AstarteRateLimit {
+ public:
+  /** @brief Behavior of the sends exceeding the limit. */
+  enum class OverLimit : uint8_t {
+    /** @brief Wait until the message fits in the limit. */
+    kBlock,
+    /** @brief Drop the message, counting it in the statistics. */
+    kDrop,
+    /** @brief Return immediately, the message is sent in the background once it fits the limit. */
+    kDefer
+  };
+
+  /**
+   * @brief Constructor for the AstarteRateLimit class, without any rate.
+   * @param over_limit The behavior of the sends exceeding the limit.
+   */
+  explicit AstarteRateLimit(OverLimit over_limit);
+  /**
+   * @brief Limit the number of messages per second.
+   * @param per_second The sustained rate, in messages per second.
+   * @param burst The number of messages that can be sent at once.
+   * @return A reference to this limit.
+   */
+  auto with_messages(double per_second, uint64_t burst) -> AstarteRateLimit&;
+  /**
+   * @brief Limit the number of bytes per second, measured on the encoded messages.
+   * @param per_second The sustained rate, in bytes per second.
+   * @param burst The number of bytes that can be sent at once.
+   * @return A reference to this limit.
+   */
+  auto with_bytes(double per_second, uint64_t burst) -> AstarteRateLimit&;
+  /**
+   * @brief Get the behavior of the sends exceeding the limit.
+   * @return The behavior of the sends exceeding the limit.
+   */
+  [[nodiscard]] auto get_over_limit() const -> OverLimit;
+  /**
+   * @brief Get the message rate.
+   * @return The messages per second, std::nullopt if not limited.
+   */
+  [[nodiscard]] auto get_messages_per_second() const -> const std::optional<double>&;
+  /**
+   * @brief Get the message burst.
+   * @return The number of messages that can be sent at once.
+   */
+  [[nodiscard]] auto get_message_burst() const -> uint64_t;
+  /**
+   * @brief Get the byte rate.
+   * @return The bytes per second, std::nullopt if not limited.
+   */
+  [[nodiscard]] auto get_bytes_per_second() const -> const std::optional<double>&;
+  /**
+   * @brief Get the byte burst.
+   * @return The number of bytes that can be sent at once.
+   */
+  [[nodiscard]] auto get_byte_burst() const -> uint64_t;
+
+ private:
+  OverLimit over_limit_;
+  std::optional<double> messages_per_second_;
+  uint64_t message_burst_{0};
+  std::optional<double> bytes_per_second_;
+  uint64_t byte_burst_{0};
+};
+
+/**
+ * @brief Counters of the messages checked against the rate limits.
+ * @details Only the messages of rate limited interfaces, or of a rate limited device, are counted.
+ */
+struct AstarteRateLimitStats {
+  /** @brief Number of messages sent right away. */
+  uint64_t admitted{0};
+  /** @brief Number of messages that waited for the limit before being sent. */
+  uint64_t delayed{0};
+  /** @brief Number of messages queued to be sent in the background. */
+  uint64_t deferred{0};
+  /** @brief Number of messages dropped. */
+  uint64_t dropped{0};
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // ASTARTE_DEVICE_SDK_RATE_LIMIT_H
@@ -0,0 +1,50 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef ASTARTE_DEVICE_SDK_RPC_STATS_H
+#define ASTARTE_DEVICE_SDK_RPC_STATS_H
+
+/**
+ * @file astarte_device_sdk/rpc_stats.hpp
+ * @brief Statistics of the gRPC calls toward the Astarte message hub.
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "astarte_device_sdk/metrics.hpp"
+
+namespace AstarteDeviceSdk {
+
+/** @brief Statistics of the calls of a gRPC method of the message hub. */
+struct AstarteRpcStats {
+  /** @brief Number of gRPC status codes, from OK to UNAUTHENTICATED. */
+  static constexpr std::size_t STATUS_CODES = 17;
+
+  /** @brief Full name of the method, such as /astarteplatform.msghub.MessageHub/Send. */
+  std::string method;
+  /** @brief Number of calls started. */
+  uint64_t calls{0};
+  /** @brief Number of messages sent to the message hub. */
+  uint64_t messages_sent{0};
+  /** @brief Encoded size of the messages sent to the message hub, before compression. */
+  uint64_t bytes_sent{0};
+  /** @brief Number of messages received from the message hub. */
+  uint64_t messages_received{0};
+  /** @brief Encoded size of the messages received from the message hub. */
+  uint64_t bytes_received{0};
+  /** @brief Number of completed calls, indexed by gRPC status code. */
+  std::array<uint64_t, STATUS_CODES> status_codes{};
+  /**
+   * @brief Time from the start of the calls to the reception of their status.
+   * @details For the Attach stream, this is the lifetime of the stream.
+   */
+  AstarteHistogramMetric latency;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // ASTARTE_DEVICE_SDK_RPC_STATS_H
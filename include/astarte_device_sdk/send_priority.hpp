@@ -0,0 +1,40 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef ASTARTE_DEVICE_SDK_SEND_PRIORITY_H
+#define ASTARTE_DEVICE_SDK_SEND_PRIORITY_H
+
+/**
+ * @file astarte_device_sdk/send_priority.hpp
+ * @brief Priority classes of the messages sent by a device.
+ */
+
+#include <chrono>
+#include <cstdint>
+
+namespace AstarteDeviceSdk {
+
+/** @brief Priority lane a message is sent on. */
+enum class AstarteSendPriority : uint8_t {
+  /** @brief Urgent messages, the default for properties. */
+  kHigh,
+  /** @brief Regular traffic, the default for datastreams. */
+  kNormal
+};
+
+/** @brief Counters of a priority lane. */
+struct AstarteSendLaneStats {
+  /** @brief Number of messages sent, or whose send has been attempted. */
+  uint64_t sent{0};
+  /** @brief Number of messages currently waiting for a free slot in the lane. */
+  uint64_t queued{0};
+  /** @brief Mean time the messages waited before being sent. */
+  std::chrono::microseconds mean_wait{0};
+  /** @brief Longest time a message waited before being sent. */
+  std::chrono::microseconds max_wait{0};
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // ASTARTE_DEVICE_SDK_SEND_PRIORITY_H
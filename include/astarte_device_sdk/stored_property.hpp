@@ -11,6 +11,7 @@
  */
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <string_view>
 
@@ -33,6 +34,18 @@ class AstarteStoredProperty {
   explicit AstarteStoredProperty(std::string_view interface_name, std::string_view path,
                                  int32_t version_major, AstarteOwnership ownership,
                                  AstarteData data);
+  /**
+   * @brief Constructor for the AstarteStoredProperty class, sharing the interface name.
+   * @details Properties of the same interface can share a single copy of the interface name.
+   * @param interface_name The shared name of the interface of the property.
+   * @param path The path for the property.
+   * @param version_major The major version for the interface of the property.
+   * @param ownership The ownership for the interface of the property.
+   * @param data The Astarte data for the property.
+   */
+  explicit AstarteStoredProperty(std::shared_ptr<const std::string> interface_name,
+                                 std::string_view path, int32_t version_major,
+                                 AstarteOwnership ownership, AstarteData data);
   /**
    * @brief Get the interface name contained within the object.
    * @return A constant reference to the interface name string.
@@ -74,7 +87,7 @@ class AstarteStoredProperty {
   [[nodiscard]] auto operator!=(const AstarteStoredProperty& other) const -> bool;
 
  private:
-  std::string interface_name_;
+  std::shared_ptr<const std::string> interface_name_;
   std::string path_;
   int32_t version_major_;
   AstarteOwnership ownership_;
@@ -0,0 +1,121 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef LOAD_GENERATOR_H
+#define LOAD_GENERATOR_H
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace AstarteDeviceSdk {
+
+/** @brief Kind of traffic generated by each device. */
+enum class LoadKind : uint8_t {
+  /** @brief Individual datastream samples, sent with send_individual. */
+  kIndividual,
+  /** @brief Object datastream samples, sent with send_object. */
+  kObject,
+  /** @brief Device property updates, sent with set_property. */
+  kProperty
+};
+
+/** @brief Number of kinds of traffic. */
+constexpr std::size_t LOAD_KINDS = 3;
+
+/** @brief Configuration of a load generation run. */
+struct LoadGeneratorConfig {
+  /** @brief Address of the message hub, empty to start an in-process fake message hub. */
+  std::string address;
+  /** @brief Number of devices, each one with its own node. */
+  std::size_t devices{10};
+  /** @brief Number of threads driving the devices. */
+  std::size_t threads{4};
+  /** @brief True to multiplex all the devices over a single connection. */
+  bool shared_connection{false};
+  /** @brief Duration of the measurement, once all the devices are connected. */
+  std::chrono::seconds duration{30};
+  /** @brief Maximum time waited for the devices to connect. */
+  std::chrono::seconds connect_timeout{30};
+  /** @brief Target rate of each kind of traffic, in messages per second per device. */
+  std::array<double, LOAD_KINDS> rates{10.0, 1.0, 0.1};
+  /** @brief Latency added to each call by the in-process fake message hub. */
+  std::chrono::microseconds hub_latency{0};
+};
+
+/** @brief Results of a kind of traffic. */
+struct LoadKindReport {
+  /** @brief Target rate of all the devices, in messages per second. */
+  double target_rate{0};
+  /** @brief Achieved rate of all the devices, in messages per second. */
+  double achieved_rate{0};
+  /** @brief Number of messages acknowledged by the message hub. */
+  uint64_t sent{0};
+  /** @brief Number of messages refused by the device or the message hub. */
+  uint64_t errors{0};
+  /** @brief Median duration of the calls. */
+  std::chrono::microseconds p50{0};
+  /** @brief 90th percentile of the duration of the calls. */
+  std::chrono::microseconds p90{0};
+  /** @brief 99th percentile of the duration of the calls. */
+  std::chrono::microseconds p99{0};
+  /** @brief Longest call. */
+  std::chrono::microseconds max{0};
+};
+
+/** @brief Results of a load generation run. */
+struct LoadReport {
+  /** @brief Number of devices created. */
+  std::size_t devices{0};
+  /** @brief Number of devices connected when the measurement started. */
+  std::size_t connected{0};
+  /** @brief Time taken by the devices to connect. */
+  std::chrono::milliseconds connect_time{0};
+  /** @brief Actual duration of the measurement. */
+  std::chrono::duration<double> elapsed{0};
+  /** @brief Results of each kind of traffic, indexed by LoadKind. */
+  std::array<LoadKindReport, LOAD_KINDS> kinds;
+  /** @brief CPU time used by the process during the measurement, in cores. */
+  double cpu_cores{0};
+  /** @brief Resident set size of the process at the end of the measurement. */
+  uint64_t rss_bytes{0};
+  /** @brief Peak resident set size of the process. */
+  uint64_t peak_rss_bytes{0};
+};
+
+/**
+ * @brief Drives many devices at target rates and measures what the process sustains.
+ * @details The devices are created with synthetic interfaces and split among the threads. Each
+ * thread sends on a fixed schedule, without waiting for the late messages to catch up, so that
+ * an achieved rate below the target shows the saturation of the process or of the message hub.
+ */
+class LoadGenerator {
+ public:
+  /**
+   * @brief Constructor for the LoadGenerator class.
+   * @param config The configuration of the run.
+   */
+  explicit LoadGenerator(LoadGeneratorConfig config);
+  /**
+   * @brief Connect the devices, generate the load and disconnect them.
+   * @return The results of the run.
+   */
+  auto run() -> LoadReport;
+
+ private:
+  LoadGeneratorConfig config_;
+};
+
+/**
+ * @brief Get the name of a kind of traffic.
+ * @param kind The kind of traffic.
+ * @return The name of the function generating it.
+ */
+auto load_kind_name(LoadKind kind) -> const char*;
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // LOAD_GENERATOR_H
@@ -0,0 +1,326 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "load_generator.hpp"
+
+#include <spdlog/fmt/fmt.h>
+#include <spdlog/spdlog.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <queue>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/device_grpc.hpp"
+#include "astarte_device_sdk/exceptions.hpp"
+#include "astarte_device_sdk/hub_connection.hpp"
+#include "astarte_device_sdk/object.hpp"
+#include "fake_message_hub.hpp"
+
+namespace AstarteDeviceSdk {
+
+using std::chrono::steady_clock;
+
+namespace {
+
+const char* const INDIVIDUAL_INTERFACE = "org.astarte-platform.loadgen.Individual";
+const char* const OBJECT_INTERFACE = "org.astarte-platform.loadgen.Object";
+const char* const PROPERTY_INTERFACE = "org.astarte-platform.loadgen.Property";
+
+const char* const INDIVIDUAL_JSON = R"({
+  "interface_name": "org.astarte-platform.loadgen.Individual",
+  "version_major": 0,
+  "version_minor": 1,
+  "type": "datastream",
+  "ownership": "device",
+  "mappings": [{"endpoint": "/%{sensor_id}/value", "type": "double"}]
+})";
+
+const char* const OBJECT_JSON = R"({
+  "interface_name": "org.astarte-platform.loadgen.Object",
+  "version_major": 0,
+  "version_minor": 1,
+  "type": "datastream",
+  "aggregation": "object",
+  "ownership": "device",
+  "mappings": [
+    {"endpoint": "/%{sensor_id}/temperature", "type": "double"},
+    {"endpoint": "/%{sensor_id}/humidity", "type": "double"},
+    {"endpoint": "/%{sensor_id}/sequence", "type": "longinteger"}
+  ]
+})";
+
+const char* const PROPERTY_JSON = R"({
+  "interface_name": "org.astarte-platform.loadgen.Property",
+  "version_major": 0,
+  "version_minor": 1,
+  "type": "properties",
+  "ownership": "device",
+  "mappings": [{"endpoint": "/%{sensor_id}/counter", "type": "longinteger"}]
+})";
+
+struct ProcessUsage {
+  std::chrono::microseconds cpu_time{0};
+  uint64_t rss_bytes{0};
+  uint64_t peak_rss_bytes{0};
+};
+
+auto to_microseconds(const timeval& value) -> std::chrono::microseconds {
+  return std::chrono::seconds(value.tv_sec) + std::chrono::microseconds(value.tv_usec);
+}
+
+// The current RSS is only exposed by procfs, it is left to zero elsewhere
+auto read_process_usage() -> ProcessUsage {
+  ProcessUsage usage;
+  rusage resources{};
+  if (getrusage(RUSAGE_SELF, &resources) == 0) {
+    usage.cpu_time = to_microseconds(resources.ru_utime) + to_microseconds(resources.ru_stime);
+    usage.peak_rss_bytes = static_cast<uint64_t>(resources.ru_maxrss) * 1024;
+  }
+  std::ifstream statm("/proc/self/statm");
+  uint64_t size = 0;
+  uint64_t resident = 0;
+  if (statm >> size >> resident) {
+    usage.rss_bytes = resident * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+  }
+  return usage;
+}
+
+// Node UUIDs are derived from the index of the device, so that runs are repeatable
+auto node_uuid(std::size_t index) -> std::string {
+  return fmt::format("00000000-0000-4000-8000-{:012x}", index);
+}
+
+auto percentile(const std::vector<std::chrono::microseconds>& sorted, double fraction)
+    -> std::chrono::microseconds {
+  if (sorted.empty()) {
+    return std::chrono::microseconds(0);
+  }
+  const auto rank =
+      static_cast<std::size_t>(std::ceil(fraction * static_cast<double>(sorted.size())));
+  return sorted.at(std::clamp<std::size_t>(rank, 1, sorted.size()) - 1);
+}
+
+// Traffic of a kind generated by a single device
+struct Stream {
+  AstarteDeviceGRPC* device;
+  LoadKind kind;
+  steady_clock::duration interval;
+  steady_clock::time_point next;
+  int64_t sequence{0};
+};
+
+// Results of a kind collected by a single thread
+struct KindSamples {
+  uint64_t sent{0};
+  uint64_t errors{0};
+  std::vector<std::chrono::microseconds> latencies;
+};
+
+using WorkerSamples = std::array<KindSamples, LOAD_KINDS>;
+
+void send(Stream& stream) {
+  const std::string sensor = fmt::format("/sensor{}", stream.sequence % 4);
+  const int64_t sequence = stream.sequence++;
+  switch (stream.kind) {
+    case LoadKind::kIndividual:
+      stream.device->send_individual(INDIVIDUAL_INTERFACE, sensor + "/value",
+                                     AstarteData(static_cast<double>(sequence) / 10), nullptr);
+      break;
+    case LoadKind::kObject: {
+      const AstarteDatastreamObject object = {{"temperature", AstarteData(21.5)},
+                                              {"humidity", AstarteData(48.0)},
+                                              {"sequence", AstarteData(sequence)}};
+      stream.device->send_object(OBJECT_INTERFACE, sensor, object, nullptr);
+      break;
+    }
+    case LoadKind::kProperty:
+      stream.device->set_property(PROPERTY_INTERFACE, sensor + "/counter", AstarteData(sequence));
+      break;
+  }
+}
+
+// Sends on the schedule of the streams until the deadline. Late sends are not skipped, but the
+// backlog left at the deadline is dropped, so that a saturated run still lasts its duration.
+void drive(std::vector<Stream> streams, steady_clock::time_point deadline,
+           WorkerSamples& samples) {
+  auto later = [&streams](std::size_t lhs, std::size_t rhs) {
+    return streams.at(lhs).next > streams.at(rhs).next;
+  };
+  std::priority_queue<std::size_t, std::vector<std::size_t>, decltype(later)> schedule(later);
+  for (std::size_t index = 0; index < streams.size(); index++) {
+    schedule.push(index);
+  }
+
+  while (!schedule.empty()) {
+    const std::size_t index = schedule.top();
+    schedule.pop();
+    Stream& stream = streams.at(index);
+    if ((stream.next >= deadline) || (steady_clock::now() >= deadline)) {
+      continue;
+    }
+    std::this_thread::sleep_until(stream.next);
+
+    KindSamples& kind_samples = samples.at(static_cast<std::size_t>(stream.kind));
+    const steady_clock::time_point start = steady_clock::now();
+    try {
+      send(stream);
+      kind_samples.sent++;
+    } catch (const AstarteException& error) {
+      spdlog::debug("Send failed: {}", error.what());
+      kind_samples.errors++;
+    }
+    kind_samples.latencies.push_back(
+        std::chrono::duration_cast<std::chrono::microseconds>(steady_clock::now() - start));
+
+    stream.next += stream.interval;
+    schedule.push(index);
+  }
+}
+
+}  // namespace
+
+auto load_kind_name(LoadKind kind) -> const char* {
+  switch (kind) {
+    case LoadKind::kIndividual:
+      return "send_individual";
+    case LoadKind::kObject:
+      return "send_object";
+    case LoadKind::kProperty:
+      return "set_property";
+  }
+  return "unknown";
+}
+
+LoadGenerator::LoadGenerator(LoadGeneratorConfig config) : config_(std::move(config)) {}
+
+auto LoadGenerator::run() -> LoadReport {
+  LoadReport report;
+  report.devices = config_.devices;
+
+  // Declared first, so that it outlives the devices
+  std::unique_ptr<FakeMessageHubServer> fake_hub;
+  std::string address = config_.address;
+  if (address.empty()) {
+    fake_hub = std::make_unique<FakeMessageHubServer>();
+    fake_hub->hub().set_latency(config_.hub_latency);
+    address = fake_hub->get_address();
+    spdlog::info("Started an in-process fake message hub on {}", address);
+  }
+
+  std::shared_ptr<AstarteHubConnection> connection;
+  if (config_.shared_connection) {
+    connection = std::make_shared<AstarteHubConnection>(address);
+  }
+  std::vector<std::unique_ptr<AstarteDeviceGRPC>> devices;
+  devices.reserve(config_.devices);
+  const steady_clock::time_point connect_start = steady_clock::now();
+  for (std::size_t index = 0; index < config_.devices; index++) {
+    auto device = connection ? std::make_unique<AstarteDeviceGRPC>(connection, node_uuid(index))
+                             : std::make_unique<AstarteDeviceGRPC>(address, node_uuid(index));
+    device->add_interface_from_str(INDIVIDUAL_JSON);
+    device->add_interface_from_str(OBJECT_JSON);
+    device->add_interface_from_str(PROPERTY_JSON);
+    device->connect();
+    devices.push_back(std::move(device));
+  }
+
+  const steady_clock::time_point connect_deadline = connect_start + config_.connect_timeout;
+  auto count_connected = [&devices] {
+    return static_cast<std::size_t>(std::ranges::count_if(
+        devices, [](const std::unique_ptr<AstarteDeviceGRPC>& device) {
+          return device->is_connected();
+        }));
+  };
+  while ((count_connected() < devices.size()) && (steady_clock::now() < connect_deadline)) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  report.connected = count_connected();
+  report.connect_time =
+      std::chrono::duration_cast<std::chrono::milliseconds>(steady_clock::now() - connect_start);
+  if (report.connected < devices.size()) {
+    spdlog::warn("Only {} of {} devices connected, the others will report errors.",
+                 report.connected, devices.size());
+  }
+
+  // The streams of each device are spread over the interval, to avoid bursts
+  const std::size_t threads = std::clamp<std::size_t>(config_.threads, 1, devices.size());
+  const steady_clock::time_point start = steady_clock::now();
+  const steady_clock::time_point deadline = start + config_.duration;
+  std::vector<std::vector<Stream>> partitions(threads);
+  for (std::size_t index = 0; index < devices.size(); index++) {
+    for (std::size_t kind = 0; kind < LOAD_KINDS; kind++) {
+      const double rate = config_.rates.at(kind);
+      if (rate <= 0) {
+        continue;
+      }
+      const auto interval = std::chrono::duration_cast<steady_clock::duration>(
+          std::chrono::duration<double>(1.0 / rate));
+      const auto phase =
+          interval * static_cast<int64_t>(index) / static_cast<int64_t>(devices.size());
+      partitions.at(index % threads)
+          .push_back(Stream{.device = devices.at(index).get(),
+                            .kind = static_cast<LoadKind>(kind),
+                            .interval = interval,
+                            .next = start + phase});
+    }
+  }
+
+  std::vector<WorkerSamples> samples(threads);
+  const ProcessUsage usage_start = read_process_usage();
+  {
+    std::vector<std::jthread> workers;
+    workers.reserve(threads);
+    for (std::size_t worker = 0; worker < threads; worker++) {
+      workers.emplace_back(drive, std::move(partitions.at(worker)), deadline,
+                           std::ref(samples.at(worker)));
+    }
+  }
+  report.elapsed = steady_clock::now() - start;
+  const ProcessUsage usage_end = read_process_usage();
+  report.cpu_cores = std::chrono::duration<double>(usage_end.cpu_time - usage_start.cpu_time) /
+                     report.elapsed;
+  report.rss_bytes = usage_end.rss_bytes;
+  report.peak_rss_bytes = usage_end.peak_rss_bytes;
+
+  for (std::size_t kind = 0; kind < LOAD_KINDS; kind++) {
+    LoadKindReport& kind_report = report.kinds.at(kind);
+    std::vector<std::chrono::microseconds> latencies;
+    for (WorkerSamples& worker_samples : samples) {
+      KindSamples& kind_samples = worker_samples.at(kind);
+      kind_report.sent += kind_samples.sent;
+      kind_report.errors += kind_samples.errors;
+      latencies.insert(latencies.end(), kind_samples.latencies.begin(),
+                       kind_samples.latencies.end());
+    }
+    std::ranges::sort(latencies);
+    kind_report.target_rate = config_.rates.at(kind) * static_cast<double>(devices.size());
+    kind_report.achieved_rate = static_cast<double>(kind_report.sent) / report.elapsed.count();
+    kind_report.p50 = percentile(latencies, 0.50);
+    kind_report.p90 = percentile(latencies, 0.90);
+    kind_report.p99 = percentile(latencies, 0.99);
+    kind_report.max = latencies.empty() ? std::chrono::microseconds(0) : latencies.back();
+  }
+
+  for (const std::unique_ptr<AstarteDeviceGRPC>& device : devices) {
+    device->disconnect();
+  }
+  return report;
+}
+
+}  // namespace AstarteDeviceSdk
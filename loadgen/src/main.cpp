@@ -0,0 +1,185 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <spdlog/fmt/fmt.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+
+#include "load_generator.hpp"
+
+using AstarteDeviceSdk::LOAD_KINDS;
+using AstarteDeviceSdk::load_kind_name;
+using AstarteDeviceSdk::LoadGenerator;
+using AstarteDeviceSdk::LoadGeneratorConfig;
+using AstarteDeviceSdk::LoadKind;
+using AstarteDeviceSdk::LoadReport;
+
+namespace {
+
+void print_usage(const char* program) {
+  fmt::print(
+      "Usage: {} [OPTIONS]\n"
+      "\n"
+      "Drive many Astarte devices at target rates and report what the process sustains.\n"
+      "\n"
+      "Options:\n"
+      "  --address <ADDR>         Message hub address. Default: an in-process fake message hub.\n"
+      "  --devices <N>            Number of devices. Default: 10.\n"
+      "  --threads <N>            Threads driving the devices. Default: the number of cores.\n"
+      "  --shared-connection      Multiplex all the devices over a single connection.\n"
+      "  --duration <S>           Duration of the measurement in seconds. Default: 30.\n"
+      "  --connect-timeout <S>    Time allowed for the devices to connect. Default: 30.\n"
+      "  --individual-rate <R>    send_individual calls per second per device. Default: 10.\n"
+      "  --object-rate <R>        send_object calls per second per device. Default: 1.\n"
+      "  --property-rate <R>      set_property calls per second per device. Default: 0.1.\n"
+      "  --hub-latency <US>       Latency of the fake message hub in microseconds. Default: 0.\n"
+      "  --verbose                Print the logs of the devices.\n"
+      "  -h, --help               Display this help message.\n",
+      program);
+}
+
+template <typename T>
+auto parse_number(std::string_view text) -> std::optional<T> {
+  T value{};
+  const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+  if ((error != std::errc()) || (end != text.data() + text.size()) || (value < T{})) {
+    return std::nullopt;
+  }
+  return value;
+}
+
+struct Options {
+  LoadGeneratorConfig config;
+  bool verbose{false};
+  bool help{false};
+};
+
+// Returns std::nullopt after printing the error, when the arguments are invalid
+auto parse_arguments(std::span<char*> args) -> std::optional<Options> {
+  Options options;
+  LoadGeneratorConfig& config = options.config;
+  config.threads = std::max(std::thread::hardware_concurrency(), 1U);
+  for (std::size_t index = 1; index < args.size(); index++) {
+    const std::string_view option(args[index]);
+    if ((option == "-h") || (option == "--help")) {
+      options.help = true;
+      return options;
+    }
+    if (option == "--shared-connection") {
+      config.shared_connection = true;
+      continue;
+    }
+    if (option == "--verbose") {
+      options.verbose = true;
+      continue;
+    }
+
+    if (index + 1 >= args.size()) {
+      fmt::print(stderr, "Error: missing argument for {}.\n", option);
+      return std::nullopt;
+    }
+    const std::string_view value(args[++index]);
+    bool valid = true;
+    auto set_count = [&valid, value](std::size_t& field) {
+      const auto parsed = parse_number<std::size_t>(value);
+      valid = parsed.has_value() && (parsed.value() > 0);
+      field = parsed.value_or(field);
+    };
+    auto set_seconds = [&valid, value](std::chrono::seconds& field) {
+      const auto parsed = parse_number<int64_t>(value);
+      valid = parsed.has_value();
+      field = std::chrono::seconds(parsed.value_or(field.count()));
+    };
+    auto set_rate = [&valid, value, &config](LoadKind kind) {
+      const auto parsed = parse_number<double>(value);
+      valid = parsed.has_value();
+      config.rates.at(static_cast<std::size_t>(kind)) = parsed.value_or(0);
+    };
+
+    if (option == "--address") {
+      config.address = value;
+    } else if (option == "--devices") {
+      set_count(config.devices);
+    } else if (option == "--threads") {
+      set_count(config.threads);
+    } else if (option == "--duration") {
+      set_seconds(config.duration);
+    } else if (option == "--connect-timeout") {
+      set_seconds(config.connect_timeout);
+    } else if (option == "--individual-rate") {
+      set_rate(LoadKind::kIndividual);
+    } else if (option == "--object-rate") {
+      set_rate(LoadKind::kObject);
+    } else if (option == "--property-rate") {
+      set_rate(LoadKind::kProperty);
+    } else if (option == "--hub-latency") {
+      const auto parsed = parse_number<int64_t>(value);
+      valid = parsed.has_value();
+      config.hub_latency = std::chrono::microseconds(parsed.value_or(0));
+    } else {
+      fmt::print(stderr, "Error: unknown option {}.\n", option);
+      print_usage(args[0]);
+      return std::nullopt;
+    }
+    if (!valid) {
+      fmt::print(stderr, "Error: invalid argument '{}' for {}.\n", value, option);
+      return std::nullopt;
+    }
+  }
+  return options;
+}
+
+void print_report(const LoadReport& report) {
+  fmt::print("Devices:      {} connected of {}, in {} ms\n", report.connected, report.devices,
+             report.connect_time.count());
+  fmt::print("Duration:     {:.2f} s\n", report.elapsed.count());
+  fmt::print("CPU:          {:.2f} cores\n", report.cpu_cores);
+  fmt::print("RSS:          {:.1f} MiB, peak {:.1f} MiB\n",
+             static_cast<double>(report.rss_bytes) / (1024.0 * 1024.0),
+             static_cast<double>(report.peak_rss_bytes) / (1024.0 * 1024.0));
+  fmt::print("\n{:<16} {:>12} {:>12} {:>10} {:>8} {:>10} {:>10} {:>10} {:>10}\n", "Call",
+             "Target/s", "Achieved/s", "Sent", "Errors", "p50 us", "p90 us", "p99 us", "Max us");
+  for (std::size_t kind = 0; kind < LOAD_KINDS; kind++) {
+    const auto& kind_report = report.kinds.at(kind);
+    if (kind_report.target_rate <= 0) {
+      continue;
+    }
+    fmt::print("{:<16} {:>12.1f} {:>12.1f} {:>10} {:>8} {:>10} {:>10} {:>10} {:>10}\n",
+               load_kind_name(static_cast<LoadKind>(kind)), kind_report.target_rate,
+               kind_report.achieved_rate, kind_report.sent, kind_report.errors,
+               kind_report.p50.count(), kind_report.p90.count(), kind_report.p99.count(),
+               kind_report.max.count());
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const std::span<char*> args(argv, static_cast<std::size_t>(argc));
+  const std::optional<Options> options = parse_arguments(args);
+  if (!options.has_value()) {
+    return 1;
+  }
+  if (options->help) {
+    print_usage(args[0]);
+    return 0;
+  }
+  spdlog::set_level(options->verbose ? spdlog::level::info : spdlog::level::warn);
+
+  LoadGenerator generator(options->config);
+  print_report(generator.run());
+  return 0;
+}
@@ -0,0 +1,81 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef BASE64_KERNELS_H
+#define BASE64_KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief Base64 functions for an instruction set, working on whole blocks.
+ * @details The base64 functions let the kernels of the CPU handle the bulk of the data and finish
+ * the rest, padding and errors included, with the scalar kernels.
+ */
+struct Base64Kernels {
+  /** @brief Name of the instruction set. */
+  std::string_view name;
+  /**
+   * @brief Encode the longest prefix of the data the kernel can handle, in blocks of three bytes.
+   * @param data The bytes to encode.
+   * @param out The output, with room for the encoding of all the data.
+   * @return The number of bytes encoded, a multiple of three.
+   */
+  auto (*encode)(std::span<const uint8_t> data, char* out) -> std::size_t;
+  /**
+   * @brief Decode the longest prefix of the text the kernel can handle, in blocks of four
+   * characters.
+   * @details The text must not contain padding, the decoding stops before the first block with a
+   * character out of the alphabet.
+   * @param text The text to decode.
+   * @param out The output, with room for the decoding of all the text.
+   * @return The number of characters decoded, a multiple of four.
+   */
+  auto (*decode)(std::string_view text, uint8_t* out) -> std::size_t;
+};
+
+/**
+ * @brief Get the portable kernels, handling any number of whole blocks.
+ * @return The kernels.
+ */
+auto base64_scalar_kernels() -> const Base64Kernels&;
+
+/**
+ * @brief Get the SSSE3 kernels, handling 12 bytes or 16 characters at a time.
+ * @return The kernels, nullptr when the compiler or the CPU don't support them.
+ */
+auto base64_ssse3_kernels() -> const Base64Kernels*;
+
+/**
+ * @brief Get the AVX2 kernels, handling 24 bytes or 32 characters at a time.
+ * @return The kernels, nullptr when the compiler or the CPU don't support them.
+ */
+auto base64_avx2_kernels() -> const Base64Kernels*;
+
+/**
+ * @brief Get the NEON kernels, handling 48 bytes or 64 characters at a time.
+ * @return The kernels, nullptr when the compiler or the CPU don't support them.
+ */
+auto base64_neon_kernels() -> const Base64Kernels*;
+
+/**
+ * @brief Get all the kernels supported by this CPU.
+ * @return The kernels, from the scalar ones to the fastest ones.
+ */
+auto base64_supported_kernels() -> std::vector<const Base64Kernels*>;
+
+/**
+ * @brief Get the kernels used by the base64 functions, the fastest supported by this CPU.
+ * @return The kernels, selected on the first call.
+ */
+auto base64_kernels() -> const Base64Kernels&;
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // BASE64_KERNELS_H
@@ -0,0 +1,142 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef DATASTREAM_AGGREGATOR_H
+#define DATASTREAM_AGGREGATOR_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/datastream_aggregation.hpp"
+#include "astarte_device_sdk/object.hpp"
+#include "string_map.hpp"
+#include "timer_wheel.hpp"
+
+namespace AstarteDeviceSdk {
+
+/** @brief Object built by the aggregator, ready to be sent. */
+struct AggregatedObject {
+  /** @brief The object aggregated interface of the object. */
+  std::string interface_name;
+  /** @brief The individual interface of the aggregated samples. */
+  std::string source_interface_name;
+  /** @brief The common path of the aggregated samples. */
+  std::string path;
+  /** @brief The aggregated samples. */
+  AstarteDatastreamObject object;
+  /** @brief The timestamp of the first sample of the window, if it had one. */
+  std::optional<std::chrono::system_clock::time_point> timestamp;
+};
+
+/**
+ * @brief Packs the individual datastream samples of a device into objects.
+ * @details Each interface and common path has its own time window, expired on a timer wheel shared
+ * by all the aggregators. Windows completed by a sample are handed back to the caller, while
+ * expired windows are passed to the flush callback on the wheel thread. With manual expiry the
+ * wheel is not used, the owner collects the expired windows with take_expired instead.
+ */
+class DatastreamAggregator : public std::enable_shared_from_this<DatastreamAggregator> {
+ public:
+  /** @brief Callback receiving the expired windows. */
+  using Flush = std::function<void(AggregatedObject)>;
+
+  /**
+   * @brief Constructor for the DatastreamAggregator class.
+   * @param wheel The timer wheel expiring the windows, it must outlive the aggregator.
+   * @param flush The callback receiving the expired windows.
+   */
+  DatastreamAggregator(TimerWheel& wheel, Flush flush);
+  /**
+   * @brief Configure the aggregation of an interface.
+   * @param interface_name The individual datastream interface to aggregate.
+   * @param aggregation The aggregation configuration.
+   */
+  void set_aggregation(std::string_view interface_name,
+                       const AstarteDatastreamAggregation& aggregation);
+  /**
+   * @brief Remove the aggregation of an interface.
+   * @param interface_name The aggregated interface.
+   * @return The open windows of the interface, which should be sent.
+   */
+  auto remove_aggregation(std::string_view interface_name) -> std::vector<AggregatedObject>;
+  /**
+   * @brief Add a sample to its window, if its interface is aggregated.
+   * @param interface_name The interface of the sample.
+   * @param path The path of the sample.
+   * @param data The value of the sample.
+   * @param timestamp The timestamp of the sample, nullptr for none.
+   * @param ready Receives the windows that should be sent right away, in order: the window closed
+   * because the sample repeats one of its fields, then the window completed by the sample.
+   * @return True if the sample has been aggregated, false if it should be sent as it is.
+   */
+  auto aggregate(std::string_view interface_name, std::string_view path, const AstarteData& data,
+                 const std::chrono::system_clock::time_point* timestamp,
+                 std::vector<AggregatedObject>& ready) -> bool;
+  /**
+   * @brief Enable or disable the manual expiry of the windows.
+   * @details With manual expiry no timer is scheduled, so that no thread is started. Disabling it
+   * schedules the timers of the open windows.
+   * @param enabled True to expire the windows with take_expired, false to use the timer wheel.
+   */
+  void set_manual_expiry(bool enabled);
+  /**
+   * @brief Close the windows whose deadline has passed.
+   * @param now The current time.
+   * @return The expired windows, which should be sent.
+   */
+  auto take_expired(std::chrono::steady_clock::time_point now) -> std::vector<AggregatedObject>;
+  /**
+   * @brief Get the earliest deadline of the open windows.
+   * @return The deadline, std::nullopt when no window is open.
+   */
+  auto get_next_deadline() -> std::optional<std::chrono::steady_clock::time_point>;
+  /**
+   * @brief Close all the open windows.
+   * @return The closed windows, which should be sent.
+   */
+  auto take_all() -> std::vector<AggregatedObject>;
+  /** @brief Stop passing the expired windows to the flush callback, waiting for running ones. */
+  void close();
+
+ private:
+  struct Window {
+    uint64_t id;
+    AstarteDatastreamObject object;
+    std::optional<std::chrono::system_clock::time_point> timestamp;
+    std::chrono::steady_clock::time_point deadline;
+  };
+  struct InterfaceState {
+    AstarteDatastreamAggregation aggregation;
+    StringMap<Window> windows;
+  };
+
+  static auto close_window(std::string_view interface_name, const InterfaceState& interface,
+                           std::string_view path, Window& window) -> AggregatedObject;
+  void schedule_expiry(std::chrono::milliseconds delay, std::string interface_name,
+                       std::string path, uint64_t id);
+  void expire(const std::string& interface_name, const std::string& path, uint64_t id);
+
+  TimerWheel& wheel_;
+  // Lets the devices without aggregations skip the lookup
+  std::atomic_bool has_aggregations_{false};
+  std::mutex mutex_;
+  StringMap<InterfaceState> interfaces_;
+  uint64_t next_window_id_{0};
+  bool manual_expiry_{false};
+  std::mutex flush_mutex_;
+  Flush flush_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // DATASTREAM_AGGREGATOR_H
@@ -0,0 +1,129 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef DATASTREAM_FILTER_TABLE_H
+#define DATASTREAM_FILTER_TABLE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string_view>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/datastream_filter.hpp"
+#include "astarte_device_sdk/object.hpp"
+#include "string_map.hpp"
+
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief Datastream filters configured on a device, together with the last sent samples.
+ * @details Filters can be configured for a whole interface or for a single path, the latter
+ * taking precedence. Samples on paths without a filter are always admitted.
+ */
+class DatastreamFilterTable {
+ public:
+  /**
+   * @brief Configure a filter.
+   * @param interface_name The interface to filter.
+   * @param path The path to filter, an empty path applies the filter to the whole interface.
+   * @param filter The filter.
+   */
+  void set_filter(std::string_view interface_name, std::string_view path,
+                  const AstarteDatastreamFilter& filter);
+  /**
+   * @brief Remove a filter and the samples it recorded.
+   * @param interface_name The filtered interface.
+   * @param path The filtered path, empty for a filter on the whole interface.
+   */
+  void remove_filter(std::string_view interface_name, std::string_view path);
+  /**
+   * @brief Check if an individual sample should be sent.
+   * @details The sample is compared against the last recorded one, it is recorded only once sent.
+   * @param interface_name The interface of the sample.
+   * @param path The path of the sample.
+   * @param data The value of the sample.
+   * @param timestamp The timestamp of the sample, nullptr for the current time.
+   * @return True if the sample should be sent, false if it should be dropped.
+   */
+  auto admit(std::string_view interface_name, std::string_view path, const AstarteData& data,
+             const std::chrono::system_clock::time_point* timestamp) -> bool;
+  /**
+   * @brief Check if an object sample should be sent.
+   * @details The object is dropped only when all of its fields would be dropped.
+   * @param interface_name The interface of the sample.
+   * @param path The path of the sample.
+   * @param object The value of the sample.
+   * @param timestamp The timestamp of the sample, nullptr for the current time.
+   * @return True if the sample should be sent, false if it should be dropped.
+   */
+  auto admit(std::string_view interface_name, std::string_view path,
+             const AstarteDatastreamObject& object,
+             const std::chrono::system_clock::time_point* timestamp) -> bool;
+  /**
+   * @brief Record an individual sample accepted by the message hub.
+   * @details Samples of paths without a filter are ignored.
+   * @param interface_name The interface of the sample.
+   * @param path The path of the sample.
+   * @param data The value of the sample.
+   * @param timestamp The timestamp of the sample, nullptr for the current time.
+   */
+  void record(std::string_view interface_name, std::string_view path, const AstarteData& data,
+              const std::chrono::system_clock::time_point* timestamp);
+  /**
+   * @brief Record an object sample accepted by the message hub.
+   * @details Samples of paths without a filter are ignored.
+   * @param interface_name The interface of the sample.
+   * @param path The path of the sample.
+   * @param object The value of the sample.
+   * @param timestamp The timestamp of the sample, nullptr for the current time.
+   */
+  void record(std::string_view interface_name, std::string_view path,
+              const AstarteDatastreamObject& object,
+              const std::chrono::system_clock::time_point* timestamp);
+  /**
+   * @brief Check if any filter is configured.
+   * @return True if at least one filter is configured.
+   */
+  [[nodiscard]] auto is_enabled() const -> bool;
+  /**
+   * @brief Get the counters of the filtered and sent samples.
+   * @return The counters.
+   */
+  [[nodiscard]] auto get_stats() const -> AstarteDatastreamFilterStats;
+
+ private:
+  struct PathState {
+    std::optional<AstarteDatastreamFilter> filter;
+    std::chrono::system_clock::time_point last_sent;
+    // Last sent value of each field, individual samples use an empty field name
+    StringMap<AstarteData> last_values;
+  };
+  struct InterfaceState {
+    std::optional<AstarteDatastreamFilter> filter;
+    StringMap<PathState> paths;
+  };
+
+  static auto silence_expired(const AstarteDatastreamFilter& filter, const PathState& state,
+                              const std::chrono::system_clock::time_point* timestamp) -> bool;
+  static auto within_filter(const AstarteDatastreamFilter& filter, const AstarteData& last,
+                            const AstarteData& data) -> bool;
+  auto find_state(std::string_view interface_name, std::string_view path, bool create)
+      -> std::pair<PathState*, const AstarteDatastreamFilter*>;
+  auto count(bool admitted) -> bool;
+  void set_last_sent(PathState& state, const std::chrono::system_clock::time_point* timestamp);
+
+  // Lets the devices without filters skip the lookup
+  std::atomic_bool has_filters_{false};
+  std::atomic<uint64_t> filtered_{0};
+  std::atomic<uint64_t> sent_{0};
+  std::mutex mutex_;
+  StringMap<InterfaceState> interfaces_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // DATASTREAM_FILTER_TABLE_H
@@ -7,43 +7,84 @@
 
 #include <astarteplatform/msghub/astarte_message.pb.h>
 #include <astarteplatform/msghub/message_hub_service.grpc.pb.h>
+#include <astarteplatform/msghub/node.pb.h>
+#include <astarteplatform/msghub/property.pb.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/empty.pb.h>
+#include <grpcpp/alarm.h>
+#include <grpcpp/completion_queue.h>
 #include <grpcpp/grpcpp.h>
-#include <grpcpp/support/client_interceptor.h>
+#include <grpcpp/support/async_stream.h>
+#include <grpcpp/support/async_unary_call.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/support/status.h>
 
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
 #include <filesystem>
+#include <functional>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <optional>
-#include <stop_token>
+#include <span>
 #include <string>
 #include <string_view>
-#include <thread>
 #include <vector>
 
+#include "astarte_device_sdk/awaitable.hpp"
 #include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/datastream_aggregation.hpp"
+#include "astarte_device_sdk/datastream_filter.hpp"
 #include "astarte_device_sdk/device_grpc.hpp"
+#include "astarte_device_sdk/executor.hpp"
+#include "astarte_device_sdk/hub_connection.hpp"
 #include "astarte_device_sdk/msg.hpp"
 #include "astarte_device_sdk/object.hpp"
 #include "astarte_device_sdk/ownership.hpp"
 #include "astarte_device_sdk/property.hpp"
+#include "astarte_device_sdk/property_update.hpp"
+#include "astarte_device_sdk/rate_limit.hpp"
+#include "astarte_device_sdk/rpc_stats.hpp"
+#include "astarte_device_sdk/send_priority.hpp"
 #include "astarte_device_sdk/stored_property.hpp"
+#include "datastream_aggregator.hpp"
+#include "datastream_filter_table.hpp"
+#include "executor_strand.hpp"
+#include "exponential_backoff.hpp"
+#include "hub_connection_impl.hpp"
+#include "metrics_registry.hpp"
+#include "outbound_scheduler.hpp"
+#include "property_cache.hpp"
+#include "property_dedup.hpp"
+#include "rate_limiter.hpp"
+#include "send_pipeline.hpp"
 #include "shared_queue.hpp"
+#include "timer_wheel.hpp"
 
 namespace AstarteDeviceSdk {
 
+using gRPCAstarteMessage = astarteplatform::msghub::AstarteMessage;
 using gRPCMessageHub = astarteplatform::msghub::MessageHub;
 using gRPCMessageHubEvent = astarteplatform::msghub::MessageHubEvent;
+using gRPCNode = astarteplatform::msghub::Node;
+using gRPCStoredProperties = astarteplatform::msghub::StoredProperties;
 
 struct AstarteDeviceGRPC::AstarteDeviceGRPCImpl {
  public:
   /**
    * @brief Construct an AstarteDeviceGRPCImpl instance.
-   * @param server_addr The gRPC server address for the Astarte message hub.
+   * @param hub_connection The connection to the Astarte message hub, possibly shared with other
+   * devices.
    * @param node_uuid The unique identifier for the device connection.
    */
-  AstarteDeviceGRPCImpl(std::string server_addr, std::string node_uuid);
+  AstarteDeviceGRPCImpl(
+      std::shared_ptr<AstarteHubConnection::AstarteHubConnectionImpl> hub_connection,
+      std::string node_uuid);
   /** @brief Destructor for the Astarte device class. */
   ~AstarteDeviceGRPCImpl();
   /** @brief Copy constructor for the Astarte device class. */
@@ -73,8 +114,8 @@ struct AstarteDeviceGRPC::AstarteDeviceGRPCImpl {
   void remove_interface(const std::string& interface_name);
   /**
    * @brief Connect the device to Astarte.
-   * @details This is an asynchronous funciton. It will start a management thread that will
-   * manage the device connectivity.
+   * @details This is an asynchronous funciton. It starts the connection state machine, which is
+   * driven by the gRPC callbacks and timers without any dedicated thread.
    */
   void connect();
   /**
@@ -107,6 +148,36 @@ struct AstarteDeviceGRPC::AstarteDeviceGRPCImpl {
   void send_object(std::string_view interface_name, std::string_view path,
                    const AstarteDatastreamObject& object,
                    const std::chrono::system_clock::time_point* timestamp);
+  /**
+   * @brief Send a series of samples of an integer datastream.
+   * @param interface_name The name of the interface to send data to.
+   * @param path The path of the datastream.
+   * @param values The values of the samples.
+   * @param timestamps The timestamp of each sample.
+   */
+  void send_series(std::string_view interface_name, std::string_view path,
+                   std::span<const int32_t> values,
+                   std::span<const std::chrono::system_clock::time_point> timestamps);
+  /**
+   * @brief Send a series of samples of a long integer datastream.
+   * @param interface_name The name of the interface to send data to.
+   * @param path The path of the datastream.
+   * @param values The values of the samples.
+   * @param timestamps The timestamp of each sample.
+   */
+  void send_series(std::string_view interface_name, std::string_view path,
+                   std::span<const int64_t> values,
+                   std::span<const std::chrono::system_clock::time_point> timestamps);
+  /**
+   * @brief Send a series of samples of a double datastream.
+   * @param interface_name The name of the interface to send data to.
+   * @param path The path of the datastream.
+   * @param values The values of the samples.
+   * @param timestamps The timestamp of each sample.
+   */
+  void send_series(std::string_view interface_name, std::string_view path,
+                   std::span<const double> values,
+                   std::span<const std::chrono::system_clock::time_point> timestamps);
   /**
    * @brief Set a device property on an interface.
    * @param interface_name The name of the interface where the property is defined.
@@ -122,6 +193,22 @@ struct AstarteDeviceGRPC::AstarteDeviceGRPCImpl {
    * @param path The path of the property to unset.
    */
   void unset_property(std::string_view interface_name, std::string_view path);
+  /**
+   * @brief Set or unset many device properties, pipelining the sends to the message hub.
+   * @details Updates of the same property are sent in order.
+   * @param updates The property updates.
+   * @return The status of each update, in the same order as the updates.
+   */
+  auto set_properties(std::span<const AstartePropertyUpdate> updates)
+      -> std::vector<AstartePropertyUpdateStatus>;
+  /**
+   * @brief Unset many device properties of an interface, pipelining the sends to the message hub.
+   * @param interface_name The name of the interface where the properties are defined.
+   * @param paths The paths of the properties to unset.
+   * @return The status of each unset, in the same order as the paths.
+   */
+  auto unset_properties(std::string_view interface_name, std::span<const std::string> paths)
+      -> std::vector<AstartePropertyUpdateStatus>;
   /**
    * @brief Poll for a new message received from the message hub.
    * @details This method checks an internal queue for parsed messages from the server.
@@ -137,6 +224,20 @@ struct AstarteDeviceGRPC::AstarteDeviceGRPCImpl {
    */
   auto get_all_properties(const std::optional<AstarteOwnership>& ownership)
       -> std::list<AstarteStoredProperty>;
+  /**
+   * @brief Get all stored properties matching the input filter, as a vector.
+   * @param ownership Optional ownership filter.
+   * @return The stored properties, sharing their interface names.
+   */
+  auto get_all_properties_vector(const std::optional<AstarteOwnership>& ownership)
+      -> std::vector<AstarteStoredProperty>;
+  /**
+   * @brief Visit all stored properties matching the input filter, decoding them one at a time.
+   * @param ownership Optional ownership filter.
+   * @param callback The function called for each stored property.
+   */
+  void for_each_property(const std::optional<AstarteOwnership>& ownership,
+                         const std::function<void(const AstarteStoredProperty&)>& callback);
   /**
    * @brief Get stored propertied matching the interface.
    * @param interface_name The name of the interface for the property.
@@ -151,31 +252,469 @@ struct AstarteDeviceGRPC::AstarteDeviceGRPCImpl {
    */
   auto get_property(std::string_view interface_name, std::string_view path)
       -> AstartePropertyIndividual;
+  /**
+   * @brief Send an individual datastream value to an interface asynchronously.
+   * @param interface_name The name of the interface to send data to.
+   * @param path The path within the interface (e.g., "/endpoint/value").
+   * @param data The data point to send.
+   * @param timestamp An optional timestamp for the data point.
+   * @return An awaitable completed when the message hub acknowledges the data.
+   */
+  auto async_send_individual(std::string_view interface_name, std::string_view path,
+                             const AstarteData& data,
+                             const std::chrono::system_clock::time_point* timestamp)
+      -> AstarteAwaitable<void>;
+  /**
+   * @brief Send a datastream object to an interface asynchronously.
+   * @param interface_name The name of the interface to send data to.
+   * @param path The base path for the object within the interface.
+   * @param object The key-value map representing the object to send.
+   * @param timestamp An optional timestamp for the data.
+   * @return An awaitable completed when the message hub acknowledges the data.
+   */
+  auto async_send_object(std::string_view interface_name, std::string_view path,
+                         const AstarteDatastreamObject& object,
+                         const std::chrono::system_clock::time_point* timestamp)
+      -> AstarteAwaitable<void>;
+  /**
+   * @brief Set a device property on an interface asynchronously.
+   * @param interface_name The name of the interface where the property is defined.
+   * @param path The path of the property to set.
+   * @param data The value to set for the property.
+   * @return An awaitable completed when the message hub acknowledges the property.
+   */
+  auto async_set_property(std::string_view interface_name, std::string_view path,
+                          const AstarteData& data) -> AstarteAwaitable<void>;
+  /**
+   * @brief Unset a device property on an interface asynchronously.
+   * @param interface_name The name of the interface where the property is defined.
+   * @param path The path of the property to unset.
+   * @return An awaitable completed when the message hub acknowledges the unset.
+   */
+  auto async_unset_property(std::string_view interface_name, std::string_view path)
+      -> AstarteAwaitable<void>;
+  /**
+   * @brief Get all stored properties matching the input filter asynchronously.
+   * @param ownership Optional ownership filter.
+   * @return An awaitable for the list of stored properties.
+   */
+  auto async_get_all_properties(const std::optional<AstarteOwnership>& ownership)
+      -> AstarteAwaitable<std::list<AstarteStoredProperty>>;
+  /**
+   * @brief Get stored properties matching the interface asynchronously.
+   * @param interface_name The name of the interface for the properties.
+   * @return An awaitable for the list of stored properties.
+   */
+  auto async_get_properties(std::string_view interface_name)
+      -> AstarteAwaitable<std::list<AstarteStoredProperty>>;
+  /**
+   * @brief Get a single stored property asynchronously.
+   * @param interface_name The name of the interface for the property.
+   * @param path Exact path for the property.
+   * @return An awaitable for the stored property.
+   */
+  auto async_get_property(std::string_view interface_name, std::string_view path)
+      -> AstarteAwaitable<AstartePropertyIndividual>;
+  /**
+   * @brief Wait asynchronously for the next message received from the message hub.
+   * @return An awaitable for the received message.
+   */
+  auto next_message() -> AstarteAwaitable<AstarteMessage>;
+  /**
+   * @brief Enable or disable the manual drive mode.
+   * @details Can only be changed while the device is not connected.
+   * @param enabled True to enable the manual drive mode, false to disable it.
+   */
+  void set_manual_drive(bool enabled);
+  /**
+   * @brief Enable or disable the property cache.
+   * @details Can only be changed while the device is not connected.
+   * @param enabled True to enable the property cache, false to disable it.
+   */
+  void set_property_cache(bool enabled);
+  /**
+   * @brief Configure a filter dropping redundant datastream samples.
+   * @param interface_name The interface to filter.
+   * @param path The path to filter, an empty path applies the filter to the whole interface.
+   * @param filter The filter.
+   */
+  void set_datastream_filter(std::string_view interface_name, std::string_view path,
+                             const AstarteDatastreamFilter& filter);
+  /**
+   * @brief Remove a datastream filter.
+   * @param interface_name The filtered interface.
+   * @param path The filtered path, empty for a filter on the whole interface.
+   */
+  void remove_datastream_filter(std::string_view interface_name, std::string_view path);
+  /**
+   * @brief Get the counters of the datastream filters.
+   * @return The counters of the filtered and sent samples.
+   */
+  [[nodiscard]] auto get_datastream_filter_stats() const -> AstarteDatastreamFilterStats;
+  /**
+   * @brief Limit the rate of the messages sent by the device.
+   * @param limit The limit.
+   */
+  void set_rate_limit(const AstarteRateLimit& limit);
+  /** @brief Remove the limit on the rate of the messages sent by the device. */
+  void remove_rate_limit();
+  /**
+   * @brief Limit the rate of the messages sent on an interface.
+   * @param interface_name The interface name.
+   * @param limit The limit.
+   */
+  void set_interface_rate_limit(std::string_view interface_name, const AstarteRateLimit& limit);
+  /**
+   * @brief Remove the limit on the rate of the messages sent on an interface.
+   * @param interface_name The interface name.
+   */
+  void remove_interface_rate_limit(std::string_view interface_name);
+  /**
+   * @brief Get the counters of the messages checked against the rate limits.
+   * @return The counters.
+   */
+  [[nodiscard]] auto get_rate_limit_stats() const -> AstarteRateLimitStats;
+  /**
+   * @brief Override the priority lane of the messages of an interface.
+   * @param interface_name The interface name.
+   * @param priority The priority of its messages.
+   */
+  void set_interface_priority(std::string_view interface_name, AstarteSendPriority priority);
+  /**
+   * @brief Get the counters of a priority lane.
+   * @param priority The lane.
+   * @return The counters of the lane.
+   */
+  [[nodiscard]] auto get_send_lane_stats(AstarteSendPriority priority) const
+      -> AstarteSendLaneStats;
+  /**
+   * @brief Enable or disable the statistics of the gRPC calls over the connection of the device.
+   * @param enabled True to collect the statistics of the calls started afterwards.
+   */
+  void set_rpc_stats(bool enabled);
+  /**
+   * @brief Get the statistics of the gRPC calls over the connection of the device.
+   * @return The statistics of each method called while enabled.
+   */
+  [[nodiscard]] auto get_rpc_stats() const -> std::vector<AstarteRpcStats>;
+  /**
+   * @brief Configure the aggregation of an individual datastream into objects.
+   * @param interface_name The individual datastream interface to aggregate.
+   * @param aggregation The aggregation configuration.
+   */
+  void set_datastream_aggregation(std::string_view interface_name,
+                                  const AstarteDatastreamAggregation& aggregation);
+  /**
+   * @brief Remove the aggregation of an interface, sending its open windows.
+   * @param interface_name The aggregated interface.
+   */
+  void remove_datastream_aggregation(std::string_view interface_name);
+  /** @brief Send all the open aggregation windows without waiting for their expiry. */
+  void flush_datastream_aggregations();
+  /**
+   * @brief Enable or disable the suppression of redundant property sends.
+   * @param enabled True to enable the suppression, false to disable it.
+   */
+  void set_property_dedup(bool enabled);
+  /**
+   * @brief Get the number of property sends suppressed as redundant.
+   * @return The number of suppressed sends.
+   */
+  [[nodiscard]] auto get_suppressed_property_sends() const -> uint64_t;
+  /**
+   * @brief Set the executor used to run the background tasks of the device.
+   * @details Can only be changed while the device is not connected.
+   * @param executor The executor, nullptr to run the tasks on the gRPC callback threads.
+   */
+  void set_executor(std::shared_ptr<AstarteExecutor> executor);
+  /**
+   * @brief Advance the connection state machine, handle received events and perform pending sends.
+   * @details Only available in manual drive mode. Waits for the first completion up to the budget,
+   * then handles any other ready completion without blocking.
+   * @param budget The maximum time spent in this call.
+   * @return The number of completions handled.
+   */
+  auto run_once(const std::chrono::milliseconds& budget) -> std::size_t;
 
  private:
-  // Helper struct to hold the results of the Attach RPC call
-  struct AttachResult {
-    std::unique_ptr<grpc::ClientContext> context;
-    std::unique_ptr<grpc::ClientReader<gRPCMessageHubEvent>> reader;
+  /** @brief Maximum number of concurrent sends of the bulk property operations and series. */
+  static constexpr std::size_t MAX_PIPELINED_SENDS = 64;
+  /** @brief Maximum number of concurrent high priority sends. */
+  static constexpr std::size_t HIGH_PRIORITY_WINDOW = 16;
+  /** @brief Maximum number of concurrent normal priority sends. */
+  static constexpr std::size_t NORMAL_PRIORITY_WINDOW = 64;
+  /** @brief Size of the arena blocks holding the messages of a series, about 2000 samples. */
+  static constexpr std::size_t SERIES_ARENA_BLOCK_SIZE = 256 * 1024;
+
+  /** @brief States of the connection state machine. */
+  enum class ConnectionState : uint8_t {
+    /** @brief No connection has been requested, or the connection has been stopped. */
+    kIdle,
+    /** @brief An Attach RPC is in progress, waiting for the server initial metadata. */
+    kAttaching,
+    /** @brief The Attach stream is established and events are being received. */
+    kConnected,
+    /** @brief The Attach stream terminated, a reconnection timer is pending. */
+    kBackoff
+  };
+
+  /** @brief Callback invoked once the message hub has accepted a message. */
+  using OnSent = std::function<void()>;
+
+  /** @brief A message waiting to be sent by the next run_once call. */
+  struct PendingSend {
+    /** @brief The message. */
+    gRPCAstarteMessage message;
+    /** @brief The callback invoked once the message has been accepted, if any. */
+    OnSent on_sent;
+  };
+
+  /**
+   * @brief Reactor for the Attach server streaming RPC.
+   * @details Events are read on the gRPC callback threads, so no thread is parked in a blocking
+   * read for the lifetime of the stream. The device deletes the reactor once the RPC is done.
+   */
+  class AttachReactor : public grpc::ClientReadReactor<gRPCMessageHubEvent> {
+   public:
+    /**
+     * @brief Construct an AttachReactor instance.
+     * @param device The device that will be notified of the stream events.
+     * @param node The node message sent to the message hub with the Attach RPC.
+     */
+    AttachReactor(AstarteDeviceGRPCImpl& device, gRPCNode node);
+    /** @brief Start the Attach RPC and the first read. */
+    void start();
+    /** @brief Cancel the Attach RPC, OnDone will be invoked shortly after. */
+    void cancel();
+    /**
+     * @brief Callback for the reception of the server initial metadata.
+     * @param ok True if the metadata has been received, false if the stream failed.
+     */
+    void OnReadInitialMetadataDone(bool ok) override;
+    /**
+     * @brief Callback for the completion of a read operation.
+     * @param ok True if an event has been read, false if the stream has been closed.
+     */
+    void OnReadDone(bool ok) override;
+    /**
+     * @brief Callback for the termination of the RPC.
+     * @param status The final status of the RPC.
+     */
+    void OnDone(const grpc::Status& status) override;
+
+   private:
+    AstarteDeviceGRPCImpl& device_;
+    // From the documentation it appears that a context needs to be valid for the duration of the
+    // RPC. In this case the RPC ends when the return stream is closed, so the context should
+    // survive at least for that long.
+    // See: https://grpc.github.io/grpc/cpp/classgrpc_1_1_client_context.html
+    grpc::ClientContext context_;
+    gRPCNode node_;
+    gRPCMessageHubEvent event_;
+  };
+
+  /**
+   * @brief Operation driven by the device completion queue in manual drive mode.
+   * @details The address of the operation is used as the completion queue tag.
+   */
+  class CompletionTag {
+   public:
+    /** @brief Default constructor for the completion tag. */
+    CompletionTag() = default;
+    /** @brief Destructor for the completion tag. */
+    virtual ~CompletionTag() = default;
+    /** @brief Copy constructor for the completion tag. */
+    CompletionTag(const CompletionTag& other) = delete;
+    /** @brief Move constructor for the completion tag. */
+    CompletionTag(CompletionTag&& other) = delete;
+    /** @brief Copy assignment operator for the completion tag. */
+    auto operator=(const CompletionTag& other) -> CompletionTag& = delete;
+    /** @brief Move assignment operator for the completion tag. */
+    auto operator=(CompletionTag&& other) -> CompletionTag& = delete;
+    /**
+     * @brief Handle the completion of the last operation started with this tag.
+     * @param ok The success bit returned by the completion queue.
+     */
+    virtual void proceed(bool ok) = 0;
   };
-  void setup_grpc_channel();
-  auto perform_attach() -> std::optional<AttachResult>;
-  void connection_attempt(const std::stop_token& token);
-  void handle_events(const std::stop_token& token, std::unique_ptr<grpc::ClientContext> context,
-                     std::unique_ptr<grpc::ClientReader<gRPCMessageHubEvent>> reader);
+
+  /**
+   * @brief Attach server streaming RPC driven by the device completion queue.
+   * @details Counterpart of AttachReactor for the manual drive mode. The call deletes itself once
+   * its final status has been received.
+   */
+  class AttachCall : public CompletionTag {
+   public:
+    /**
+     * @brief Construct an AttachCall instance.
+     * @param device The device that will be notified of the stream events.
+     * @param node The node message sent to the message hub with the Attach RPC.
+     */
+    AttachCall(AstarteDeviceGRPCImpl& device, const gRPCNode& node);
+    /** @brief Start the Attach RPC. */
+    void start();
+    /** @brief Cancel the Attach RPC, the final status will be received shortly after. */
+    void cancel();
+    /**
+     * @brief Advance the Attach RPC to its next step.
+     * @param ok The success bit returned by the completion queue.
+     */
+    void proceed(bool ok) override;
+
+   private:
+    enum class Step : uint8_t { kStart, kMetadata, kRead, kFinish };
+    void finish();
+
+    AstarteDeviceGRPCImpl& device_;
+    grpc::ClientContext context_;
+    gRPCMessageHubEvent event_;
+    grpc::Status status_;
+    Step step_{Step::kStart};
+    std::unique_ptr<grpc::ClientAsyncReader<gRPCMessageHubEvent>> reader_;
+  };
+
+  /**
+   * @brief Send unary RPC driven by the device completion queue.
+   * @details The call deletes itself once the response has been received.
+   */
+  class SendCall : public CompletionTag {
+   public:
+    /**
+     * @brief Construct and start a SendCall instance.
+     * @param device The device performing the send.
+     * @param send The message to send, with its callback.
+     */
+    SendCall(AstarteDeviceGRPCImpl& device, PendingSend send);
+    /**
+     * @brief Handle the response of the Send RPC.
+     * @param ok The success bit returned by the completion queue.
+     */
+    void proceed(bool ok) override;
+
+   private:
+    AstarteDeviceGRPCImpl& device_;
+    gRPCAstarteMessage message_;
+    OnSent on_sent_;
+    grpc::ClientContext context_;
+    google::protobuf::Empty response_;
+    grpc::Status status_;
+    std::chrono::steady_clock::time_point started_;
+    std::unique_ptr<grpc::ClientAsyncResponseReader<google::protobuf::Empty>> reader_;
+  };
+
+  /** @brief Data of an asynchronous unary RPC, which must outlive the RPC itself. */
+  template <typename Request, typename Response>
+  struct AsyncUnaryCall {
+    grpc::ClientContext context;
+    Request request;
+    Response response;
+  };
+
+  void setup_client_context(grpc::ClientContext& context) const;
+  void setup_send_compression(grpc::ClientContext& context,
+                              const gRPCAstarteMessage& message) const;
+  template <typename Sample>
+  auto admit_sample(std::string_view interface_name, std::string_view path, const Sample& sample,
+                    const std::chrono::system_clock::time_point* timestamp) -> bool;
+  void send_aggregated_objects(std::vector<AggregatedObject> objects);
+  void on_aggregation_expired(AggregatedObject object);
+  void queue_expired_aggregations();
+  static auto make_aggregated_message(const AggregatedObject& object) -> gRPCAstarteMessage;
+  auto on_aggregated_sent(const AggregatedObject& object) -> OnSent;
+  auto fetch_all_properties(const std::optional<AstarteOwnership>& ownership)
+      -> gRPCStoredProperties;
+  void send_message(gRPCAstarteMessage message, OnSent on_sent = nullptr);
+  template <typename T>
+  void send_series_column(std::string_view interface_name, std::string_view path,
+                          std::span<const T> values,
+                          std::span<const std::chrono::system_clock::time_point> timestamps);
+  void send_batch(const std::vector<gRPCAstarteMessage*>& messages);
+  void start_scheduled_send(const gRPCAstarteMessage& message, OutboundScheduler::OnDone on_done,
+                            std::chrono::steady_clock::time_point not_before = {});
+  void start_send_rpc(grpc::ClientContext* context, const gRPCAstarteMessage* message,
+                      google::protobuf::Empty* response, OutboundScheduler::OnDone on_done);
+  auto get_message_priority(const gRPCAstarteMessage& message) -> AstarteSendPriority;
+  static void record_send(SdkMetrics& metrics, std::chrono::steady_clock::time_point started,
+                          const grpc::Status& status);
+  auto admit_message(const gRPCAstarteMessage& message) -> RateLimiter::Admission;
+  void send_deferred(gRPCAstarteMessage message, std::chrono::nanoseconds delay,
+                     OnSent on_sent = nullptr);
+  auto async_send_message(gRPCAstarteMessage message, OnSent on_sent = nullptr)
+      -> AstarteAwaitable<void>;
+  static auto make_ready_awaitable() -> AstarteAwaitable<void>;
+  template <typename T>
+  static auto make_ready_awaitable(T value) -> AstarteAwaitable<T>;
+  template <typename T, typename Response, typename Request, typename Rpc>
+  auto async_unary_call(Request request, Rpc rpc) -> AstarteAwaitable<T>;
+  static void on_property_sent(PropertyCache& cache, PropertyDedupTable& dedup,
+                               const gRPCAstarteMessage& message);
+  static void on_datastream_sent(DatastreamFilterTable& filters, const gRPCAstarteMessage& message);
+  void request_property_snapshot();
+  void fail_message_waiters();
+  static auto make_individual_message(std::string_view interface_name, std::string_view path,
+                                      const AstarteData& data,
+                                      const std::chrono::system_clock::time_point* timestamp)
+      -> gRPCAstarteMessage;
+  static auto make_object_message(std::string_view interface_name, std::string_view path,
+                                  const AstarteDatastreamObject& object,
+                                  const std::chrono::system_clock::time_point* timestamp)
+      -> gRPCAstarteMessage;
+  static auto make_property_message(std::string_view interface_name, std::string_view path,
+                                    const std::optional<AstarteData>& data) -> gRPCAstarteMessage;
+  auto flush_pending_sends() -> std::chrono::nanoseconds;
+  void check_reconnection_deadline();
+  void drain_completion_queue();
+  void start_attach();
+  void on_attached();
+  void on_event(gRPCMessageHubEvent event);
+  void handle_event(const gRPCMessageHubEvent& event);
+  void on_detached(const grpc::Status& status);
+  void schedule_reconnection();
+  void on_reconnection_timer(bool expired);
+  void stop_connection();
+  void stop_manual_connection();
   static auto parse_message_hub_event(const gRPCMessageHubEvent& event)
       -> std::optional<AstarteMessage>;
-  void connection_loop(const std::stop_token& token);
 
-  std::string server_addr_;
+  std::shared_ptr<AstarteHubConnection::AstarteHubConnectionImpl> hub_connection_;
   std::string node_uuid_;
   std::unique_ptr<gRPCMessageHub::Stub> stub_;
   std::vector<std::string> interfaces_bins_;
-  std::optional<std::jthread> connection_thread_;
+  std::mutex connection_mutex_;
+  std::condition_variable connection_cv_;
+  ConnectionState state_{ConnectionState::kIdle};
+  bool stop_requested_{false};
+  AttachReactor* reactor_{nullptr};
+  std::unique_ptr<grpc::Alarm> reconnection_alarm_;
+  int pending_alarms_{0};
+  ExponentialBackoff backoff_{std::chrono::seconds(2), std::chrono::minutes(1)};
+  bool manual_drive_{false};
+  grpc::CompletionQueue cq_;
+  AttachCall* attach_call_{nullptr};
+  std::size_t pending_send_calls_{0};
+  std::deque<PendingSend> pending_sends_;
+  std::chrono::system_clock::time_point reconnection_deadline_;
   std::atomic_bool connected_{false};
-  std::stop_source ssource_;
   std::atomic_bool grpc_stream_error_{false};
-  SharedQueue<AstarteMessage> rcv_queue_;
+  // Shared by all the devices of the process
+  SdkMetrics& metrics_{sdk_metrics()};
+  SharedQueue<AstarteMessage> rcv_queue_{&metrics_.receive_queue_depth};
+  // Shared with the send callbacks, which might complete after the device destruction
+  std::shared_ptr<OutboundScheduler> outbound_{std::make_shared<OutboundScheduler>(
+      HIGH_PRIORITY_WINDOW, NORMAL_PRIORITY_WINDOW, TimerWheel::shared())};
+  RateLimiter rate_limiter_;
+  // Shared with the timer wheel, which might expire a window after the device destruction
+  std::shared_ptr<DatastreamAggregator> datastream_aggregator_;
+  // Shared with the callbacks of the RPCs, which might complete after the device destruction
+  std::shared_ptr<PropertyCache> property_cache_{std::make_shared<PropertyCache>()};
+  std::shared_ptr<PropertyDedupTable> property_dedup_{std::make_shared<PropertyDedupTable>()};
+  std::shared_ptr<DatastreamFilterTable> datastream_filters_{
+      std::make_shared<DatastreamFilterTable>()};
+  std::mutex message_waiters_mutex_;
+  // Owned by the awaitables, the ones destroyed without being awaited expire and are skipped
+  std::deque<std::weak_ptr<AstarteAsyncState<AstarteMessage>>> message_waiters_;
+  // Declared last, the pending tasks must complete before the other members are destroyed
+  ExecutorStrand strand_;
 };
 
 }  // namespace AstarteDeviceSdk
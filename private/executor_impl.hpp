@@ -0,0 +1,78 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef EXECUTOR_IMPL_H
+#define EXECUTOR_IMPL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "astarte_device_sdk/executor.hpp"
+
+namespace AstarteDeviceSdk {
+
+struct AstarteWorkStealingExecutor::AstarteWorkStealingExecutorImpl {
+ public:
+  /**
+   * @brief Construct an AstarteWorkStealingExecutorImpl instance and start its threads.
+   * @param num_threads The number of threads of the pool, must be greater than zero.
+   */
+  explicit AstarteWorkStealingExecutorImpl(std::size_t num_threads);
+  /** @brief Destructor, runs all the pending tasks and joins the threads. */
+  ~AstarteWorkStealingExecutorImpl();
+  /** @brief Copy constructor for the executor implementation. */
+  AstarteWorkStealingExecutorImpl(const AstarteWorkStealingExecutorImpl& other) = delete;
+  /** @brief Move constructor for the executor implementation. */
+  AstarteWorkStealingExecutorImpl(AstarteWorkStealingExecutorImpl&& other) = delete;
+  /** @brief Copy assignment operator for the executor implementation. */
+  auto operator=(const AstarteWorkStealingExecutorImpl& other)
+      -> AstarteWorkStealingExecutorImpl& = delete;
+  /** @brief Move assignment operator for the executor implementation. */
+  auto operator=(AstarteWorkStealingExecutorImpl&& other)
+      -> AstarteWorkStealingExecutorImpl& = delete;
+
+  /**
+   * @brief Queue a task on one of the workers.
+   * @param task The task to run.
+   */
+  void post(std::function<void()> task);
+  /**
+   * @brief Get the number of threads of the pool.
+   * @return The number of threads of the pool.
+   */
+  [[nodiscard]] auto get_num_threads() const -> std::size_t;
+
+ private:
+  /** @brief Queue of tasks owned by a single thread of the pool. */
+  struct Worker {
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+  };
+
+  void run(std::size_t index);
+  auto pop_local(std::size_t index) -> std::optional<std::function<void()>>;
+  auto steal(std::size_t index) -> std::optional<std::function<void()>>;
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::atomic<std::size_t> next_worker_{0};
+  std::mutex sleep_mutex_;
+  std::condition_variable sleep_cv_;
+  // Tasks posted and not yet taken by a worker, counted before they are queued
+  std::size_t queued_tasks_{0};
+  bool stopping_{false};
+  // Declared last, the threads must be joined before the other members are destroyed
+  std::vector<std::jthread> threads_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // EXECUTOR_IMPL_H
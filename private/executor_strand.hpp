@@ -0,0 +1,111 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef EXECUTOR_STRAND_H
+#define EXECUTOR_STRAND_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "astarte_device_sdk/executor.hpp"
+#include "sdk_logger.hpp"
+
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief Run tasks in order on an executor, one at a time.
+ * @details Tasks are queued in the strand, and a single drain task at a time is posted to the
+ * executor. When no executor is set the tasks are run inline by the posting thread.
+ */
+class ExecutorStrand {
+ public:
+  /**
+   * @brief Set the executor used to run the tasks.
+   * @details Must only be called while the strand is idle.
+   * @param executor The executor, nullptr to run the tasks inline.
+   */
+  void set_executor(std::shared_ptr<AstarteExecutor> executor) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    executor_ = std::move(executor);
+  }
+  /**
+   * @brief Get the executor used to run the tasks.
+   * @return The executor, nullptr if the tasks are run inline.
+   */
+  auto get_executor() -> std::shared_ptr<AstarteExecutor> {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    return executor_;
+  }
+  /**
+   * @brief Schedule a task, it will run after all the previously posted tasks.
+   * @param task The task to run.
+   */
+  void post(std::function<void()> task) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!executor_) {
+      lock.unlock();
+      task();
+      return;
+    }
+
+    tasks_.push_back(std::move(task));
+    if (scheduled_) {
+      return;
+    }
+    scheduled_ = true;
+    // The executor can't change while the strand is scheduled, and the strand keeps it alive
+    AstarteExecutor* executor = executor_.get();
+    lock.unlock();
+    executor->post([this] { drain(); });
+  }
+  /** @brief Block until all the posted tasks have been run. */
+  void wait_idle() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_cv_.wait(lock, [this] { return !scheduled_; });
+  }
+
+ private:
+  // Bounds the time spent by a single drain task, so that a busy strand doesn't starve the others
+  static constexpr std::size_t MAX_BATCH_SIZE = 16;
+
+  void drain() {
+    for (std::size_t i = 0; i < MAX_BATCH_SIZE; i++) {
+      std::function<void()> task;
+      {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        if (tasks_.empty()) {
+          scheduled_ = false;
+          idle_cv_.notify_all();
+          return;
+        }
+        task = std::move(tasks_.front());
+        tasks_.pop_front();
+      }
+      try {
+        task();
+      } catch (const std::exception& e) {
+        ASTARTE_LOG_ERROR("Background task terminated with an exception: {}", e.what());
+      }
+    }
+
+    // Leave room to the other tasks of the executor before continuing
+    executor_->post([this] { drain(); });
+  }
+
+  std::shared_ptr<AstarteExecutor> executor_;
+  std::deque<std::function<void()>> tasks_;
+  bool scheduled_{false};
+  std::mutex mutex_;
+  std::condition_variable idle_cv_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // EXECUTOR_STRAND_H
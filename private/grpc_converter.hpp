@@ -9,13 +9,17 @@
 #include <astarteplatform/msghub/astarte_message.pb.h>
 #include <astarteplatform/msghub/interface.pb.h>
 #include <astarteplatform/msghub/property.pb.h>
+#include <google/protobuf/arena.h>
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <list>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "astarte_device_sdk/data.hpp"
@@ -25,6 +29,7 @@
 #include "astarte_device_sdk/ownership.hpp"
 #include "astarte_device_sdk/property.hpp"
 #include "astarte_device_sdk/stored_property.hpp"
+#include "string_map.hpp"
 
 namespace AstarteDeviceSdk {
 
@@ -75,6 +80,29 @@ class GrpcConverterFrom {
   auto operator()(const gRPCStoredProperties& value) -> std::list<AstarteStoredProperty>;
 };
 
+// Decodes the stored properties one at a time, sharing the interface names between the entries
+class StoredPropertiesDecoder {
+ public:
+  explicit StoredPropertiesDecoder(const gRPCStoredProperties& value);
+  [[nodiscard]] auto size() const -> std::size_t;
+  auto decode(std::size_t index) -> AstarteStoredProperty;
+  auto to_vector() -> std::vector<AstarteStoredProperty>;
+
+ private:
+  auto intern(const std::string& interface_name) -> std::shared_ptr<const std::string>;
+
+  const gRPCStoredProperties& value_;
+  StringMap<std::shared_ptr<const std::string>> interface_names_;
+};
+
+// Converts a column of numeric samples into datastream messages, one for each sample, allocated on
+// the arena to avoid a heap allocation for each message field
+template <typename T>
+auto encode_series(google::protobuf::Arena& arena, std::string_view interface_name,
+                   std::string_view path, std::span<const T> values,
+                   std::span<const std::chrono::system_clock::time_point> timestamps)
+    -> std::vector<gRPCAstarteMessage*>;
+
 }  // namespace AstarteDeviceSdk
 
 #endif  // GRPC_CONVERTER_H
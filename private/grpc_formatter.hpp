@@ -9,25 +9,49 @@
 #include <google/protobuf/text_format.h>
 
 #include <string>
-#include <type_traits>
 
 #include "astarte_device_sdk/formatter.hpp"
 
-template <typename T>
-concept ProtobufMessage = std::is_base_of_v<google::protobuf::Message, T>;
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief Text representation of a protobuf message, built only when it is formatted.
+ * @details Meant to be passed to the logging calls: the message is printed with the protobuf text
+ * format only if the log line is emitted, so a disabled log level never builds the string.
+ */
+class ProtobufText {
+ public:
+  /**
+   * @brief Wrap a protobuf message.
+   * @param message The message to format, it must outlive the wrapper.
+   */
+  explicit ProtobufText(const google::protobuf::Message& message) : message_(&message) {}
+  /**
+   * @brief Print the message with the protobuf text format.
+   * @return The text representation of the message.
+   */
+  [[nodiscard]] auto to_string() const -> std::string {
+    std::string text;
+    google::protobuf::TextFormat::PrintToString(*message_, &text);
+    return text;
+  }
+
+ private:
+  const google::protobuf::Message* message_;
+};
+
+}  // namespace AstarteDeviceSdk
 
-template <ProtobufMessage T>
-struct ASTARTE_NS_FORMAT::formatter<T> {  // NOLINT
+template <>
+struct ASTARTE_NS_FORMAT::formatter<AstarteDeviceSdk::ProtobufText> {  // NOLINT
   template <typename ParseContext>
   constexpr auto parse(ParseContext& ctx) {
     return ctx.begin();
   }
 
   template <typename FormatContext>
-  auto format(const T& obj, FormatContext& ctx) const {
-    std::string obj_str;
-    google::protobuf::TextFormat::PrintToString(obj, &obj_str);
-    return ASTARTE_NS_FORMAT::format_to(ctx.out(), "{}", obj_str);
+  auto format(const AstarteDeviceSdk::ProtobufText& text, FormatContext& ctx) const {
+    return ASTARTE_NS_FORMAT::format_to(ctx.out(), "{}", text.to_string());
   }
 };
 
@@ -2,13 +2,26 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 
-#ifndef GRPC_INTERCEPTOR_H
-#define GRPC_INTERCEPTOR_H
+#ifndef GRPC_INTERCEPTORS_H
+#define GRPC_INTERCEPTORS_H
 
 #include <grpcpp/support/client_interceptor.h>
 #include <grpcpp/support/interceptor.h>
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <vector>
+
+#include "astarte_device_sdk/rpc_stats.hpp"
+#include "metrics_registry.hpp"
+#include "string_map.hpp"
 
 namespace AstarteDeviceSdk {
 
@@ -17,24 +30,117 @@ using grpc::experimental::ClientRpcInfo;
 using grpc::experimental::Interceptor;
 using grpc::experimental::InterceptorBatchMethods;
 
-class NodeIdInterceptor : public Interceptor {
+/** @brief Counters of a gRPC method, updated by the interceptors of its calls. */
+struct RpcMethodStats {
+  /** @brief Function computing the encoded size of a received message. */
+  using ReceivedSize = auto (*)(const void* message) -> std::size_t;
+
+  /**
+   * @brief Constructor for the RpcMethodStats class.
+   * @param method The full name of the method.
+   */
+  explicit RpcMethodStats(std::string method);
+  /**
+   * @brief Read the counters.
+   * @return The statistics of the method.
+   */
+  [[nodiscard]] auto load() const -> AstarteRpcStats;
+
+  /** @brief Full name of the method. */
+  std::string method;
+  /** @brief Size of the responses of the method, nullptr for the unknown methods. */
+  ReceivedSize received_size{nullptr};
+  /** @brief Number of calls started. */
+  std::atomic<uint64_t> calls{0};
+  /** @brief Number of messages sent. */
+  std::atomic<uint64_t> messages_sent{0};
+  /** @brief Encoded size of the messages sent. */
+  std::atomic<uint64_t> bytes_sent{0};
+  /** @brief Number of messages received. */
+  std::atomic<uint64_t> messages_received{0};
+  /** @brief Encoded size of the messages received. */
+  std::atomic<uint64_t> bytes_received{0};
+  /** @brief Number of completed calls for each status code. */
+  std::array<std::atomic<uint64_t>, AstarteRpcStats::STATUS_CODES> status_codes{};
+  /** @brief Latency of the calls. */
+  LatencyHistogram latency;
+};
+
+/** @brief Statistics of the gRPC calls over a channel, collected only while enabled. */
+class RpcStatsTable {
+ public:
+  /**
+   * @brief Enable or disable the collection, affecting only the calls started afterwards.
+   * @param enabled True to collect the statistics of the new calls.
+   */
+  void set_enabled(bool enabled);
+  /**
+   * @brief Check if the statistics are collected.
+   * @return True when enabled.
+   */
+  [[nodiscard]] auto is_enabled() const -> bool;
+  /**
+   * @brief Get the counters of a method, creating them on its first call.
+   * @param method The full name of the method.
+   * @return The counters, valid as long as the table.
+   */
+  auto get_method(std::string_view method) -> RpcMethodStats&;
+  /**
+   * @brief Read the statistics of all the methods called while enabled.
+   * @return The statistics, ordered by method name.
+   */
+  [[nodiscard]] auto snapshot() const -> std::vector<AstarteRpcStats>;
+
+ private:
+  std::atomic_bool enabled_{false};
+  mutable std::mutex mutex_;
+  StringMap<std::unique_ptr<RpcMethodStats>> methods_;
+};
+
+/**
+ * @brief Interceptor timing a gRPC call and counting its messages.
+ * @details The call is timed from PRE_SEND_INITIAL_METADATA to POST_RECV_STATUS, telling the time
+ * spent on the network and in the message hub apart from the conversions done by the device.
+ */
+class RpcStatsInterceptor : public Interceptor {
  public:
-  explicit NodeIdInterceptor(std::string node_id);
+  /**
+   * @brief Constructor for the RpcStatsInterceptor class.
+   * @param table The table owning the counters, kept alive by the call.
+   * @param stats The counters of the method of the call.
+   */
+  RpcStatsInterceptor(std::shared_ptr<RpcStatsTable> table, RpcMethodStats& stats);
+  /**
+   * @brief Record the hook points of a batch of operations and let it proceed.
+   * @param methods The operations of the batch.
+   */
   void Intercept(InterceptorBatchMethods* methods) override;
 
  private:
-  std::string node_id_;
+  std::shared_ptr<RpcStatsTable> table_;
+  RpcMethodStats& stats_;
+  std::chrono::steady_clock::time_point started_;
 };
 
-class NodeIdInterceptorFactory : public ClientInterceptorFactoryInterface {
+/** @brief Factory creating an RpcStatsInterceptor for each call while the table is enabled. */
+class RpcStatsInterceptorFactory : public ClientInterceptorFactoryInterface {
  public:
-  explicit NodeIdInterceptorFactory(std::string node_id);
+  /**
+   * @brief Constructor for the RpcStatsInterceptorFactory class.
+   * @param table The table collecting the statistics.
+   */
+  explicit RpcStatsInterceptorFactory(std::shared_ptr<RpcStatsTable> table);
+  /**
+   * @brief Create the interceptor of a call.
+   * @param info The call.
+   * @return The interceptor, nullptr when disabled so that the call is not intercepted.
+   */
   auto CreateClientInterceptor(ClientRpcInfo* info) -> Interceptor* override;
 
  private:
-  std::string node_id_;
+  std::shared_ptr<RpcStatsTable> table_;
 };
 
 }  // namespace AstarteDeviceSdk
 
-#endif  // GRPC_INTERCEPTOR_H
+#endif  // GRPC_INTERCEPTORS_H
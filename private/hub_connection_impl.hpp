@@ -0,0 +1,83 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef HUB_CONNECTION_IMPL_H
+#define HUB_CONNECTION_IMPL_H
+
+#include <grpc/compression.h>
+#include <grpcpp/grpcpp.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "astarte_device_sdk/compression.hpp"
+#include "astarte_device_sdk/hub_connection.hpp"
+#include "astarte_device_sdk/rpc_stats.hpp"
+#include "grpc_interceptors.hpp"
+
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief Get the compression of a message.
+ * @param compression The compression settings of the channel.
+ * @param size The encoded size of the message.
+ * @return The configured algorithm, or no compression for messages below the minimum size.
+ */
+auto get_message_compression(const AstarteCompression& compression, std::size_t size)
+    -> grpc_compression_algorithm;
+
+struct AstarteHubConnection::AstarteHubConnectionImpl {
+ public:
+  /**
+   * @brief Construct an AstarteHubConnectionImpl instance.
+   * @details The gRPC channel is created immediately, the underlying socket will be opened on the
+   * first RPC and automatically re-established by gRPC when lost.
+   * @param server_addr The gRPC server address for the Astarte message hub.
+   * @param compression The default compression of the channel.
+   */
+  AstarteHubConnectionImpl(std::string server_addr, AstarteCompression compression);
+  /**
+   * @brief Get the address of the Astarte message hub.
+   * @return The gRPC server address of the Astarte message hub.
+   */
+  [[nodiscard]] auto get_server_addr() const -> const std::string&;
+  /**
+   * @brief Get the gRPC channel toward the Astarte message hub.
+   * @return The channel shared by all the devices using this connection.
+   */
+  [[nodiscard]] auto get_channel() const -> const std::shared_ptr<grpc::Channel>&;
+  /**
+   * @brief Get the compression settings of the channel.
+   * @return The compression settings.
+   */
+  [[nodiscard]] auto get_compression() const -> const AstarteCompression&;
+  /**
+   * @brief Get the compression of a message sent over the channel.
+   * @param size The encoded size of the message.
+   * @return The algorithm of the channel, or no compression for messages below the minimum size.
+   */
+  [[nodiscard]] auto get_message_compression(std::size_t size) const -> grpc_compression_algorithm;
+  /**
+   * @brief Enable or disable the statistics of the gRPC calls over the channel.
+   * @param enabled True to collect the statistics of the calls started afterwards.
+   */
+  void set_rpc_stats(bool enabled);
+  /**
+   * @brief Get the statistics of the gRPC calls over the channel.
+   * @return The statistics of each method called while enabled, ordered by method name.
+   */
+  [[nodiscard]] auto get_rpc_stats() const -> std::vector<AstarteRpcStats>;
+
+ private:
+  std::string server_addr_;
+  AstarteCompression compression_;
+  std::shared_ptr<RpcStatsTable> rpc_stats_;
+  std::shared_ptr<grpc::Channel> channel_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // HUB_CONNECTION_IMPL_H
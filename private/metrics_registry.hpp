@@ -0,0 +1,264 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef METRICS_REGISTRY_H
+#define METRICS_REGISTRY_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+
+#include "astarte_device_sdk/metrics.hpp"
+
+namespace AstarteDeviceSdk {
+
+/** @brief Number of threads owning a slot in each metric, the others share an atomic cell. */
+constexpr std::size_t METRICS_SLOTS = 32;
+/** @brief Size of a cache line, slots never share one. */
+constexpr std::size_t METRICS_CACHE_LINE = 64;
+
+/**
+ * @brief Assign a slot to the calling thread, released when the thread exits.
+ * @return The index of the slot, METRICS_SLOTS if all the slots are taken.
+ */
+auto acquire_metrics_slot() -> std::size_t;
+
+/**
+ * @brief Get the slot of the calling thread.
+ * @return The index of the slot, METRICS_SLOTS for the shared cell.
+ */
+inline auto metrics_slot() -> std::size_t {
+  // Constant initialized, so that reading it doesn't go through the thread local init wrapper
+  thread_local std::size_t slot = METRICS_SLOTS + 1;
+  if (slot > METRICS_SLOTS) [[unlikely]] {
+    slot = acquire_metrics_slot();
+  }
+  return slot;
+}
+
+/**
+ * @brief Add to the cell of a slot.
+ * @details Only the owner of a slot writes its cell, which avoids an atomic read-modify-write.
+ * @param cells The cells of a metric, one for each slot plus the shared one.
+ * @param delta The amount added.
+ */
+template <typename Cells, typename T>
+inline void add_to_slot(Cells& cells, T delta) {
+  const std::size_t slot = metrics_slot();
+  auto& cell = cells[slot].value;
+  if (slot < METRICS_SLOTS) [[likely]] {
+    cell.store(cell.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+  } else {
+    cell.fetch_add(delta, std::memory_order_relaxed);
+  }
+}
+
+/** @brief Monotonic counter, with a cell for each thread so that updates never contend. */
+class Counter {
+ public:
+  /**
+   * @brief Count some events.
+   * @param count The number of events.
+   */
+  void add(uint64_t count = 1) { add_to_slot(cells_, count); }
+  /**
+   * @brief Read the counter.
+   * @return The number of events counted.
+   */
+  [[nodiscard]] auto load() const -> uint64_t;
+
+ private:
+  struct alignas(METRICS_CACHE_LINE) Cell {
+    std::atomic<uint64_t> value{0};
+  };
+  std::array<Cell, METRICS_SLOTS + 1> cells_;
+};
+
+/** @brief Value going up and down, such as the depth of a queue. */
+class Gauge {
+ public:
+  /**
+   * @brief Change the value.
+   * @param delta The amount added, negative to decrease the value.
+   */
+  void add(int64_t delta) { add_to_slot(cells_, delta); }
+  /**
+   * @brief Read the value.
+   * @return The sum of all the changes.
+   */
+  [[nodiscard]] auto load() const -> int64_t;
+
+ private:
+  struct alignas(METRICS_CACHE_LINE) Cell {
+    std::atomic<int64_t> value{0};
+  };
+  std::array<Cell, METRICS_SLOTS + 1> cells_;
+};
+
+/**
+ * @brief Latency histogram with log-linear buckets.
+ * @details Latencies below a microsecond share the first bucket, then each power of two is split
+ * in four buckets, up to about a minute. Longer latencies are counted in the last bucket.
+ */
+class LatencyHistogram {
+ public:
+  /** @brief Latencies below 2^MIN_EXPONENT nanoseconds share the first bucket. */
+  static constexpr unsigned MIN_EXPONENT = 10;
+  /** @brief Latencies above 2^(MAX_EXPONENT + 1) nanoseconds share the last bucket. */
+  static constexpr unsigned MAX_EXPONENT = 35;
+  /** @brief Number of buckets in each power of two. */
+  static constexpr unsigned SUB_BUCKETS = 4;
+  /** @brief Total number of buckets. */
+  static constexpr std::size_t BUCKETS = 1 + ((MAX_EXPONENT - MIN_EXPONENT + 1) * SUB_BUCKETS);
+
+  /**
+   * @brief Record a latency.
+   * @param latency The latency.
+   */
+  void record(std::chrono::nanoseconds latency) {
+    const auto value = static_cast<uint64_t>(std::max<int64_t>(latency.count(), 0));
+    const std::size_t slot = metrics_slot();
+    Cell& cell = cells_[slot];
+    std::atomic<uint64_t>& count = cell.counts[bucket_of(value)];
+    if (slot < METRICS_SLOTS) [[likely]] {
+      count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+      cell.sum.store(cell.sum.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    } else {
+      count.fetch_add(1, std::memory_order_relaxed);
+      cell.sum.fetch_add(value, std::memory_order_relaxed);
+    }
+  }
+  /**
+   * @brief Get the bucket of a latency.
+   * @param nanoseconds The latency in nanoseconds.
+   * @return The index of the bucket.
+   */
+  static constexpr auto bucket_of(uint64_t nanoseconds) -> std::size_t {
+    if (nanoseconds < (uint64_t{1} << MIN_EXPONENT)) {
+      return 0;
+    }
+    const auto exponent = static_cast<unsigned>(std::bit_width(nanoseconds) - 1);
+    if (exponent > MAX_EXPONENT) {
+      return BUCKETS - 1;
+    }
+    const uint64_t sub = (nanoseconds >> (exponent - 2)) & (SUB_BUCKETS - 1);
+    return 1 + ((exponent - MIN_EXPONENT) * SUB_BUCKETS) + sub;
+  }
+  /**
+   * @brief Get the upper bound of a bucket.
+   * @param bucket The index of the bucket.
+   * @return The smallest latency, in nanoseconds, above the bucket.
+   */
+  static constexpr auto upper_bound(std::size_t bucket) -> uint64_t {
+    if (bucket == 0) {
+      return uint64_t{1} << MIN_EXPONENT;
+    }
+    const auto exponent = static_cast<unsigned>(MIN_EXPONENT + ((bucket - 1) / SUB_BUCKETS));
+    const uint64_t sub = (bucket - 1) % SUB_BUCKETS;
+    return (uint64_t{1} << exponent) + ((sub + 1) << (exponent - 2));
+  }
+  /**
+   * @brief Read the histogram.
+   * @param metric The metric filled with the samples, its name is left untouched.
+   */
+  void load(AstarteHistogramMetric& metric) const;
+
+ private:
+  struct alignas(METRICS_CACHE_LINE) Cell {
+    std::array<std::atomic<uint64_t>, BUCKETS> counts{};
+    std::atomic<uint64_t> sum{0};
+  };
+  std::array<Cell, METRICS_SLOTS + 1> cells_;
+};
+
+/**
+ * @brief Named metrics of the process.
+ * @details Metrics are registered once and never removed, so the references returned on
+ * registration stay valid. Only the registration and the snapshots lock, the updates don't.
+ */
+class MetricsRegistry {
+ public:
+  /**
+   * @brief Get the registry of the library.
+   * @return The registry shared by all the devices.
+   */
+  static auto global() -> MetricsRegistry&;
+  /**
+   * @brief Register a counter.
+   * @param name The name of the metric.
+   * @param help The description of the metric.
+   * @return The counter.
+   */
+  auto add_counter(std::string name, std::string help) -> Counter&;
+  /**
+   * @brief Register a gauge.
+   * @param name The name of the metric.
+   * @param help The description of the metric.
+   * @return The gauge.
+   */
+  auto add_gauge(std::string name, std::string help) -> Gauge&;
+  /**
+   * @brief Register a latency histogram.
+   * @param name The name of the metric.
+   * @param help The description of the metric.
+   * @return The histogram.
+   */
+  auto add_histogram(std::string name, std::string help) -> LatencyHistogram&;
+  /**
+   * @brief Read all the metrics.
+   * @return The snapshot of the metrics, ordered by name.
+   */
+  [[nodiscard]] auto snapshot() const -> AstarteMetricsSnapshot;
+
+ private:
+  template <typename Metric>
+  struct Entry {
+    std::string name;
+    std::string help;
+    Metric metric;
+  };
+
+  mutable std::mutex mutex_;
+  // Deques never move their elements
+  std::deque<Entry<Counter>> counters_;
+  std::deque<Entry<Gauge>> gauges_;
+  std::deque<Entry<LatencyHistogram>> histograms_;
+};
+
+/** @brief Metrics updated by the devices. */
+struct SdkMetrics {
+  /** @brief Messages successfully sent to the message hub. */
+  Counter& messages_sent;
+  /** @brief Messages rejected by the message hub or lost because of a connection failure. */
+  Counter& send_failures;
+  /** @brief Properties set or unset by the devices. */
+  Counter& property_updates;
+  /** @brief Events received from the message hub. */
+  Counter& events_received;
+  /** @brief Attempts to attach to the message hub. */
+  Counter& connection_attempts;
+  /** @brief Reconnections scheduled after a lost connection. */
+  Counter& reconnections;
+  /** @brief Messages received and not yet polled by the application. */
+  Gauge& receive_queue_depth;
+  /** @brief Time between the start of a Send call and its response. */
+  LatencyHistogram& send_latency;
+};
+
+/**
+ * @brief Get the metrics updated by the devices.
+ * @return The metrics, registered in the global registry on the first call.
+ */
+auto sdk_metrics() -> SdkMetrics&;
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // METRICS_REGISTRY_H
@@ -0,0 +1,123 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef OUTBOUND_SCHEDULER_H
+#define OUTBOUND_SCHEDULER_H
+
+#include <grpcpp/grpcpp.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string_view>
+
+#include "astarte_device_sdk/send_priority.hpp"
+#include "string_map.hpp"
+#include "timer_wheel.hpp"
+
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief Schedules the outbound messages of a device on priority lanes.
+ * @details Each lane has its own window of in-flight sends, so that a backlog of normal traffic
+ * never delays the high priority messages. When slots are available, queued high priority sends are
+ * always started first. Completions keep the scheduler alive, so it must be owned by a shared
+ * pointer.
+ */
+class OutboundScheduler : public std::enable_shared_from_this<OutboundScheduler> {
+ public:
+  /** @brief Callback invoked once a send has completed. */
+  using OnDone = std::function<void(const grpc::Status&)>;
+  /** @brief Function starting a send, it must eventually call on_done. */
+  using StartSend = std::function<void(OnDone on_done)>;
+
+  /**
+   * @brief Constructor for the OutboundScheduler class.
+   * @param high_window Maximum number of concurrent high priority sends.
+   * @param normal_window Maximum number of concurrent normal priority sends.
+   * @param wheel Timer wheel running the delayed submissions.
+   */
+  OutboundScheduler(std::size_t high_window, std::size_t normal_window, TimerWheel& wheel);
+  /**
+   * @brief Override the priority of the messages of an interface.
+   * @param interface_name The interface name.
+   * @param priority The priority of its messages.
+   */
+  void set_interface_priority(std::string_view interface_name, AstarteSendPriority priority);
+  /**
+   * @brief Get the priority of a message.
+   * @param interface_name The interface of the message.
+   * @param is_property True for property messages, false for datastream messages.
+   * @return The priority overridden for the interface, or the default one for the message type.
+   */
+  [[nodiscard]] auto get_priority(std::string_view interface_name, bool is_property)
+      -> AstarteSendPriority;
+  /**
+   * @brief Submit a send, starting it right away if its lane has a free slot.
+   * @param priority The lane of the send.
+   * @param start Function starting the send, possibly on the calling thread.
+   * @param on_done Callback invoked once the send has completed, or with a cancelled status if the
+   * scheduler is closed before the send is started.
+   */
+  void submit(AstarteSendPriority priority, StartSend start, OnDone on_done);
+  /**
+   * @brief Submit a send after a delay.
+   * @param delay The delay, rounded up to the milliseconds.
+   * @param priority The lane of the send.
+   * @param start Function starting the send, possibly on the timer wheel thread.
+   * @param on_done Callback invoked once the send has completed, or with a cancelled status if the
+   * scheduler is closed before the send is started.
+   */
+  void submit_after(std::chrono::nanoseconds delay, AstarteSendPriority priority, StartSend start,
+                    OnDone on_done);
+  /**
+   * @brief Get the counters of a lane.
+   * @param priority The lane.
+   * @return The counters of the lane.
+   */
+  [[nodiscard]] auto get_stats(AstarteSendPriority priority) -> AstarteSendLaneStats;
+  /**
+   * @brief Cancel the queued sends and refuse the new ones, waiting for the sends being started.
+   */
+  void close();
+
+ private:
+  struct Pending {
+    StartSend start;
+    OnDone on_done;
+    std::chrono::steady_clock::time_point enqueued;
+  };
+  struct Lane {
+    std::size_t window;
+    std::size_t in_flight{0};
+    std::deque<Pending> queue{};
+    uint64_t sent{0};
+    std::chrono::steady_clock::duration total_wait{0};
+    std::chrono::steady_clock::duration max_wait{0};
+  };
+
+  void dispatch(std::unique_lock<std::mutex>& lock);
+  void complete(AstarteSendPriority priority);
+
+  TimerWheel& wheel_;
+  std::mutex mutex_;
+  std::condition_variable idle_cv_;
+  std::array<Lane, 2> lanes_;
+  std::size_t starting_{0};
+  bool closed_{false};
+  // Lets the devices without overrides skip the lookup
+  std::atomic_bool has_overrides_{false};
+  StringMap<AstarteSendPriority> overrides_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // OUTBOUND_SCHEDULER_H
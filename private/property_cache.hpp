@@ -0,0 +1,144 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef PROPERTY_CACHE_H
+#define PROPERTY_CACHE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/ownership.hpp"
+#include "astarte_device_sdk/property.hpp"
+#include "astarte_device_sdk/stored_property.hpp"
+#include "string_map.hpp"
+
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief In-process cache of the properties of a device.
+ * @details The cache content is an immutable snapshot, replaced atomically by the writers. Reads
+ * never wait for the writers, they only load the snapshot pointer, which the standard library may
+ * still protect with a short internal lock. Writes are serialized and copy only the modified bucket
+ * of the modified interface, sharing the rest with the previous snapshot.
+ */
+class PropertyCache {
+ public:
+  /**
+   * @brief Enable or disable the cache. A disabled cache never reports a hit.
+   * @param enabled True to enable the cache, false otherwise.
+   */
+  void set_enabled(bool enabled);
+  /**
+   * @brief Check if the cache is enabled.
+   * @return True if the cache is enabled, false otherwise.
+   */
+  [[nodiscard]] auto is_enabled() const -> bool;
+  /**
+   * @brief Register an interface of the device.
+   * @details Only properties interfaces are cached, other interfaces are ignored.
+   * @param json The interface definition as a JSON string.
+   */
+  void add_interface(std::string_view json);
+  /**
+   * @brief Remove an interface and all of its cached properties.
+   * @param interface_name The interface name.
+   */
+  void remove_interface(std::string_view interface_name);
+  /**
+   * @brief Signal that a full snapshot of the properties has been requested.
+   * @details Updates received from now on take precedence over the content of the snapshot.
+   * @return The generation of the snapshot, to be passed to load_snapshot.
+   */
+  auto begin_snapshot() -> uint64_t;
+  /**
+   * @brief Load a full snapshot of the properties, as returned by the message hub.
+   * @details All the registered interfaces become complete, meaning that properties not present in
+   * the cache are known to be unset. Snapshots requested before the last call to invalidate or to
+   * begin_snapshot are outdated, and are discarded.
+   * @param generation The generation returned by begin_snapshot.
+   * @param properties All the stored properties of the device.
+   */
+  void load_snapshot(uint64_t generation, const std::list<AstarteStoredProperty>& properties);
+  /** @brief Drop all the cached values and the pending snapshot, the interfaces stay registered. */
+  void invalidate();
+  /**
+   * @brief Update a single property.
+   * @param interface_name The interface of the property.
+   * @param path The path of the property.
+   * @param value The new value of the property, std::nullopt if the property has been unset.
+   */
+  void update(std::string_view interface_name, std::string_view path,
+              const std::optional<AstarteData>& value);
+  /**
+   * @brief Look up a single property.
+   * @param interface_name The interface of the property.
+   * @param path The path of the property.
+   * @return The property on a cache hit, std::nullopt on a cache miss.
+   */
+  [[nodiscard]] auto get_property(std::string_view interface_name, std::string_view path) const
+      -> std::optional<AstartePropertyIndividual>;
+  /**
+   * @brief Look up all the properties of an interface.
+   * @param interface_name The interface name.
+   * @return The properties if the interface is complete, std::nullopt otherwise.
+   */
+  [[nodiscard]] auto get_properties(std::string_view interface_name) const
+      -> std::optional<std::list<AstarteStoredProperty>>;
+  /**
+   * @brief Look up all the properties matching the ownership filter.
+   * @param ownership Optional ownership filter.
+   * @return The properties if all the matching interfaces are complete, std::nullopt otherwise.
+   */
+  [[nodiscard]] auto get_all_properties(const std::optional<AstarteOwnership>& ownership) const
+      -> std::optional<std::list<AstarteStoredProperty>>;
+
+ private:
+  // A value of std::nullopt is a property known to be unset
+  using ValueBucket = StringMap<std::optional<AstarteData>>;
+  // The values of an interface are split by the hash of their path, so that a write copies a
+  // single bucket
+  static constexpr std::size_t VALUE_BUCKETS = 16;
+  struct InterfaceProperties {
+    int32_t version_major{0};
+    AstarteOwnership ownership{AstarteOwnership::kDevice};
+    // When complete, a path missing from the values is known to be unset
+    bool complete{false};
+    // Null for the empty buckets, the others are shared between the snapshots
+    std::array<std::shared_ptr<const ValueBucket>, VALUE_BUCKETS> values;
+  };
+  using Snapshot = StringMap<std::shared_ptr<const InterfaceProperties>>;
+
+  [[nodiscard]] auto load() const -> std::shared_ptr<const Snapshot>;
+  static auto bucket_index(std::string_view path) -> std::size_t;
+  static auto find_value(const InterfaceProperties& interface, std::string_view path)
+      -> const std::optional<AstarteData>*;
+  static void set_value(InterfaceProperties& interface, std::string_view path,
+                        const std::optional<AstarteData>& value);
+  static void append_properties(const std::string& interface_name,
+                                const InterfaceProperties& interface,
+                                std::list<AstarteStoredProperty>& properties);
+
+  std::atomic_bool enabled_{false};
+  std::atomic<std::shared_ptr<const Snapshot>> snapshot_{std::make_shared<const Snapshot>()};
+  // Serializes the writers, readers only load the snapshot
+  std::mutex write_mutex_;
+  bool snapshot_pending_{false};
+  uint64_t generation_{0};
+  std::set<std::pair<std::string, std::string>> updated_while_pending_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // PROPERTY_CACHE_H
@@ -0,0 +1,88 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef PROPERTY_DEDUP_H
+#define PROPERTY_DEDUP_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+
+#include "astarte_device_sdk/data.hpp"
+#include "string_map.hpp"
+
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief Table of the last value successfully sent for each device property.
+ * @details Used to skip setting a property to the value it already has. Each entry stores a hash
+ * of the value, so that most changed values are detected without a full comparison.
+ */
+class PropertyDedupTable {
+ public:
+  /**
+   * @brief Enable or disable the table. A disabled table never reports a redundant value.
+   * @param enabled True to enable the table, false otherwise.
+   */
+  void set_enabled(bool enabled);
+  /**
+   * @brief Check if the table is enabled.
+   * @return True if the table is enabled, false otherwise.
+   */
+  [[nodiscard]] auto is_enabled() const -> bool;
+  /**
+   * @brief Check if setting a property would be redundant, counting it as suppressed if so.
+   * @param interface_name The interface of the property.
+   * @param path The path of the property.
+   * @param data The value that should be set.
+   * @return True if the value is the last one successfully sent, false otherwise.
+   */
+  auto suppress(std::string_view interface_name, std::string_view path, const AstarteData& data)
+      -> bool;
+  /**
+   * @brief Record a value successfully sent.
+   * @param interface_name The interface of the property.
+   * @param path The path of the property.
+   * @param data The value that has been sent.
+   */
+  void record(std::string_view interface_name, std::string_view path, const AstarteData& data);
+  /**
+   * @brief Forget the last value of a property, as when the property is unset.
+   * @param interface_name The interface of the property.
+   * @param path The path of the property.
+   */
+  void forget(std::string_view interface_name, std::string_view path);
+  /** @brief Forget all the recorded values. */
+  void clear();
+  /**
+   * @brief Get the number of redundant sends suppressed so far.
+   * @return The number of suppressed sends.
+   */
+  [[nodiscard]] auto get_suppressed_count() const -> uint64_t;
+
+  /**
+   * @brief Compute the hash of an Astarte data.
+   * @param data The data to hash.
+   * @return The hash of the data, equal data always have the same hash.
+   */
+  static auto hash(const AstarteData& data) -> std::size_t;
+
+ private:
+  struct Entry {
+    std::size_t hash;
+    AstarteData data;
+  };
+
+  std::atomic_bool enabled_{false};
+  std::atomic<uint64_t> suppressed_{0};
+  std::mutex mutex_;
+  // Indexed by interface and then by path
+  StringMap<StringMap<Entry>> entries_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // PROPERTY_DEDUP_H
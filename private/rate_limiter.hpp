@@ -0,0 +1,173 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef RATE_LIMITER_H
+#define RATE_LIMITER_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string_view>
+
+#include "astarte_device_sdk/rate_limit.hpp"
+#include "string_map.hpp"
+
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief Lock-free rate limiter implementing the generic cell rate algorithm.
+ * @details The bucket only stores the theoretical arrival time of the next unit, updated with a
+ * compare and swap, which is equivalent to a token bucket without a refill step.
+ */
+class GcraBucket {
+ public:
+  /**
+   * @brief Constructor for the GcraBucket class.
+   * @param per_second The sustained rate, in units per second.
+   * @param burst The number of units that can be admitted at once.
+   */
+  GcraBucket(double per_second, uint64_t burst);
+  /**
+   * @brief Take some units from the bucket, if available.
+   * @param cost The number of units.
+   * @param now The current time.
+   * @return Zero if the units have been taken, otherwise the time until they are available.
+   */
+  auto try_acquire(uint64_t cost, std::chrono::steady_clock::time_point now)
+      -> std::chrono::nanoseconds;
+  /**
+   * @brief Take some units from the bucket, borrowing them from the future if needed.
+   * @param cost The number of units.
+   * @param now The current time.
+   * @return The time until the units are actually available, zero if they are already.
+   */
+  auto reserve(uint64_t cost, std::chrono::steady_clock::time_point now)
+      -> std::chrono::nanoseconds;
+  /**
+   * @brief Give back units taken from the bucket.
+   * @param cost The number of units.
+   */
+  void refund(uint64_t cost);
+
+ private:
+  auto increment(uint64_t cost) const -> int64_t;
+
+  double interval_;
+  int64_t tolerance_;
+  // Nanoseconds on the steady clock
+  std::atomic<int64_t> theoretical_arrival_{0};
+};
+
+/**
+ * @brief Rate limits configured on a device, for the whole device and for single interfaces.
+ * @details Messages of an interface must fit both the interface and the device limits. When a limit
+ * is exceeded its own over limit behavior applies. Each check looks up the configuration under a
+ * shared lock, so the sending threads of a device with limits share its reader count, while the
+ * accounting itself never locks.
+ */
+class RateLimiter {
+ public:
+  /** @brief Outcome of the check of a message. */
+  struct Admission {
+    /** @brief What the caller should do with the message. */
+    enum class Action : uint8_t {
+      /** @brief Send the message now. */
+      kSend,
+      /** @brief Wait for the delay, then send the message. */
+      kWait,
+      /** @brief Send the message in the background after the delay. */
+      kDefer,
+      /** @brief Drop the message. */
+      kDrop
+    };
+    /** @brief What the caller should do with the message. */
+    Action action{Action::kSend};
+    /** @brief Time before the message can be sent. */
+    std::chrono::nanoseconds delay{0};
+  };
+
+  /**
+   * @brief Set the limit of the whole device.
+   * @param limit The limit, std::nullopt to remove it.
+   */
+  void set_device_limit(const std::optional<AstarteRateLimit>& limit);
+  /**
+   * @brief Set the limit of an interface.
+   * @param interface_name The interface name.
+   * @param limit The limit, std::nullopt to remove it.
+   */
+  void set_interface_limit(std::string_view interface_name,
+                           const std::optional<AstarteRateLimit>& limit);
+  /**
+   * @brief Check if any limit is configured.
+   * @return True if at least one limit is configured.
+   */
+  [[nodiscard]] auto is_enabled() const -> bool;
+  /**
+   * @brief Check a message against the limits, taking its share of them unless dropped.
+   * @details Messages that must wait borrow from the future, so later messages queue behind them.
+   * @param interface_name The interface of the message.
+   * @param bytes The encoded size of the message.
+   * @param now The current time.
+   * @return The outcome of the check.
+   */
+  auto admit(std::string_view interface_name, std::size_t bytes,
+             std::chrono::steady_clock::time_point now) -> Admission;
+  /**
+   * @brief Check a message against the limits without borrowing from the future.
+   * @details Used by manual drive, which retries the message at the next iteration instead of
+   * waiting. The delay of a kWait outcome is the time until the retry.
+   * @param interface_name The interface of the message.
+   * @param bytes The encoded size of the message.
+   * @param now The current time.
+   * @return The outcome of the check, either kSend, kWait or kDrop.
+   */
+  auto try_admit(std::string_view interface_name, std::size_t bytes,
+                 std::chrono::steady_clock::time_point now) -> Admission;
+  /**
+   * @brief Get the counters of the checked messages.
+   * @return The counters.
+   */
+  [[nodiscard]] auto get_stats() const -> AstarteRateLimitStats;
+
+ private:
+  struct Limit {
+    explicit Limit(const AstarteRateLimit& limit);
+    // Takes both the message and the bytes, or nothing
+    auto try_acquire(std::size_t size, std::chrono::steady_clock::time_point now)
+        -> std::chrono::nanoseconds;
+    auto reserve(std::size_t size, std::chrono::steady_clock::time_point now)
+        -> std::chrono::nanoseconds;
+    void refund(std::size_t size);
+
+    AstarteRateLimit::OverLimit over_limit;
+    std::optional<GcraBucket> messages;
+    std::optional<GcraBucket> bytes;
+  };
+  // The interface limit first, then the device one, absent limits are null
+  using Limits = std::array<std::shared_ptr<Limit>, 2>;
+
+  auto find_limits(std::string_view interface_name) -> Limits;
+  static void refund(const Limits& limits, std::size_t count, std::size_t bytes);
+  void count(const Admission& admission);
+
+  // Lets the devices without limits skip the lookup
+  std::atomic_bool has_limits_{false};
+  std::atomic<uint64_t> admitted_{0};
+  std::atomic<uint64_t> delayed_{0};
+  std::atomic<uint64_t> deferred_{0};
+  std::atomic<uint64_t> dropped_{0};
+  std::shared_mutex mutex_;
+  std::shared_ptr<Limit> device_limit_;
+  StringMap<std::shared_ptr<Limit>> interface_limits_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // RATE_LIMITER_H
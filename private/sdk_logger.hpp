@@ -0,0 +1,30 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef SDK_LOGGER_H
+#define SDK_LOGGER_H
+
+#include <spdlog/logger.h>
+#include <spdlog/spdlog.h>
+
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief Get the logger of the library.
+ * @details Registered in spdlog as "astarte_device_sdk", its lines are formatted by the caller
+ * and written by a dedicated thread, see set_log_callback.
+ * @return The logger, valid until the end of the process.
+ */
+auto sdk_logger() -> spdlog::logger*;
+
+}  // namespace AstarteDeviceSdk
+
+// Trace and debug logs are removed at compile time below the level set by SPDLOG_ACTIVE_LEVEL
+#define ASTARTE_LOG_TRACE(...) SPDLOG_LOGGER_TRACE(AstarteDeviceSdk::sdk_logger(), __VA_ARGS__)
+#define ASTARTE_LOG_DEBUG(...) SPDLOG_LOGGER_DEBUG(AstarteDeviceSdk::sdk_logger(), __VA_ARGS__)
+#define ASTARTE_LOG_INFO(...) AstarteDeviceSdk::sdk_logger()->info(__VA_ARGS__)
+#define ASTARTE_LOG_WARN(...) AstarteDeviceSdk::sdk_logger()->warn(__VA_ARGS__)
+#define ASTARTE_LOG_ERROR(...) AstarteDeviceSdk::sdk_logger()->error(__VA_ARGS__)
+
+#endif  // SDK_LOGGER_H
@@ -0,0 +1,83 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef SEND_PIPELINE_H
+#define SEND_PIPELINE_H
+
+#include <grpcpp/grpcpp.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "string_map.hpp"
+
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief Run many sends concurrently, preserving the order of the sends sharing the same key.
+ * @details At most a fixed number of sends are in flight at once. A send is started only after all
+ * the previous sends with the same key have completed, sends with different keys may complete in
+ * any order.
+ */
+class SendPipeline {
+ public:
+  /** @brief Callback invoked once a send has completed. */
+  using OnDone = std::function<void(const grpc::Status&)>;
+  /** @brief Function starting the send with the given index, it must eventually call on_done. */
+  using StartSend = std::function<void(std::size_t index, OnDone on_done)>;
+
+  /**
+   * @brief Constructor for the send pipeline class.
+   * @param max_in_flight Maximum number of concurrent sends.
+   * @param start_send Function starting a single send.
+   */
+  SendPipeline(std::size_t max_in_flight, StartSend start_send);
+  /**
+   * @brief Run the sends and wait for their completion.
+   * @param keys The ordering key of each send, sends are identified by their index in this vector.
+   * @return The status of each send.
+   */
+  auto run(const std::vector<std::string>& keys) -> std::vector<grpc::Status>;
+  /**
+   * @brief Run independent sends, in any order, and wait for their completion.
+   * @param count The number of sends, identified by their index.
+   * @return The status of each send.
+   */
+  auto run(std::size_t count) -> std::vector<grpc::Status>;
+
+ private:
+  // Shared with the completion callbacks, that might still be running when run returns
+  struct State {
+    std::mutex mutex;
+    std::condition_variable done_cv;
+    std::size_t total{0};
+    // Empty for independent sends
+    std::vector<std::string> keys;
+    std::vector<grpc::Status> statuses;
+    // Pending sends of each key, the first one is ready or in flight
+    StringMap<std::deque<std::size_t>> queues;
+    std::deque<std::size_t> ready;
+    std::size_t in_flight{0};
+    std::size_t completed{0};
+    // Set while a thread is starting the ready sends, the others leave the new ones to it
+    bool starting{false};
+  };
+
+  auto wait(const std::shared_ptr<State>& state) -> std::vector<grpc::Status>;
+  static void start_ready(const std::shared_ptr<State>& state, std::size_t max_in_flight,
+                          const StartSend& start_send);
+
+  std::size_t max_in_flight_;
+  StartSend start_send_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // SEND_PIPELINE_H
@@ -8,20 +8,41 @@
 #include <chrono>
 #include <condition_variable>
 #include <cstddef>
+#include <cstdint>
 #include <mutex>
 #include <optional>
 #include <queue>
 
+#include "metrics_registry.hpp"
+
 namespace AstarteDeviceSdk {
 
 template <typename T>
 class SharedQueue {
  public:
+  /**
+   * @brief Constructor for the SharedQueue class.
+   * @param depth Gauge following the number of queued items, nullptr to skip it.
+   */
+  explicit SharedQueue(Gauge* depth = nullptr) : depth_(depth) {}
+  /** @brief Destructor for the SharedQueue class, the dropped items leave the gauge. */
+  ~SharedQueue() {
+    if (depth_ != nullptr) {
+      depth_->add(-static_cast<int64_t>(queue_.size()));
+    }
+  }
+  SharedQueue(const SharedQueue& other) = delete;
+  SharedQueue(SharedQueue&& other) = delete;
+  auto operator=(const SharedQueue& other) -> SharedQueue& = delete;
+  auto operator=(SharedQueue&& other) -> SharedQueue& = delete;
   auto pop(const std::chrono::milliseconds& timeout) -> std::optional<T> {
     std::unique_lock<std::mutex> mlock(mutex_);
     if (condition_.wait_for(mlock, timeout, [this] { return !queue_.empty(); })) {
       T res = queue_.front();
       queue_.pop();
+      if (depth_ != nullptr) {
+        depth_->add(-1);
+      }
       return res;
     }
     return std::nullopt;
@@ -29,6 +50,9 @@ class SharedQueue {
   void push(const T& item) {
     std::unique_lock<std::mutex> mlock(mutex_);
     queue_.push(item);
+    if (depth_ != nullptr) {
+      depth_->add(1);
+    }
     condition_.notify_one();
   }
   auto size() -> std::size_t {
@@ -44,6 +68,7 @@ class SharedQueue {
   std::queue<T> queue_;
   std::mutex mutex_;
   std::condition_variable condition_;
+  Gauge* depth_;
 };
 
 }  // namespace AstarteDeviceSdk
@@ -0,0 +1,30 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef STRING_MAP_H
+#define STRING_MAP_H
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace AstarteDeviceSdk {
+
+/** @brief Transparent hash, allowing lookups using string views. */
+struct StringHash {
+  using is_transparent = void;
+  auto operator()(std::string_view value) const -> std::size_t {
+    return std::hash<std::string_view>{}(value);
+  }
+};
+
+/** @brief Hash map with string keys, supporting lookups without allocating a key. */
+template <typename T>
+using StringMap = std::unordered_map<std::string, T, StringHash, std::equal_to<>>;
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // STRING_MAP_H
@@ -0,0 +1,81 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace AstarteDeviceSdk {
+
+/**
+ * @brief Hashed timer wheel running many coarse timers on a single thread.
+ * @details Timers are rounded up to the tick of the wheel, and never fire before their delay.
+ * Scheduling and expiring a timer take constant time, regardless of the number of pending timers.
+ * The thread is started by the first scheduled timer and sleeps while no timer is pending.
+ */
+class TimerWheel {
+ public:
+  /** @brief Callback invoked on the wheel thread when a timer expires. */
+  using Callback = std::function<void()>;
+
+  /**
+   * @brief Constructor for the TimerWheel class.
+   * @param tick The resolution of the timers.
+   * @param slots The number of slots of the wheel, timers longer than a full turn take more turns.
+   */
+  TimerWheel(std::chrono::milliseconds tick, std::size_t slots);
+  /** @brief Destructor for the TimerWheel class, pending timers are dropped. */
+  ~TimerWheel();
+  /** @brief Copy constructor for the TimerWheel class. */
+  TimerWheel(const TimerWheel& other) = delete;
+  /** @brief Move constructor for the TimerWheel class. */
+  TimerWheel(TimerWheel&& other) = delete;
+  /** @brief Copy assignment operator for the TimerWheel class. */
+  auto operator=(const TimerWheel& other) -> TimerWheel& = delete;
+  /** @brief Move assignment operator for the TimerWheel class. */
+  auto operator=(TimerWheel&& other) -> TimerWheel& = delete;
+
+  /**
+   * @brief Get the wheel shared by all the devices of the process.
+   * @return The shared wheel.
+   */
+  static auto shared() -> TimerWheel&;
+  /**
+   * @brief Schedule a timer.
+   * @details Timers can't be cancelled, callbacks should check if they are still relevant.
+   * @param delay The delay after which the callback is invoked.
+   * @param callback The callback.
+   */
+  void schedule(std::chrono::milliseconds delay, Callback callback);
+
+ private:
+  struct Timer {
+    uint64_t rounds;
+    Callback callback;
+  };
+
+  void run();
+
+  std::chrono::milliseconds tick_;
+  std::vector<std::vector<Timer>> slots_;
+  std::size_t cursor_{0};
+  std::size_t pending_{0};
+  std::chrono::steady_clock::time_point next_tick_;
+  bool stopping_{false};
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::thread thread_;
+};
+
+}  // namespace AstarteDeviceSdk
+
+#endif  // TIMER_WHEEL_H
@@ -0,0 +1,169 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "astarte_device_sdk/base64.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "astarte_device_sdk/exceptions.hpp"
+#include "base64_kernels.hpp"
+
+namespace AstarteDeviceSdk {
+
+namespace {
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+constexpr std::string_view BASE64_CHARS =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+    "abcdefghijklmnopqrstuvwxyz"
+    "0123456789+/";
+constexpr uint8_t INVALID_CHAR = 0xFF;
+
+constexpr auto make_decode_table() -> std::array<uint8_t, 256> {
+  std::array<uint8_t, 256> table{};
+  table.fill(INVALID_CHAR);
+  for (std::size_t index = 0; index < BASE64_CHARS.size(); index++) {
+    table.at(static_cast<unsigned char>(BASE64_CHARS[index])) = static_cast<uint8_t>(index);
+  }
+  return table;
+}
+
+constexpr std::array<uint8_t, 256> DECODE_TABLE = make_decode_table();
+
+auto encode_scalar(std::span<const uint8_t> data, char* out) -> std::size_t {
+  const std::size_t blocks = data.size() / 3;
+  for (std::size_t block = 0; block < blocks; block++) {
+    const uint8_t* bytes = data.data() + (block * 3);
+    const uint32_t chunk = (static_cast<uint32_t>(bytes[0]) << 16) |
+                           (static_cast<uint32_t>(bytes[1]) << 8) | bytes[2];
+    char* chars = out + (block * 4);
+    chars[0] = BASE64_CHARS[chunk >> 18];
+    chars[1] = BASE64_CHARS[(chunk >> 12) & 0x3F];
+    chars[2] = BASE64_CHARS[(chunk >> 6) & 0x3F];
+    chars[3] = BASE64_CHARS[chunk & 0x3F];
+  }
+  return blocks * 3;
+}
+
+auto decode_scalar(std::string_view text, uint8_t* out) -> std::size_t {
+  const std::size_t blocks = text.size() / 4;
+  for (std::size_t block = 0; block < blocks; block++) {
+    const char* chars = text.data() + (block * 4);
+    const uint32_t first = DECODE_TABLE[static_cast<unsigned char>(chars[0])];
+    const uint32_t second = DECODE_TABLE[static_cast<unsigned char>(chars[1])];
+    const uint32_t third = DECODE_TABLE[static_cast<unsigned char>(chars[2])];
+    const uint32_t fourth = DECODE_TABLE[static_cast<unsigned char>(chars[3])];
+    // The values of the alphabet fit in six bits, the invalid marker doesn't
+    if (((first | second | third | fourth) & 0xC0) != 0) {
+      return block * 4;
+    }
+    const uint32_t chunk = (first << 18) | (second << 12) | (third << 6) | fourth;
+    uint8_t* bytes = out + (block * 3);
+    bytes[0] = static_cast<uint8_t>(chunk >> 16);
+    bytes[1] = static_cast<uint8_t>(chunk >> 8);
+    bytes[2] = static_cast<uint8_t>(chunk);
+  }
+  return blocks * 4;
+}
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+constexpr Base64Kernels SCALAR_KERNELS = {"scalar", encode_scalar, decode_scalar};
+
+auto select_kernels() -> const Base64Kernels& {
+  const std::vector<const Base64Kernels*> kernels = base64_supported_kernels();
+  return *kernels.back();
+}
+
+}  // namespace
+
+auto base64_scalar_kernels() -> const Base64Kernels& { return SCALAR_KERNELS; }
+
+auto base64_supported_kernels() -> std::vector<const Base64Kernels*> {
+  std::vector<const Base64Kernels*> kernels = {&SCALAR_KERNELS};
+  for (const Base64Kernels* simd :
+       {base64_ssse3_kernels(), base64_avx2_kernels(), base64_neon_kernels()}) {
+    if (simd != nullptr) {
+      kernels.push_back(simd);
+    }
+  }
+  return kernels;
+}
+
+auto base64_kernels() -> const Base64Kernels& {
+  static const Base64Kernels& kernels = select_kernels();
+  return kernels;
+}
+
+void base64_encode(std::span<const uint8_t> data, std::string& out) {
+  const std::size_t start = out.size();
+  out.resize(start + base64_encoded_size(data.size()));
+  char* chars = out.data() + start;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  std::size_t encoded = base64_kernels().encode(data, chars);
+  const std::span<char> rest(out.begin() + static_cast<std::ptrdiff_t>(start + (encoded / 3 * 4)),
+                             out.end());
+  encoded += SCALAR_KERNELS.encode(data.subspan(encoded), rest.data());
+  // The last one or two bytes are padded to a whole block
+  const std::size_t remaining = data.size() - encoded;
+  if (remaining == 0) {
+    return;
+  }
+  uint32_t chunk = static_cast<uint32_t>(data[encoded]) << 16;
+  if (remaining == 2) {
+    chunk |= static_cast<uint32_t>(data[encoded + 1]) << 8;
+  }
+  const std::span<char> last = rest.last(4);
+  last[0] = BASE64_CHARS[chunk >> 18];
+  last[1] = BASE64_CHARS[(chunk >> 12) & 0x3F];
+  last[2] = (remaining == 2) ? BASE64_CHARS[(chunk >> 6) & 0x3F] : '=';
+  last[3] = '=';
+}
+
+auto base64_encode(std::span<const uint8_t> data) -> std::string {
+  std::string out;
+  base64_encode(data, out);
+  return out;
+}
+
+auto base64_decode(std::string_view text) -> std::vector<uint8_t> {
+  if (text.size() % 4 != 0) {
+    throw AstarteInvalidInputException("The base64 text length is not a multiple of four.");
+  }
+  if (text.empty()) {
+    return {};
+  }
+  std::size_t padding = 0;
+  if (text.back() == '=') {
+    padding = (text[text.size() - 2] == '=') ? 2 : 1;
+  }
+  std::vector<uint8_t> data(((text.size() / 4) * 3) - padding);
+  // All the blocks but the last, the only one that can be padded
+  const std::string_view body = text.substr(0, text.size() - 4);
+  std::size_t decoded = base64_kernels().decode(body, data.data());
+  decoded += SCALAR_KERNELS.decode(body.substr(decoded), &data.at(decoded / 4 * 3));
+  std::array<char, 4> last{};
+  text.substr(body.size()).copy(last.data(), last.size());
+  last.at(3) = (padding > 0) ? 'A' : last.at(3);
+  last.at(2) = (padding > 1) ? 'A' : last.at(2);
+  std::array<uint8_t, 3> bytes{};
+  if ((decoded != body.size()) ||
+      (SCALAR_KERNELS.decode(std::string_view(last.data(), last.size()), bytes.data()) == 0)) {
+    throw AstarteInvalidInputException("The base64 text contains invalid characters.");
+  }
+  std::copy(bytes.begin(), bytes.begin() + static_cast<std::ptrdiff_t>(3 - padding),
+            data.end() - static_cast<std::ptrdiff_t>(3 - padding));
+  return data;
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+auto base64_implementation() -> std::string_view { return base64_kernels().name; }
+
+}  // namespace AstarteDeviceSdk
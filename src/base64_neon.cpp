@@ -0,0 +1,131 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// NEON base64 kernels, always available on AArch64. The loads and the stores (de)interleave the
+// groups of three bytes and four characters, and the characters are looked up in 64 bytes tables.
+// The algorithms are the ones of the AArch64 kernels by Alfred Klomp, see
+// https://github.com/aklomp/base64
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+#include "base64_kernels.hpp"
+
+#ifdef __aarch64__
+#include <arm_neon.h>
+
+#include <array>
+#endif
+
+namespace AstarteDeviceSdk {
+
+#ifdef __aarch64__
+
+namespace {
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+constexpr std::string_view BASE64_CHARS =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+    "abcdefghijklmnopqrstuvwxyz"
+    "0123456789+/";
+constexpr uint8_t INVALID_VALUE = 0xFF;
+
+// Six bits values of the characters from first to first + 63, the invalid ones are 0xFF
+constexpr auto make_decode_table(std::size_t first) -> std::array<uint8_t, 64> {
+  std::array<uint8_t, 64> table{};
+  table.fill(INVALID_VALUE);
+  for (std::size_t index = 0; index < BASE64_CHARS.size(); index++) {
+    const auto character = static_cast<std::size_t>(BASE64_CHARS[index]);
+    if ((character >= first) && (character < first + table.size())) {
+      table.at(character - first) = static_cast<uint8_t>(index);
+    }
+  }
+  return table;
+}
+
+// The characters up to 63 and from 64 to 126, the first entry of the second table is the zero
+// looked up for all the characters of the first one
+constexpr std::array<uint8_t, 64> DECODE_TABLE_LOW = make_decode_table(0);
+constexpr std::array<uint8_t, 64> DECODE_TABLE_HIGH = [] {
+  std::array<uint8_t, 64> table = make_decode_table(63);
+  table.at(0) = 0;
+  return table;
+}();
+
+auto load_table(const uint8_t* table) -> uint8x16x4_t {
+  return {{vld1q_u8(table), vld1q_u8(table + 16), vld1q_u8(table + 32), vld1q_u8(table + 48)}};
+}
+
+auto encode_neon(std::span<const uint8_t> data, char* out) -> std::size_t {
+  const uint8x16x4_t table = load_table(reinterpret_cast<const uint8_t*>(BASE64_CHARS.data()));
+  const uint8x16_t low_six_bits = vdupq_n_u8(0x3F);
+  std::size_t index = 0;
+  for (; index + 48 <= data.size(); index += 48) {
+    // Three registers with the first, second and third bytes of 16 groups
+    const uint8x16x3_t bytes = vld3q_u8(data.data() + index);
+    uint8x16x4_t values;
+    values.val[0] = vshrq_n_u8(bytes.val[0], 2);
+    values.val[1] =
+        vandq_u8(vorrq_u8(vshrq_n_u8(bytes.val[1], 4), vshlq_n_u8(bytes.val[0], 4)), low_six_bits);
+    values.val[2] =
+        vandq_u8(vorrq_u8(vshrq_n_u8(bytes.val[2], 6), vshlq_n_u8(bytes.val[1], 2)), low_six_bits);
+    values.val[3] = vandq_u8(bytes.val[2], low_six_bits);
+    uint8x16x4_t chars;
+    for (std::size_t position = 0; position < 4; position++) {
+      chars.val[position] = vqtbl4q_u8(table, values.val[position]);
+    }
+    vst4q_u8(reinterpret_cast<uint8_t*>(out + (index / 3 * 4)), chars);
+  }
+  return index;
+}
+
+auto decode_neon(std::string_view text, uint8_t* out) -> std::size_t {
+  const uint8x16x4_t table_low = load_table(DECODE_TABLE_LOW.data());
+  const uint8x16x4_t table_high = load_table(DECODE_TABLE_HIGH.data());
+  const uint8x16_t high_offset = vdupq_n_u8(63);
+  std::size_t index = 0;
+  for (; index + 64 <= text.size(); index += 64) {
+    // Four registers with the first, second, third and fourth characters of 16 groups
+    uint8x16x4_t values = vld4q_u8(reinterpret_cast<const uint8_t*>(text.data() + index));
+    uint8x16_t invalid = vdupq_n_u8(0);
+    for (std::size_t position = 0; position < 4; position++) {
+      // The characters above 126 are out of both tables, they keep a value above 63
+      const uint8x16_t high_indices = vqsubq_u8(values.val[position], high_offset);
+      values.val[position] =
+          vorrq_u8(vqtbl4q_u8(table_low, values.val[position]),
+                   vqtbx4q_u8(high_indices, table_high, high_indices));
+      invalid = vorrq_u8(invalid, values.val[position]);
+    }
+    if (vmaxvq_u8(invalid) > 63) {
+      break;
+    }
+    uint8x16x3_t bytes;
+    bytes.val[0] = vorrq_u8(vshlq_n_u8(values.val[0], 2), vshrq_n_u8(values.val[1], 4));
+    bytes.val[1] = vorrq_u8(vshlq_n_u8(values.val[1], 4), vshrq_n_u8(values.val[2], 2));
+    bytes.val[2] = vorrq_u8(vshlq_n_u8(values.val[2], 6), values.val[3]);
+    vst3q_u8(out + (index / 4 * 3), bytes);
+  }
+  return index;
+}
+// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+constexpr Base64Kernels NEON_KERNELS = {"neon", encode_neon, decode_neon};
+
+}  // namespace
+
+auto base64_neon_kernels() -> const Base64Kernels* { return &NEON_KERNELS; }
+
+#else  // __aarch64__
+
+auto base64_neon_kernels() -> const Base64Kernels* { return nullptr; }
+
+#endif  // __aarch64__
+
+}  // namespace AstarteDeviceSdk
@@ -0,0 +1,227 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// SSSE3 and AVX2 base64 kernels. They are compiled for these instruction sets with the target
+// attribute, whatever the flags of the library, and are only used when the CPU supports them.
+// The algorithms are the ones by Wojciech Muła and Alfred Klomp, see
+// http://0x80.pl/notesen/2016-01-12-sse-base64-encoding.html and
+// http://0x80.pl/notesen/2016-01-17-sse-base64-decoding.html
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+#include "base64_kernels.hpp"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define ASTARTE_BASE64_X86
+#endif
+
+#ifdef ASTARTE_BASE64_X86
+#include <immintrin.h>
+
+#include <array>
+#include <cstring>
+#endif
+
+namespace AstarteDeviceSdk {
+
+#ifdef ASTARTE_BASE64_X86
+
+namespace {
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+
+// Spread each group of three bytes over four bytes holding six bits each
+__attribute__((target("ssse3"))) auto encode_reshuffle(__m128i bytes) -> __m128i {
+  const __m128i input =
+      _mm_shuffle_epi8(bytes, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+  const __m128i first_third =
+      _mm_mulhi_epu16(_mm_and_si128(input, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+  const __m128i second_fourth = _mm_mullo_epi16(
+      _mm_and_si128(input, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+  return _mm_or_si128(first_third, second_fourth);
+}
+
+// Map each six bits value to its character, adding the offset of its range of the alphabet
+__attribute__((target("ssse3"))) auto encode_translate(__m128i values) -> __m128i {
+  const __m128i offsets =
+      _mm_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0);
+  __m128i indices = _mm_subs_epu8(values, _mm_set1_epi8(51));
+  indices = _mm_sub_epi8(indices, _mm_cmpgt_epi8(values, _mm_set1_epi8(25)));
+  return _mm_add_epi8(values, _mm_shuffle_epi8(offsets, indices));
+}
+
+// Map each character to its six bits value, the result is false when a character is invalid
+__attribute__((target("ssse3"))) auto decode_translate(__m128i& chars) -> bool {
+  const __m128i lut_low = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                        0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+  const __m128i lut_high = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10,
+                                         0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+  const __m128i lut_offsets =
+      _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+  const __m128i mask_2f = _mm_set1_epi8(0x2F);
+  const __m128i high_nibbles = _mm_and_si128(_mm_srli_epi32(chars, 4), mask_2f);
+  const __m128i low_nibbles = _mm_and_si128(chars, mask_2f);
+  const __m128i high = _mm_shuffle_epi8(lut_high, high_nibbles);
+  const __m128i low = _mm_shuffle_epi8(lut_low, low_nibbles);
+  if (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_and_si128(low, high), _mm_setzero_si128())) != 0) {
+    return false;
+  }
+  // The slash shares the high nibble of the plus, it takes the offset before it
+  const __m128i slashes = _mm_cmpeq_epi8(chars, mask_2f);
+  chars = _mm_add_epi8(chars, _mm_shuffle_epi8(lut_offsets, _mm_add_epi8(slashes, high_nibbles)));
+  return true;
+}
+
+// Pack each group of four six bits values in three bytes, at the start of the register
+__attribute__((target("ssse3"))) auto decode_pack(__m128i values) -> __m128i {
+  const __m128i pairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+  const __m128i groups = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+  return _mm_shuffle_epi8(
+      groups, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+}
+
+// Reads 16 bytes for each 12 bytes encoded
+__attribute__((target("ssse3"))) auto encode_ssse3(std::span<const uint8_t> data, char* out)
+    -> std::size_t {
+  std::size_t index = 0;
+  for (; index + 16 <= data.size(); index += 12) {
+    const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data.data() + index));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + (index / 3 * 4)),
+                     encode_translate(encode_reshuffle(bytes)));
+  }
+  return index;
+}
+
+__attribute__((target("ssse3"))) auto decode_ssse3(std::string_view text, uint8_t* out)
+    -> std::size_t {
+  std::size_t index = 0;
+  for (; index + 16 <= text.size(); index += 16) {
+    __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text.data() + index));
+    if (!decode_translate(chars)) {
+      break;
+    }
+    alignas(16) std::array<uint8_t, 16> bytes{};
+    _mm_store_si128(reinterpret_cast<__m128i*>(bytes.data()), decode_pack(chars));
+    std::memcpy(out + (index / 4 * 3), bytes.data(), 12);
+  }
+  return index;
+}
+
+// The AVX2 kernels run the SSSE3 steps on both the 128 bits lanes
+__attribute__((target("avx2"))) auto encode_reshuffle(__m256i bytes) -> __m256i {
+  const __m256i input = _mm256_shuffle_epi8(
+      bytes, _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10, 1, 0, 2, 1, 4, 3,
+                              5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+  const __m256i first_third = _mm256_mulhi_epu16(
+      _mm256_and_si256(input, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+  const __m256i second_fourth = _mm256_mullo_epi16(
+      _mm256_and_si256(input, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+  return _mm256_or_si256(first_third, second_fourth);
+}
+
+__attribute__((target("avx2"))) auto encode_translate(__m256i values) -> __m256i {
+  const __m256i offsets =
+      _mm256_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0, 65, 71, -4,
+                       -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0);
+  __m256i indices = _mm256_subs_epu8(values, _mm256_set1_epi8(51));
+  indices = _mm256_sub_epi8(indices, _mm256_cmpgt_epi8(values, _mm256_set1_epi8(25)));
+  return _mm256_add_epi8(values, _mm256_shuffle_epi8(offsets, indices));
+}
+
+__attribute__((target("avx2"))) auto decode_translate(__m256i& chars) -> bool {
+  const __m256i lut_low = _mm256_setr_epi8(
+      0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B,
+      0x1A, 0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B,
+      0x1B, 0x1A);
+  const __m256i lut_high = _mm256_setr_epi8(
+      0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+      0x10, 0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+      0x10, 0x10);
+  const __m256i lut_offsets =
+      _mm256_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 19, 4,
+                       -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+  const __m256i mask_2f = _mm256_set1_epi8(0x2F);
+  const __m256i high_nibbles = _mm256_and_si256(_mm256_srli_epi32(chars, 4), mask_2f);
+  const __m256i low_nibbles = _mm256_and_si256(chars, mask_2f);
+  const __m256i high = _mm256_shuffle_epi8(lut_high, high_nibbles);
+  const __m256i low = _mm256_shuffle_epi8(lut_low, low_nibbles);
+  if (_mm256_testz_si256(low, high) == 0) {
+    return false;
+  }
+  const __m256i slashes = _mm256_cmpeq_epi8(chars, mask_2f);
+  chars = _mm256_add_epi8(chars,
+                          _mm256_shuffle_epi8(lut_offsets, _mm256_add_epi8(slashes, high_nibbles)));
+  return true;
+}
+
+// Also moves the 12 bytes of the high lane next to the ones of the low lane
+__attribute__((target("avx2"))) auto decode_pack(__m256i values) -> __m256i {
+  const __m256i pairs = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+  const __m256i groups = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+  const __m256i packed = _mm256_shuffle_epi8(
+      groups, _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1, 2, 1, 0, 6,
+                               5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+  return _mm256_permutevar8x32_epi32(packed, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+}
+
+// Reads 28 bytes for each 24 bytes encoded, each lane takes 12 of them
+__attribute__((target("avx2"))) auto encode_avx2(std::span<const uint8_t> data, char* out)
+    -> std::size_t {
+  std::size_t index = 0;
+  for (; index + 28 <= data.size(); index += 24) {
+    const uint8_t* bytes = data.data() + index;
+    const __m256i input = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes))),
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + 12)), 1);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + (index / 3 * 4)),
+                        encode_translate(encode_reshuffle(input)));
+  }
+  return index;
+}
+
+__attribute__((target("avx2"))) auto decode_avx2(std::string_view text, uint8_t* out)
+    -> std::size_t {
+  std::size_t index = 0;
+  for (; index + 32 <= text.size(); index += 32) {
+    __m256i chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text.data() + index));
+    if (!decode_translate(chars)) {
+      break;
+    }
+    alignas(32) std::array<uint8_t, 32> bytes{};
+    _mm256_store_si256(reinterpret_cast<__m256i*>(bytes.data()), decode_pack(chars));
+    std::memcpy(out + (index / 4 * 3), bytes.data(), 24);
+  }
+  return index;
+}
+// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+constexpr Base64Kernels SSSE3_KERNELS = {"ssse3", encode_ssse3, decode_ssse3};
+constexpr Base64Kernels AVX2_KERNELS = {"avx2", encode_avx2, decode_avx2};
+
+}  // namespace
+
+auto base64_ssse3_kernels() -> const Base64Kernels* {
+  return (__builtin_cpu_supports("ssse3") != 0) ? &SSSE3_KERNELS : nullptr;
+}
+
+auto base64_avx2_kernels() -> const Base64Kernels* {
+  return (__builtin_cpu_supports("avx2") != 0) ? &AVX2_KERNELS : nullptr;
+}
+
+#else  // ASTARTE_BASE64_X86
+
+auto base64_ssse3_kernels() -> const Base64Kernels* { return nullptr; }
+
+auto base64_avx2_kernels() -> const Base64Kernels* { return nullptr; }
+
+#endif  // ASTARTE_BASE64_X86
+
+}  // namespace AstarteDeviceSdk
@@ -0,0 +1,22 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "astarte_device_sdk/compression.hpp"
+
+#include <cstddef>
+
+namespace AstarteDeviceSdk {
+
+AstarteCompression::AstarteCompression(Algorithm algorithm) : algorithm_(algorithm) {}
+
+auto AstarteCompression::with_min_size(std::size_t bytes) -> AstarteCompression& {
+  min_size_ = bytes;
+  return *this;
+}
+
+auto AstarteCompression::get_algorithm() const -> Algorithm { return algorithm_; }
+
+auto AstarteCompression::get_min_size() const -> std::size_t { return min_size_; }
+
+}  // namespace AstarteDeviceSdk
@@ -0,0 +1,36 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "astarte_device_sdk/datastream_aggregation.hpp"
+
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace AstarteDeviceSdk {
+
+AstarteDatastreamAggregation::AstarteDatastreamAggregation(std::string object_interface_name,
+                                                           std::chrono::milliseconds window)
+    : object_interface_name_(std::move(object_interface_name)), window_(window) {}
+
+auto AstarteDatastreamAggregation::with_fields(std::vector<std::string> fields)
+    -> AstarteDatastreamAggregation& {
+  fields_ = std::move(fields);
+  return *this;
+}
+
+auto AstarteDatastreamAggregation::get_object_interface_name() const -> const std::string& {
+  return object_interface_name_;
+}
+
+auto AstarteDatastreamAggregation::get_window() const -> std::chrono::milliseconds {
+  return window_;
+}
+
+auto AstarteDatastreamAggregation::get_fields() const -> const std::vector<std::string>& {
+  return fields_;
+}
+
+}  // namespace AstarteDeviceSdk
@@ -0,0 +1,259 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "datastream_aggregator.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/datastream_aggregation.hpp"
+#include "astarte_device_sdk/object.hpp"
+#include "sdk_logger.hpp"
+#include "timer_wheel.hpp"
+
+namespace AstarteDeviceSdk {
+
+DatastreamAggregator::DatastreamAggregator(TimerWheel& wheel, Flush flush)
+    : wheel_(wheel), flush_(std::move(flush)) {}
+
+void DatastreamAggregator::set_aggregation(std::string_view interface_name,
+                                           const AstarteDatastreamAggregation& aggregation) {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  auto iter = interfaces_.find(interface_name);
+  if (iter == interfaces_.end()) {
+    interfaces_.emplace(std::string(interface_name), InterfaceState{aggregation, {}});
+  } else {
+    // Open windows keep their deadline and are sent with the new configuration
+    iter->second.aggregation = aggregation;
+  }
+  has_aggregations_.store(true, std::memory_order_release);
+}
+
+auto DatastreamAggregator::remove_aggregation(std::string_view interface_name)
+    -> std::vector<AggregatedObject> {
+  std::vector<AggregatedObject> closed;
+  const std::lock_guard<std::mutex> lock(mutex_);
+  auto iter = interfaces_.find(interface_name);
+  if (iter == interfaces_.end()) {
+    return closed;
+  }
+  for (auto& [path, window] : iter->second.windows) {
+    closed.push_back(close_window(iter->first, iter->second, path, window));
+  }
+  interfaces_.erase(iter);
+  has_aggregations_.store(!interfaces_.empty(), std::memory_order_release);
+  return closed;
+}
+
+auto DatastreamAggregator::aggregate(std::string_view interface_name, std::string_view path,
+                                     const AstarteData& data,
+                                     const std::chrono::system_clock::time_point* timestamp,
+                                     std::vector<AggregatedObject>& ready) -> bool {
+  if (!has_aggregations_.load(std::memory_order_acquire)) {
+    return false;
+  }
+
+  // The last segment of the path is the field, the rest is the common path of the object
+  const std::size_t separator = path.rfind('/');
+  if ((separator == std::string_view::npos) || (separator + 1 == path.size())) {
+    return false;
+  }
+  const std::string_view common_path =
+      (separator == 0) ? std::string_view("/") : path.substr(0, separator);
+  const std::string field(path.substr(separator + 1));
+
+  std::optional<uint64_t> opened;
+  std::chrono::milliseconds window_duration{0};
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    auto interface_iter = interfaces_.find(interface_name);
+    if (interface_iter == interfaces_.end()) {
+      return false;
+    }
+    InterfaceState& interface = interface_iter->second;
+
+    auto window_iter = interface.windows.find(common_path);
+    if ((window_iter != interface.windows.end()) &&
+        (window_iter->second.object.find(field) != window_iter->second.object.end())) {
+      // A repeated field starts a new window, the current one is sent as it is
+      ready.push_back(close_window(interface_name, interface, common_path, window_iter->second));
+      interface.windows.erase(window_iter);
+      window_iter = interface.windows.end();
+    }
+    if (window_iter == interface.windows.end()) {
+      window_duration = interface.aggregation.get_window();
+      Window window{next_window_id_++, {}, std::nullopt,
+                    std::chrono::steady_clock::now() + window_duration};
+      if (timestamp != nullptr) {
+        window.timestamp = *timestamp;
+      }
+      window_iter = interface.windows.emplace(std::string(common_path), std::move(window)).first;
+      if (!manual_expiry_) {
+        opened = window_iter->second.id;
+      }
+    }
+
+    Window& window = window_iter->second;
+    window.object.insert(field, data);
+    const std::vector<std::string>& fields = interface.aggregation.get_fields();
+    const bool complete =
+        !fields.empty() && std::ranges::all_of(fields, [&window](const std::string& name) {
+          return window.object.find(name) != window.object.end();
+        });
+    if (complete) {
+      ready.push_back(close_window(interface_name, interface, common_path, window));
+      interface.windows.erase(window_iter);
+      opened.reset();
+    }
+  }
+
+  if (opened.has_value()) {
+    schedule_expiry(window_duration, std::string(interface_name), std::string(common_path),
+                    opened.value());
+  }
+  return true;
+}
+
+void DatastreamAggregator::set_manual_expiry(bool enabled) {
+  struct OpenWindow {
+    std::chrono::milliseconds delay;
+    std::string interface_name;
+    std::string path;
+    uint64_t id;
+  };
+  std::vector<OpenWindow> open;
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    if (manual_expiry_ == enabled) {
+      return;
+    }
+    manual_expiry_ = enabled;
+    if (enabled) {
+      // The timers already scheduled find the manual expiry and leave the windows alone
+      return;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    for (const auto& [name, interface] : interfaces_) {
+      for (const auto& [path, window] : interface.windows) {
+        const auto delay = std::chrono::ceil<std::chrono::milliseconds>(
+            std::max(window.deadline - now, std::chrono::steady_clock::duration::zero()));
+        open.push_back({delay, name, path, window.id});
+      }
+    }
+  }
+  for (OpenWindow& window : open) {
+    schedule_expiry(window.delay, std::move(window.interface_name), std::move(window.path),
+                    window.id);
+  }
+}
+
+auto DatastreamAggregator::take_expired(std::chrono::steady_clock::time_point now)
+    -> std::vector<AggregatedObject> {
+  std::vector<AggregatedObject> expired;
+  const std::lock_guard<std::mutex> lock(mutex_);
+  for (auto& [name, interface] : interfaces_) {
+    for (auto iter = interface.windows.begin(); iter != interface.windows.end();) {
+      if (iter->second.deadline > now) {
+        iter++;
+        continue;
+      }
+      expired.push_back(close_window(name, interface, iter->first, iter->second));
+      iter = interface.windows.erase(iter);
+    }
+  }
+  return expired;
+}
+
+auto DatastreamAggregator::get_next_deadline()
+    -> std::optional<std::chrono::steady_clock::time_point> {
+  std::optional<std::chrono::steady_clock::time_point> next;
+  const std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto& [name, interface] : interfaces_) {
+    for (const auto& [path, window] : interface.windows) {
+      if (!next.has_value() || (window.deadline < next.value())) {
+        next = window.deadline;
+      }
+    }
+  }
+  return next;
+}
+
+auto DatastreamAggregator::take_all() -> std::vector<AggregatedObject> {
+  std::vector<AggregatedObject> closed;
+  const std::lock_guard<std::mutex> lock(mutex_);
+  for (auto& [name, interface] : interfaces_) {
+    for (auto& [path, window] : interface.windows) {
+      closed.push_back(close_window(name, interface, path, window));
+    }
+    interface.windows.clear();
+  }
+  return closed;
+}
+
+void DatastreamAggregator::close() {
+  const std::lock_guard<std::mutex> lock(flush_mutex_);
+  flush_ = nullptr;
+}
+
+auto DatastreamAggregator::close_window(std::string_view interface_name,
+                                        const InterfaceState& interface, std::string_view path,
+                                        Window& window) -> AggregatedObject {
+  return AggregatedObject{interface.aggregation.get_object_interface_name(),
+                          std::string(interface_name), std::string(path), std::move(window.object),
+                          window.timestamp};
+}
+
+void DatastreamAggregator::schedule_expiry(std::chrono::milliseconds delay,
+                                           std::string interface_name, std::string path,
+                                           uint64_t id) {
+  wheel_.schedule(delay, [weak = weak_from_this(), interface = std::move(interface_name),
+                          common = std::move(path), id] {
+    if (auto self = weak.lock()) {
+      self->expire(interface, common, id);
+    }
+  });
+}
+
+void DatastreamAggregator::expire(const std::string& interface_name, const std::string& path,
+                                  uint64_t id) {
+  std::optional<AggregatedObject> expired;
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    if (manual_expiry_) {
+      return;
+    }
+    auto interface_iter = interfaces_.find(interface_name);
+    if (interface_iter == interfaces_.end()) {
+      return;
+    }
+    InterfaceState& interface = interface_iter->second;
+    auto window_iter = interface.windows.find(path);
+    // The window might have been sent already, and possibly replaced by a newer one
+    if ((window_iter == interface.windows.end()) || (window_iter->second.id != id)) {
+      return;
+    }
+    expired = close_window(interface_name, interface, path, window_iter->second);
+    interface.windows.erase(window_iter);
+  }
+
+  const std::lock_guard<std::mutex> lock(flush_mutex_);
+  if (!flush_) {
+    ASTARTE_LOG_WARN("Dropping an aggregated object of {}, the device has been closed.",
+                     expired->interface_name);
+    return;
+  }
+  flush_(std::move(expired.value()));
+}
+
+}  // namespace AstarteDeviceSdk
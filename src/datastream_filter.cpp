@@ -0,0 +1,42 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "astarte_device_sdk/datastream_filter.hpp"
+
+#include <chrono>
+#include <optional>
+
+namespace AstarteDeviceSdk {
+
+AstarteDatastreamFilter::AstarteDatastreamFilter(Kind kind, double threshold)
+    : kind_(kind), threshold_(threshold) {}
+
+auto AstarteDatastreamFilter::change_only() -> AstarteDatastreamFilter {
+  return {Kind::kChangeOnly, 0.0};
+}
+
+auto AstarteDatastreamFilter::absolute_deadband(double threshold) -> AstarteDatastreamFilter {
+  return {Kind::kAbsoluteDeadband, threshold};
+}
+
+auto AstarteDatastreamFilter::relative_deadband(double ratio) -> AstarteDatastreamFilter {
+  return {Kind::kRelativeDeadband, ratio};
+}
+
+auto AstarteDatastreamFilter::with_max_silence(std::chrono::milliseconds max_silence)
+    -> AstarteDatastreamFilter& {
+  max_silence_ = max_silence;
+  return *this;
+}
+
+auto AstarteDatastreamFilter::get_kind() const -> Kind { return kind_; }
+
+auto AstarteDatastreamFilter::get_threshold() const -> double { return threshold_; }
+
+auto AstarteDatastreamFilter::get_max_silence() const
+    -> const std::optional<std::chrono::milliseconds>& {
+  return max_silence_;
+}
+
+}  // namespace AstarteDeviceSdk
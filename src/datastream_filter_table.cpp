@@ -0,0 +1,243 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "datastream_filter_table.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/datastream_filter.hpp"
+#include "astarte_device_sdk/object.hpp"
+
+namespace AstarteDeviceSdk {
+
+namespace {
+
+// Individual samples are stored as an object with a single unnamed field
+const std::string INDIVIDUAL_FIELD;
+
+auto as_number(const AstarteData& data) -> std::optional<double> {
+  const auto& raw = data.get_raw_data();
+  if (const auto* value = std::get_if<int32_t>(&raw)) {
+    return static_cast<double>(*value);
+  }
+  if (const auto* value = std::get_if<int64_t>(&raw)) {
+    return static_cast<double>(*value);
+  }
+  if (const auto* value = std::get_if<double>(&raw)) {
+    return *value;
+  }
+  return std::nullopt;
+}
+
+}  // namespace
+
+void DatastreamFilterTable::set_filter(std::string_view interface_name, std::string_view path,
+                                       const AstarteDatastreamFilter& filter) {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  auto iter = interfaces_.find(interface_name);
+  if (iter == interfaces_.end()) {
+    iter = interfaces_.emplace(std::string(interface_name), InterfaceState()).first;
+  }
+  InterfaceState& interface = iter->second;
+  if (path.empty()) {
+    interface.filter = filter;
+  } else {
+    auto path_iter = interface.paths.find(path);
+    if (path_iter == interface.paths.end()) {
+      path_iter = interface.paths.emplace(std::string(path), PathState()).first;
+    }
+    path_iter->second.filter = filter;
+  }
+  has_filters_.store(true);
+}
+
+void DatastreamFilterTable::remove_filter(std::string_view interface_name,
+                                          std::string_view path) {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  auto iter = interfaces_.find(interface_name);
+  if (iter == interfaces_.end()) {
+    return;
+  }
+  InterfaceState& interface = iter->second;
+  if (path.empty()) {
+    interface.filter.reset();
+    // Drop the state of the paths that were using the interface filter
+    std::erase_if(interface.paths, [](const auto& entry) { return !entry.second.filter; });
+  } else {
+    auto path_iter = interface.paths.find(path);
+    if (path_iter != interface.paths.end()) {
+      interface.paths.erase(path_iter);
+    }
+  }
+  if (!interface.filter && interface.paths.empty()) {
+    interfaces_.erase(iter);
+  }
+  has_filters_.store(!interfaces_.empty());
+}
+
+auto DatastreamFilterTable::admit(std::string_view interface_name, std::string_view path,
+                                  const AstarteData& data,
+                                  const std::chrono::system_clock::time_point* timestamp) -> bool {
+  if (!is_enabled()) {
+    return true;
+  }
+  const std::lock_guard<std::mutex> lock(mutex_);
+  auto [state, filter] = find_state(interface_name, path, true);
+  if (filter == nullptr) {
+    return true;
+  }
+
+  bool send = silence_expired(*filter, *state, timestamp);
+  if (!send) {
+    auto last = state->last_values.find(INDIVIDUAL_FIELD);
+    send = (last == state->last_values.end()) || (state->last_values.size() != 1) ||
+           !within_filter(*filter, last->second, data);
+  }
+  return count(send);
+}
+
+auto DatastreamFilterTable::admit(std::string_view interface_name, std::string_view path,
+                                  const AstarteDatastreamObject& object,
+                                  const std::chrono::system_clock::time_point* timestamp) -> bool {
+  if (!is_enabled()) {
+    return true;
+  }
+  const std::lock_guard<std::mutex> lock(mutex_);
+  auto [state, filter] = find_state(interface_name, path, true);
+  if (filter == nullptr) {
+    return true;
+  }
+
+  bool send = silence_expired(*filter, *state, timestamp) || state->last_values.empty() ||
+              (state->last_values.size() != object.size());
+  for (auto iter = object.begin(); !send && (iter != object.end()); iter++) {
+    auto last = state->last_values.find(iter->first);
+    send = (last == state->last_values.end()) ||
+           !within_filter(*filter, last->second, iter->second);
+  }
+  return count(send);
+}
+
+void DatastreamFilterTable::record(std::string_view interface_name, std::string_view path,
+                                   const AstarteData& data,
+                                   const std::chrono::system_clock::time_point* timestamp) {
+  if (!is_enabled()) {
+    return;
+  }
+  const std::lock_guard<std::mutex> lock(mutex_);
+  auto [state, filter] = find_state(interface_name, path, false);
+  if (filter == nullptr) {
+    return;
+  }
+  state->last_values.clear();
+  state->last_values.emplace(INDIVIDUAL_FIELD, data);
+  set_last_sent(*state, timestamp);
+}
+
+void DatastreamFilterTable::record(std::string_view interface_name, std::string_view path,
+                                   const AstarteDatastreamObject& object,
+                                   const std::chrono::system_clock::time_point* timestamp) {
+  if (!is_enabled()) {
+    return;
+  }
+  const std::lock_guard<std::mutex> lock(mutex_);
+  auto [state, filter] = find_state(interface_name, path, false);
+  if (filter == nullptr) {
+    return;
+  }
+  state->last_values.clear();
+  for (const auto& [field, value] : object) {
+    state->last_values.emplace(field, value);
+  }
+  set_last_sent(*state, timestamp);
+}
+
+auto DatastreamFilterTable::is_enabled() const -> bool {
+  return has_filters_.load(std::memory_order_relaxed);
+}
+
+auto DatastreamFilterTable::get_stats() const -> AstarteDatastreamFilterStats {
+  return {filtered_.load(), sent_.load()};
+}
+
+auto DatastreamFilterTable::silence_expired(const AstarteDatastreamFilter& filter,
+                                            const PathState& state,
+                                            const std::chrono::system_clock::time_point* timestamp)
+    -> bool {
+  const std::optional<std::chrono::milliseconds>& max_silence = filter.get_max_silence();
+  if (!max_silence.has_value()) {
+    return false;
+  }
+  const std::chrono::system_clock::time_point now =
+      (timestamp != nullptr) ? *timestamp : std::chrono::system_clock::now();
+  return now - state.last_sent >= max_silence.value();
+}
+
+auto DatastreamFilterTable::within_filter(const AstarteDatastreamFilter& filter,
+                                          const AstarteData& last, const AstarteData& data)
+    -> bool {
+  if (last.get_type() != data.get_type()) {
+    return false;
+  }
+  const std::optional<double> last_number = as_number(last);
+  const std::optional<double> number = as_number(data);
+  if (!last_number || !number ||
+      (filter.get_kind() == AstarteDatastreamFilter::Kind::kChangeOnly)) {
+    return last == data;
+  }
+  const double delta = std::abs(number.value() - last_number.value());
+  if (filter.get_kind() == AstarteDatastreamFilter::Kind::kAbsoluteDeadband) {
+    return delta <= filter.get_threshold();
+  }
+  return delta <= filter.get_threshold() * std::abs(last_number.value());
+}
+
+// The state of the paths filtered by their interface is created by the first check
+auto DatastreamFilterTable::find_state(std::string_view interface_name, std::string_view path,
+                                       bool create)
+    -> std::pair<PathState*, const AstarteDatastreamFilter*> {
+  auto iter = interfaces_.find(interface_name);
+  if (iter == interfaces_.end()) {
+    return {nullptr, nullptr};
+  }
+  InterfaceState& interface = iter->second;
+  auto path_iter = interface.paths.find(path);
+  if ((path_iter != interface.paths.end()) && path_iter->second.filter) {
+    return {&path_iter->second, &path_iter->second.filter.value()};
+  }
+  if (!interface.filter) {
+    return {nullptr, nullptr};
+  }
+  if (path_iter == interface.paths.end()) {
+    if (!create) {
+      return {nullptr, nullptr};
+    }
+    path_iter = interface.paths.emplace(std::string(path), PathState()).first;
+  }
+  return {&path_iter->second, &interface.filter.value()};
+}
+
+auto DatastreamFilterTable::count(bool admitted) -> bool {
+  if (!admitted) {
+    filtered_++;
+  }
+  return admitted;
+}
+
+void DatastreamFilterTable::set_last_sent(PathState& state,
+                                          const std::chrono::system_clock::time_point* timestamp) {
+  state.last_sent = (timestamp != nullptr) ? *timestamp : std::chrono::system_clock::now();
+  sent_++;
+}
+
+}  // namespace AstarteDeviceSdk
@@ -5,25 +5,52 @@
 #include "astarte_device_sdk/device_grpc.hpp"
 
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
+#include <functional>
 #include <list>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
+#include "astarte_device_sdk/awaitable.hpp"
+#include "astarte_device_sdk/compression.hpp"
 #include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/datastream_aggregation.hpp"
+#include "astarte_device_sdk/datastream_filter.hpp"
+#include "astarte_device_sdk/executor.hpp"
+#include "astarte_device_sdk/hub_connection.hpp"
 #include "astarte_device_sdk/msg.hpp"
 #include "astarte_device_sdk/object.hpp"
 #include "astarte_device_sdk/ownership.hpp"
 #include "astarte_device_sdk/property.hpp"
+#include "astarte_device_sdk/property_update.hpp"
+#include "astarte_device_sdk/rate_limit.hpp"
+#include "astarte_device_sdk/rpc_stats.hpp"
+#include "astarte_device_sdk/send_priority.hpp"
 #include "astarte_device_sdk/stored_property.hpp"
 #include "device_grpc_impl.hpp"
+#include "hub_connection_impl.hpp"
 
 namespace AstarteDeviceSdk {
 
 AstarteDeviceGRPC::AstarteDeviceGRPC(const std::string& server_addr, const std::string& node_uuid)
-    : astarte_device_impl_{std::make_shared<AstarteDeviceGRPCImpl>(server_addr, node_uuid)} {}
+    : AstarteDeviceGRPC(std::make_shared<AstarteHubConnection>(server_addr), node_uuid) {}
+
+AstarteDeviceGRPC::AstarteDeviceGRPC(const std::string& server_addr, const std::string& node_uuid,
+                                     const AstarteCompression& compression)
+    : AstarteDeviceGRPC(std::make_shared<AstarteHubConnection>(server_addr, compression),
+                        node_uuid) {}
+
+AstarteDeviceGRPC::AstarteDeviceGRPC(const std::shared_ptr<AstarteHubConnection>& hub_connection,
+                                     const std::string& node_uuid)
+    : astarte_device_impl_{std::make_shared<AstarteDeviceGRPCImpl>(
+          hub_connection->hub_connection_impl_, node_uuid)} {}
 
 AstarteDeviceGRPC::~AstarteDeviceGRPC() = default;
 
@@ -59,6 +86,24 @@ void AstarteDeviceGRPC::send_object(std::string_view interface_name, std::string
   astarte_device_impl_->send_object(interface_name, path, object, timestamp);
 }
 
+void AstarteDeviceGRPC::send_series(
+    std::string_view interface_name, std::string_view path, std::span<const int32_t> values,
+    std::span<const std::chrono::system_clock::time_point> timestamps) {
+  astarte_device_impl_->send_series(interface_name, path, values, timestamps);
+}
+
+void AstarteDeviceGRPC::send_series(
+    std::string_view interface_name, std::string_view path, std::span<const int64_t> values,
+    std::span<const std::chrono::system_clock::time_point> timestamps) {
+  astarte_device_impl_->send_series(interface_name, path, values, timestamps);
+}
+
+void AstarteDeviceGRPC::send_series(
+    std::string_view interface_name, std::string_view path, std::span<const double> values,
+    std::span<const std::chrono::system_clock::time_point> timestamps) {
+  astarte_device_impl_->send_series(interface_name, path, values, timestamps);
+}
+
 void AstarteDeviceGRPC::set_property(std::string_view interface_name, std::string_view path,
                                      const AstarteData& data) {
   astarte_device_impl_->set_property(interface_name, path, data);
@@ -68,6 +113,28 @@ void AstarteDeviceGRPC::unset_property(std::string_view interface_name, std::str
   astarte_device_impl_->unset_property(interface_name, path);
 }
 
+auto AstarteDeviceGRPC::get_all_properties_vector(const std::optional<AstarteOwnership>& ownership)
+    -> std::vector<AstarteStoredProperty> {
+  return astarte_device_impl_->get_all_properties_vector(ownership);
+}
+
+void AstarteDeviceGRPC::for_each_property(
+    const std::optional<AstarteOwnership>& ownership,
+    const std::function<void(const AstarteStoredProperty&)>& callback) {
+  astarte_device_impl_->for_each_property(ownership, callback);
+}
+
+auto AstarteDeviceGRPC::set_properties(std::span<const AstartePropertyUpdate> updates)
+    -> std::vector<AstartePropertyUpdateStatus> {
+  return astarte_device_impl_->set_properties(updates);
+}
+
+auto AstarteDeviceGRPC::unset_properties(std::string_view interface_name,
+                                         std::span<const std::string> paths)
+    -> std::vector<AstartePropertyUpdateStatus> {
+  return astarte_device_impl_->unset_properties(interface_name, paths);
+}
+
 auto AstarteDeviceGRPC::poll_incoming(const std::chrono::milliseconds& timeout)
     -> std::optional<AstarteMessage> {
   return astarte_device_impl_->poll_incoming(timeout);
@@ -88,4 +155,139 @@ auto AstarteDeviceGRPC::get_property(std::string_view interface_name, std::strin
   return astarte_device_impl_->get_property(interface_name, path);
 }
 
+auto AstarteDeviceGRPC::async_send_individual(
+    std::string_view interface_name, std::string_view path, const AstarteData& data,
+    const std::chrono::system_clock::time_point* timestamp) -> AstarteAwaitable<void> {
+  return astarte_device_impl_->async_send_individual(interface_name, path, data, timestamp);
+}
+
+auto AstarteDeviceGRPC::async_send_object(std::string_view interface_name, std::string_view path,
+                                          const AstarteDatastreamObject& object,
+                                          const std::chrono::system_clock::time_point* timestamp)
+    -> AstarteAwaitable<void> {
+  return astarte_device_impl_->async_send_object(interface_name, path, object, timestamp);
+}
+
+auto AstarteDeviceGRPC::async_set_property(std::string_view interface_name, std::string_view path,
+                                           const AstarteData& data) -> AstarteAwaitable<void> {
+  return astarte_device_impl_->async_set_property(interface_name, path, data);
+}
+
+auto AstarteDeviceGRPC::async_unset_property(std::string_view interface_name,
+                                             std::string_view path) -> AstarteAwaitable<void> {
+  return astarte_device_impl_->async_unset_property(interface_name, path);
+}
+
+auto AstarteDeviceGRPC::async_get_all_properties(const std::optional<AstarteOwnership>& ownership)
+    -> AstarteAwaitable<std::list<AstarteStoredProperty>> {
+  return astarte_device_impl_->async_get_all_properties(ownership);
+}
+
+auto AstarteDeviceGRPC::async_get_properties(std::string_view interface_name)
+    -> AstarteAwaitable<std::list<AstarteStoredProperty>> {
+  return astarte_device_impl_->async_get_properties(interface_name);
+}
+
+auto AstarteDeviceGRPC::async_get_property(std::string_view interface_name, std::string_view path)
+    -> AstarteAwaitable<AstartePropertyIndividual> {
+  return astarte_device_impl_->async_get_property(interface_name, path);
+}
+
+auto AstarteDeviceGRPC::next_message() -> AstarteAwaitable<AstarteMessage> {
+  return astarte_device_impl_->next_message();
+}
+
+void AstarteDeviceGRPC::set_manual_drive(bool enabled) {
+  astarte_device_impl_->set_manual_drive(enabled);
+}
+
+void AstarteDeviceGRPC::set_property_cache(bool enabled) {
+  astarte_device_impl_->set_property_cache(enabled);
+}
+
+void AstarteDeviceGRPC::set_datastream_filter(std::string_view interface_name,
+                                              std::string_view path,
+                                              const AstarteDatastreamFilter& filter) {
+  astarte_device_impl_->set_datastream_filter(interface_name, path, filter);
+}
+
+void AstarteDeviceGRPC::remove_datastream_filter(std::string_view interface_name,
+                                                 std::string_view path) {
+  astarte_device_impl_->remove_datastream_filter(interface_name, path);
+}
+
+auto AstarteDeviceGRPC::get_datastream_filter_stats() const -> AstarteDatastreamFilterStats {
+  return astarte_device_impl_->get_datastream_filter_stats();
+}
+
+void AstarteDeviceGRPC::set_datastream_aggregation(
+    std::string_view interface_name, const AstarteDatastreamAggregation& aggregation) {
+  astarte_device_impl_->set_datastream_aggregation(interface_name, aggregation);
+}
+
+void AstarteDeviceGRPC::remove_datastream_aggregation(std::string_view interface_name) {
+  astarte_device_impl_->remove_datastream_aggregation(interface_name);
+}
+
+void AstarteDeviceGRPC::flush_datastream_aggregations() {
+  astarte_device_impl_->flush_datastream_aggregations();
+}
+
+void AstarteDeviceGRPC::set_rate_limit(const AstarteRateLimit& limit) {
+  astarte_device_impl_->set_rate_limit(limit);
+}
+
+void AstarteDeviceGRPC::remove_rate_limit() { astarte_device_impl_->remove_rate_limit(); }
+
+void AstarteDeviceGRPC::set_interface_rate_limit(std::string_view interface_name,
+                                                 const AstarteRateLimit& limit) {
+  astarte_device_impl_->set_interface_rate_limit(interface_name, limit);
+}
+
+void AstarteDeviceGRPC::remove_interface_rate_limit(std::string_view interface_name) {
+  astarte_device_impl_->remove_interface_rate_limit(interface_name);
+}
+
+auto AstarteDeviceGRPC::get_rate_limit_stats() const -> AstarteRateLimitStats {
+  return astarte_device_impl_->get_rate_limit_stats();
+}
+
+void AstarteDeviceGRPC::set_interface_priority(std::string_view interface_name,
+                                               AstarteSendPriority priority) {
+  astarte_device_impl_->set_interface_priority(interface_name, priority);
+}
+
+auto AstarteDeviceGRPC::get_send_lane_stats(AstarteSendPriority priority) const
+    -> AstarteSendLaneStats {
+  return astarte_device_impl_->get_send_lane_stats(priority);
+}
+
+void AstarteDeviceGRPC::set_rpc_stats(bool enabled) {
+  astarte_device_impl_->set_rpc_stats(enabled);
+}
+
+auto AstarteDeviceGRPC::get_rpc_stats() const -> std::vector<AstarteRpcStats> {
+  return astarte_device_impl_->get_rpc_stats();
+}
+
+void AstarteDeviceGRPC::set_property_dedup(bool enabled) {
+  astarte_device_impl_->set_property_dedup(enabled);
+}
+
+auto AstarteDeviceGRPC::get_suppressed_property_sends() const -> uint64_t {
+  return astarte_device_impl_->get_suppressed_property_sends();
+}
+
+void AstarteDeviceGRPC::set_executor(std::shared_ptr<AstarteExecutor> executor) {
+  astarte_device_impl_->set_executor(std::move(executor));
+}
+
+auto AstarteDeviceGRPC::run_once(const std::chrono::milliseconds& budget) -> std::size_t {
+  return astarte_device_impl_->run_once(budget);
+}
+
+auto AstarteDeviceGRPC::process_events() -> std::size_t {
+  return astarte_device_impl_->run_once(std::chrono::milliseconds(0));
+}
+
 }  // namespace AstarteDeviceSdk
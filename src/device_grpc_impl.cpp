@@ -11,58 +11,81 @@
 #include <astarteplatform/msghub/message_hub_service.grpc.pb.h>
 #include <astarteplatform/msghub/node.pb.h>
 #include <astarteplatform/msghub/property.pb.h>
+#include <google/protobuf/arena.h>
 #include <google/protobuf/empty.pb.h>
-#include <grpcpp/create_channel.h>
+#include <google/protobuf/timestamp.pb.h>
+#include <grpcpp/alarm.h>
+#include <grpcpp/completion_queue.h>
 #include <grpcpp/grpcpp.h>
-#include <grpcpp/security/credentials.h>
-#include <grpcpp/support/channel_arguments.h>
-#include <grpcpp/support/client_interceptor.h>
 #include <grpcpp/support/status.h>
-#include <spdlog/spdlog.h>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <future>
 #include <iostream>
 #include <iterator>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <regex>
-#include <stop_token>
+#include <span>
 #include <string>
 #include <string_view>
 #include <thread>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "astarte_device_sdk/awaitable.hpp"
+#include "astarte_device_sdk/compression.hpp"
 #include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/datastream_aggregation.hpp"
+#include "astarte_device_sdk/datastream_filter.hpp"
 #include "astarte_device_sdk/device_grpc.hpp"
 #include "astarte_device_sdk/exceptions.hpp"
+#include "astarte_device_sdk/executor.hpp"
 #include "astarte_device_sdk/msg.hpp"
 #include "astarte_device_sdk/object.hpp"
 #include "astarte_device_sdk/ownership.hpp"
 #include "astarte_device_sdk/property.hpp"
+#include "astarte_device_sdk/property_update.hpp"
+#include "astarte_device_sdk/rate_limit.hpp"
+#include "astarte_device_sdk/rpc_stats.hpp"
+#include "astarte_device_sdk/send_priority.hpp"
 #include "astarte_device_sdk/stored_property.hpp"
+#include "datastream_aggregator.hpp"
+#include "datastream_filter_table.hpp"
+#include "executor_strand.hpp"
 #include "exponential_backoff.hpp"
 #include "grpc_converter.hpp"
-#include "grpc_interceptors.hpp"
+#include "hub_connection_impl.hpp"
+#include "metrics_registry.hpp"
+#include "outbound_scheduler.hpp"
+#include "property_cache.hpp"
+#include "property_dedup.hpp"
+#include "rate_limiter.hpp"
+#include "sdk_logger.hpp"
+#include "send_pipeline.hpp"
 #include "shared_queue.hpp"
+#include "timer_wheel.hpp"
 
 namespace AstarteDeviceSdk {
 
-using grpc::Channel;
 using grpc::ClientContext;
-using grpc::ClientReader;
 using grpc::Status;
 
-using grpc::experimental::ClientInterceptorFactoryInterface;
-
 using gRPCAstarteData = astarteplatform::msghub::AstarteData;
 using gRPCAstarteDatastreamObject = astarteplatform::msghub::AstarteDatastreamObject;
 using gRPCAstartePropertyIndividual = astarteplatform::msghub::AstartePropertyIndividual;
-using gRPCAstarteMessage = astarteplatform::msghub::AstarteMessage;
 using gRPCMessageHub = astarteplatform::msghub::MessageHub;
 using gRPCMessageHubError = astarteplatform::msghub::MessageHubError;
 using gRPCMessageHubEvent = astarteplatform::msghub::MessageHubEvent;
@@ -75,23 +98,39 @@ using gRPCPropertyIdentifier = astarteplatform::msghub::PropertyIdentifier;
 using gRPCInterfacesJson = astarteplatform::msghub::InterfacesJson;
 using gRPCInterfacesName = astarteplatform::msghub::InterfacesName;
 
-AstarteDeviceGRPC::AstarteDeviceGRPCImpl::AstarteDeviceGRPCImpl(std::string server_addr,
-                                                                std::string node_uuid)
-    : server_addr_(std::move(server_addr)),
+AstarteDeviceGRPC::AstarteDeviceGRPCImpl::AstarteDeviceGRPCImpl(
+    std::shared_ptr<AstarteHubConnection::AstarteHubConnectionImpl> hub_connection,
+    std::string node_uuid)
+    : hub_connection_(std::move(hub_connection)),
       node_uuid_(std::move(node_uuid)),
+      stub_(gRPCMessageHub::NewStub(hub_connection_->get_channel())),
       connected_(std::atomic_bool(false)),
-      grpc_stream_error_(std::atomic_bool(false)) {}
-
-AstarteDeviceGRPC::AstarteDeviceGRPCImpl::~AstarteDeviceGRPCImpl() { ssource_.request_stop(); }
+      grpc_stream_error_(std::atomic_bool(false)),
+      datastream_aggregator_(std::make_shared<DatastreamAggregator>(
+          TimerWheel::shared(),
+          [this](AggregatedObject object) { on_aggregation_expired(std::move(object)); })) {}
+
+AstarteDeviceGRPC::AstarteDeviceGRPCImpl::~AstarteDeviceGRPCImpl() {
+  datastream_aggregator_->close();
+  outbound_->close();
+  stop_connection();
+  strand_.wait_idle();
+  fail_message_waiters();
+  cq_.Shutdown();
+  void* tag = nullptr;
+  bool ok = false;
+  while (cq_.Next(&tag, &ok)) {
+  }
+}
 
 void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::add_interface_from_file(
     const std::filesystem::path& json_file) {
-  spdlog::debug("Adding interface from file: {}", json_file.string());
+  ASTARTE_LOG_DEBUG("Adding interface from file: {}", json_file.string());
 
   // Check file validity
   std::ifstream interface_file(json_file, std::ios::in);
   if (!interface_file.is_open()) {
-    spdlog::error("Could not open the interface file: {}", json_file.string());
+    ASTARTE_LOG_ERROR("Could not open the interface file: {}", json_file.string());
     throw AstarteFileOpenException(json_file.string());
   }
 
@@ -107,27 +146,29 @@ void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::add_interface_from_file(
 }
 
 void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::add_interface_from_str(std::string_view json) {
-  spdlog::debug("Adding interface from string");
+  ASTARTE_LOG_DEBUG("Adding interface from string");
 
   // If the device is connected, notify the message hub
   if (is_connected()) {
     gRPCInterfacesJson grpc_interfaces_json;
     grpc_interfaces_json.add_interfaces_json(json);
     ClientContext context;
+    setup_client_context(context);
     google::protobuf::Empty response;
     const Status status = stub_->AddInterfaces(&context, grpc_interfaces_json, &response);
     if (!status.ok()) {
-      spdlog::error("{}: {}", static_cast<int>(status.error_code()), status.error_message());
+      ASTARTE_LOG_ERROR("{}: {}", static_cast<int>(status.error_code()), status.error_message());
       return;
     }
   }
 
   interfaces_bins_.emplace_back(json);
-  spdlog::trace("Added interface: \n{}", json);
+  property_cache_->add_interface(json);
+  ASTARTE_LOG_TRACE("Added interface: \n{}", json);
 }
 
 void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::remove_interface(const std::string& interface_name) {
-  spdlog::debug("Removing interface: {}", interface_name);
+  ASTARTE_LOG_DEBUG("Removing interface: {}", interface_name);
   const std::string escaped_interface_name =
       std::regex_replace(interface_name, std::regex("\\."), "\\.");
   const std::string pattern_string =
@@ -142,32 +183,36 @@ void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::remove_interface(const std::strin
         gRPCInterfacesName grpc_interface_names;
         grpc_interface_names.add_names(interface_name);
         ClientContext context;
+        setup_client_context(context);
         google::protobuf::Empty response;
         const Status status = stub_->RemoveInterfaces(&context, grpc_interface_names, &response);
         if (!status.ok()) {
-          spdlog::error("{}: {}", static_cast<int>(status.error_code()), status.error_message());
+          ASTARTE_LOG_ERROR("{}: {}", static_cast<int>(status.error_code()),
+                            status.error_message());
           return;
         }
       }
       interfaces_bins_.erase(i);
+      property_cache_->remove_interface(interface_name);
       break;
     }
   }
 }
 
 void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::connect() {
-  spdlog::info("Connection requested.");
-  if (connection_thread_) {
-    spdlog::warn("Connection process is already running.");
-    return;
+  ASTARTE_LOG_INFO("Connection requested.");
+  {
+    const std::lock_guard<std::mutex> lock(connection_mutex_);
+    if (state_ != ConnectionState::kIdle) {
+      ASTARTE_LOG_WARN("Connection process is already running.");
+      return;
+    }
+    // start a fresh connection session
+    stop_requested_ = false;
+    backoff_.reset();
   }
 
-  // create a fresh stop source for this new connection session
-  ssource_ = std::stop_source();
-
-  // start the connection loop, passing it the token from our source.
-  connection_thread_.emplace([this](const std::stop_token& token) { this->connection_loop(token); },
-                             ssource_.get_token());
+  start_attach();
 }
 
 auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::is_connected() const -> bool {
@@ -175,155 +220,306 @@ auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::is_connected() const -> bool {
 }
 
 void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::disconnect() {
-  spdlog::info("Disconnection requested.");
+  ASTARTE_LOG_INFO("Disconnection requested.");
 
-  // request a stop to signal connection_loop and handle_events
-  ssource_.request_stop();
+  // signal the connection state machine that it should not attempt to reconnect
+  {
+    const std::lock_guard<std::mutex> lock(connection_mutex_);
+    stop_requested_ = true;
+  }
+
+  // Open aggregation windows would otherwise be lost
+  if (connected_.load()) {
+    try {
+      send_aggregated_objects(datastream_aggregator_->take_all());
+    } catch (const AstarteInvalidInputException& e) {
+      ASTARTE_LOG_WARN("Failed to send the aggregated objects: {}", e.what());
+    }
+  }
 
   if (connected_.load() || grpc_stream_error_.load()) {
     ClientContext context;
+    setup_client_context(context);
     google::protobuf::Empty response;
     const Status status = stub_->Detach(&context, google::protobuf::Empty(), &response);
     if (!status.ok()) {
-      spdlog::error("{}: {}", static_cast<int>(status.error_code()), status.error_message());
+      ASTARTE_LOG_ERROR("{}: {}", static_cast<int>(status.error_code()), status.error_message());
     }
     grpc_stream_error_.store(false);
   }
 
-  // clear the thread object by invoking the destructor on the internal thread.
-  // jthread's destructor will join
-  connection_thread_.reset();
+  // terminate the Attach stream and any pending reconnection timer
+  stop_connection();
 }
 
 void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::send_individual(
     std::string_view interface_name, std::string_view path, const AstarteData& data,
     const std::chrono::system_clock::time_point* timestamp) {
-  spdlog::debug("Sending individual: {} {}", interface_name, path);
+  ASTARTE_LOG_DEBUG("Sending individual: {} {}", interface_name, path);
   if (!connected_.load()) {
     const std::string_view msg("Device disconnected, operation aborted.");
-    spdlog::warn(msg);
+    ASTARTE_LOG_WARN(msg);
     throw AstarteOperationRefusedException(msg);
   }
-  gRPCAstarteMessage message;
-  message.set_interface_name(interface_name);
-  message.set_path(path);
-
-  GrpcConverterTo converter;
-  std::unique_ptr<gRPCAstarteDatastreamIndividual> grpc_datastream_individual =
-      converter(data, timestamp);
-  message.set_allocated_datastream_individual(grpc_datastream_individual.release());
-
-  ClientContext context;
-  google::protobuf::Empty response;
-  spdlog::trace("Sending data: {} {}", interface_name, path);
-  const Status status = stub_->Send(&context, message, &response);
-  if (!status.ok()) {
-    spdlog::error("{}: {}", static_cast<int>(status.error_code()), status.error_message());
-    throw AstarteInvalidInputException(status.error_message());
+  if (!admit_sample(interface_name, path, data, timestamp)) {
+    return;
   }
+  std::vector<AggregatedObject> ready;
+  if (datastream_aggregator_->aggregate(interface_name, path, data, timestamp, ready)) {
+    send_aggregated_objects(std::move(ready));
+    return;
+  }
+  gRPCAstarteMessage message = make_individual_message(interface_name, path, data, timestamp);
+
+  ASTARTE_LOG_TRACE("Sending data: {} {}", interface_name, path);
+  send_message(std::move(message));
 }
 
 void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::send_object(
     std::string_view interface_name, std::string_view path, const AstarteDatastreamObject& object,
     const std::chrono::system_clock::time_point* timestamp) {
-  spdlog::debug("Sending object: {} {}", interface_name, path);
+  ASTARTE_LOG_DEBUG("Sending object: {} {}", interface_name, path);
   if (!connected_.load()) {
     const std::string_view msg("Device disconnected, operation aborted.");
-    spdlog::warn(msg);
+    ASTARTE_LOG_WARN(msg);
     throw AstarteOperationRefusedException(msg);
   }
-  gRPCAstarteMessage message;
-  message.set_interface_name(interface_name);
-  message.set_path(path);
+  if (!admit_sample(interface_name, path, object, timestamp)) {
+    return;
+  }
+  gRPCAstarteMessage message = make_object_message(interface_name, path, object, timestamp);
 
-  GrpcConverterTo converter;
-  std::unique_ptr<gRPCAstarteDatastreamObject> grpc_datastream_object =
-      converter(object, timestamp);
-  message.set_allocated_datastream_object(grpc_datastream_object.release());
+  ASTARTE_LOG_TRACE("Sending data: {} {}", interface_name, path);
+  send_message(std::move(message));
+}
 
-  ClientContext context;
-  google::protobuf::Empty response;
-  spdlog::trace("Sending data: {} {}", interface_name, path);
-  const Status status = stub_->Send(&context, message, &response);
-  if (!status.ok()) {
-    spdlog::error("{}: {}", static_cast<int>(status.error_code()), status.error_message());
-    throw AstarteInvalidInputException(status.error_message());
-  }
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::send_series(
+    std::string_view interface_name, std::string_view path, std::span<const int32_t> values,
+    std::span<const std::chrono::system_clock::time_point> timestamps) {
+  send_series_column(interface_name, path, values, timestamps);
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::send_series(
+    std::string_view interface_name, std::string_view path, std::span<const int64_t> values,
+    std::span<const std::chrono::system_clock::time_point> timestamps) {
+  send_series_column(interface_name, path, values, timestamps);
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::send_series(
+    std::string_view interface_name, std::string_view path, std::span<const double> values,
+    std::span<const std::chrono::system_clock::time_point> timestamps) {
+  send_series_column(interface_name, path, values, timestamps);
+}
+
+template <typename T>
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::send_series_column(
+    std::string_view interface_name, std::string_view path, std::span<const T> values,
+    std::span<const std::chrono::system_clock::time_point> timestamps) {
+  ASTARTE_LOG_DEBUG("Sending series of {} samples: {} {}", values.size(), interface_name, path);
+  // The messages live on the arena until all of them have been sent
+  google::protobuf::ArenaOptions options;
+  options.start_block_size = SERIES_ARENA_BLOCK_SIZE;
+  options.max_block_size = SERIES_ARENA_BLOCK_SIZE;
+  google::protobuf::Arena arena(options);
+  send_batch(encode_series(arena, interface_name, path, values, timestamps));
 }
 
 void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::set_property(std::string_view interface_name,
                                                             std::string_view path,
                                                             const AstarteData& data) {
-  spdlog::debug("Setting property: {} {}", interface_name, path);
+  ASTARTE_LOG_DEBUG("Setting property: {} {}", interface_name, path);
+  metrics_.property_updates.add();
   if (!connected_.load()) {
     const std::string_view msg("Device disconnected, operation aborted.");
-    spdlog::warn(msg);
+    ASTARTE_LOG_WARN(msg);
     throw AstarteOperationRefusedException(msg);
   }
-  gRPCAstarteMessage message;
-  message.set_interface_name(interface_name);
-  message.set_path(path);
-
-  const std::optional<AstarteData>& opt_data = data;
-  GrpcConverterTo converter;
-  std::unique_ptr<gRPCAstartePropertyIndividual> grpc_property_individual = converter(opt_data);
-  message.set_allocated_property_individual(grpc_property_individual.release());
-
-  ClientContext context;
-  google::protobuf::Empty response;
-  spdlog::trace("Sending data: {} {}", interface_name, path);
-  const Status status = stub_->Send(&context, message, &response);
-  if (!status.ok()) {
-    spdlog::error("{}: {}", static_cast<int>(status.error_code()), status.error_message());
-    throw AstarteInvalidInputException(status.error_message());
+  if (property_dedup_->suppress(interface_name, path, data)) {
+    ASTARTE_LOG_TRACE("Property already set to the same value: {} {}", interface_name, path);
+    return;
   }
+  gRPCAstarteMessage message = make_property_message(interface_name, path, data);
+
+  ASTARTE_LOG_TRACE("Sending data: {} {}", interface_name, path);
+  send_message(std::move(message));
 }
 
 void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::unset_property(std::string_view interface_name,
                                                               std::string_view path) {
-  spdlog::debug("Unsetting property: {} {}", interface_name, path);
+  ASTARTE_LOG_DEBUG("Unsetting property: {} {}", interface_name, path);
+  metrics_.property_updates.add();
   if (!connected_.load()) {
     const std::string_view msg("Device disconnected, operation aborted.");
-    spdlog::warn(msg);
+    ASTARTE_LOG_WARN(msg);
     throw AstarteOperationRefusedException(msg);
   }
-  gRPCAstarteMessage message;
-  message.set_interface_name(interface_name);
-  message.set_path(path);
+  property_dedup_->forget(interface_name, path);
+  gRPCAstarteMessage message = make_property_message(interface_name, path, std::nullopt);
 
-  const std::optional<AstarteData> opt_data = std::nullopt;
-  GrpcConverterTo converter;
-  std::unique_ptr<gRPCAstartePropertyIndividual> grpc_property_individual = converter(opt_data);
-  message.set_allocated_property_individual(grpc_property_individual.release());
+  send_message(std::move(message));
+}
 
-  ClientContext context;
-  google::protobuf::Empty response;
-  const Status status = stub_->Send(&context, message, &response);
-  if (!status.ok()) {
-    spdlog::error("{}: {}", static_cast<int>(status.error_code()), status.error_message());
-    throw AstarteInvalidInputException(status.error_message());
+auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::set_properties(
+    std::span<const AstartePropertyUpdate> updates) -> std::vector<AstartePropertyUpdateStatus> {
+  ASTARTE_LOG_DEBUG("Setting {} properties.", updates.size());
+  metrics_.property_updates.add(updates.size());
+  if (!connected_.load() || manual_drive_) {
+    const std::string_view msg = manual_drive_
+                                     ? "Bulk property operations are not available in manual drive."
+                                     : "Device disconnected, operation aborted.";
+    ASTARTE_LOG_WARN(msg);
+    throw AstarteOperationRefusedException(msg);
   }
+
+  // Convert and admit all the updates up front, skipping the redundant ones
+  std::vector<AstartePropertyUpdateStatus> statuses(updates.size());
+  std::vector<gRPCAstarteMessage> messages;
+  std::vector<std::string> keys;
+  std::vector<std::size_t> positions;
+  std::vector<std::chrono::steady_clock::time_point> not_before;
+  messages.reserve(updates.size());
+  keys.reserve(updates.size());
+  positions.reserve(updates.size());
+  not_before.reserve(updates.size());
+  for (std::size_t position = 0; position < updates.size(); position++) {
+    const AstartePropertyUpdate& update = updates[position];
+    const std::optional<AstarteData>& value = update.get_value();
+    if (!value.has_value()) {
+      property_dedup_->forget(update.get_interface_name(), update.get_path());
+    } else if (property_dedup_->suppress(update.get_interface_name(), update.get_path(),
+                                         value.value())) {
+      continue;
+    }
+    gRPCAstarteMessage message =
+        make_property_message(update.get_interface_name(), update.get_path(), value);
+    // Each update is checked on its own, and started no earlier than its admission allows
+    const RateLimiter::Admission admission = admit_message(message);
+    std::chrono::steady_clock::time_point start;
+    switch (admission.action) {
+      case RateLimiter::Admission::Action::kSend:
+        break;
+      // Deferring would let the later updates of the same path overtake this one, and the stale
+      // value would then overwrite the dedup table and the property cache
+      case RateLimiter::Admission::Action::kWait:
+      case RateLimiter::Admission::Action::kDefer:
+        start = std::chrono::steady_clock::now() +
+                std::chrono::ceil<std::chrono::steady_clock::duration>(admission.delay);
+        break;
+      case RateLimiter::Admission::Action::kDrop:
+        ASTARTE_LOG_TRACE("Property dropped by the rate limit: {} {}",
+                          update.get_interface_name(), update.get_path());
+        statuses[position] = AstartePropertyUpdateStatus("Dropped by the rate limit.");
+        continue;
+    }
+    messages.push_back(std::move(message));
+    keys.push_back(update.get_interface_name() + update.get_path());
+    positions.push_back(position);
+    not_before.push_back(start);
+  }
+
+  SendPipeline pipeline(MAX_PIPELINED_SENDS, [this, &messages, &not_before](
+                                                 std::size_t index, SendPipeline::OnDone on_done) {
+    start_scheduled_send(messages[index], std::move(on_done), not_before[index]);
+  });
+  const std::vector<Status> results = pipeline.run(keys);
+
+  for (std::size_t index = 0; index < results.size(); index++) {
+    const Status& status = results[index];
+    if (!status.ok()) {
+      ASTARTE_LOG_ERROR("{}: {}", static_cast<int>(status.error_code()), status.error_message());
+      statuses[positions[index]] = AstartePropertyUpdateStatus(status.error_message());
+    }
+  }
+  return statuses;
+}
+
+auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::unset_properties(
+    std::string_view interface_name, std::span<const std::string> paths)
+    -> std::vector<AstartePropertyUpdateStatus> {
+  std::vector<AstartePropertyUpdate> updates;
+  updates.reserve(paths.size());
+  for (const std::string& path : paths) {
+    updates.emplace_back(interface_name, path);
+  }
+  return set_properties(updates);
 }
 
 auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::poll_incoming(
     const std::chrono::milliseconds& timeout) -> std::optional<AstarteMessage> {
+  // In manual drive mode no one else is filling the queue, wait for the events while driving it
+  if (manual_drive_ && rcv_queue_.empty()) {
+    run_once(timeout);
+    return rcv_queue_.pop(std::chrono::milliseconds(0));
+  }
   return rcv_queue_.pop(timeout);
 }
 
 auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::get_all_properties(
     const std::optional<AstarteOwnership>& ownership) -> std::list<AstarteStoredProperty> {
   if (ownership.has_value()) {
-    spdlog::debug("Getting all stored properties {} owned.", ownership_as_str(ownership.value()));
+    ASTARTE_LOG_DEBUG("Getting all stored properties {} owned.",
+                      ownership_as_str(ownership.value()));
   } else {
-    spdlog::debug("Getting all stored properties for all owners.");
+    ASTARTE_LOG_DEBUG("Getting all stored properties for all owners.");
+  }
+
+  if (!connected_.load()) {
+    const std::string_view msg("Device disconnected, operation aborted.");
+    ASTARTE_LOG_WARN(msg);
+    throw AstarteOperationRefusedException(msg);
+  }
+
+  if (auto cached = property_cache_->get_all_properties(ownership)) {
+    return std::move(cached.value());
   }
 
+  return GrpcConverterFrom{}(fetch_all_properties(ownership));
+}
+
+auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::get_all_properties_vector(
+    const std::optional<AstarteOwnership>& ownership) -> std::vector<AstarteStoredProperty> {
+  ASTARTE_LOG_DEBUG("Getting all stored properties as a vector.");
   if (!connected_.load()) {
     const std::string_view msg("Device disconnected, operation aborted.");
-    spdlog::warn(msg);
+    ASTARTE_LOG_WARN(msg);
     throw AstarteOperationRefusedException(msg);
   }
 
+  if (auto cached = property_cache_->get_all_properties(ownership)) {
+    return {std::make_move_iterator(cached->begin()), std::make_move_iterator(cached->end())};
+  }
+
+  const gRPCStoredProperties response = fetch_all_properties(ownership);
+  return StoredPropertiesDecoder(response).to_vector();
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::for_each_property(
+    const std::optional<AstarteOwnership>& ownership,
+    const std::function<void(const AstarteStoredProperty&)>& callback) {
+  ASTARTE_LOG_DEBUG("Iterating over all stored properties.");
+  if (!connected_.load()) {
+    const std::string_view msg("Device disconnected, operation aborted.");
+    ASTARTE_LOG_WARN(msg);
+    throw AstarteOperationRefusedException(msg);
+  }
+
+  if (auto cached = property_cache_->get_all_properties(ownership)) {
+    for (const AstarteStoredProperty& property : cached.value()) {
+      callback(property);
+    }
+    return;
+  }
+
+  // Only a single entry is decoded at a time
+  const gRPCStoredProperties response = fetch_all_properties(ownership);
+  StoredPropertiesDecoder decoder(response);
+  for (std::size_t index = 0; index < decoder.size(); index++) {
+    callback(decoder.decode(index));
+  }
+}
+
+auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::fetch_all_properties(
+    const std::optional<AstarteOwnership>& ownership) -> gRPCStoredProperties {
   gRPCPropertyFilter filter;
   if (ownership.has_value()) {
     filter.set_ownership((ownership == AstarteOwnership::kDevice) ? gRPCOwnership::DEVICE
@@ -331,33 +527,38 @@ auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::get_all_properties(
   }
 
   ClientContext context;
+  setup_client_context(context);
   gRPCStoredProperties response;
   const Status status = stub_->GetAllProperties(&context, filter, &response);
   if (!status.ok()) {
-    spdlog::error("{}: {}", static_cast<int>(status.error_code()), status.error_message());
+    ASTARTE_LOG_ERROR("{}: {}", static_cast<int>(status.error_code()), status.error_message());
     throw AstarteInvalidInputException(status.error_message());
   }
-
-  return GrpcConverterFrom{}(response);
+  return response;
 }
 
 auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::get_properties(std::string_view interface_name)
     -> std::list<AstarteStoredProperty> {
-  spdlog::debug("Getting stored properties for interface: {}", interface_name);
+  ASTARTE_LOG_DEBUG("Getting stored properties for interface: {}", interface_name);
   if (!connected_.load()) {
     const std::string_view msg("Device disconnected, operation aborted.");
-    spdlog::warn(msg);
+    ASTARTE_LOG_WARN(msg);
     throw AstarteOperationRefusedException(msg);
   }
 
+  if (auto cached = property_cache_->get_properties(interface_name)) {
+    return std::move(cached.value());
+  }
+
   gRPCInterfaceName grpc_interface_name;
   grpc_interface_name.set_name(interface_name);
 
   ClientContext context;
+  setup_client_context(context);
   gRPCStoredProperties response;
   const Status status = stub_->GetProperties(&context, grpc_interface_name, &response);
   if (!status.ok()) {
-    spdlog::error("{}: {}", static_cast<int>(status.error_code()), status.error_message());
+    ASTARTE_LOG_ERROR("{}: {}", static_cast<int>(status.error_code()), status.error_message());
     throw AstarteInvalidInputException(status.error_message());
   }
 
@@ -367,167 +568,1238 @@ auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::get_properties(std::string_view i
 auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::get_property(std::string_view interface_name,
                                                             std::string_view path)
     -> AstartePropertyIndividual {
-  spdlog::debug("Getting stored property for interface '{}' and path '{}'", interface_name, path);
+  ASTARTE_LOG_DEBUG("Getting stored property for interface '{}' and path '{}'", interface_name,
+                    path);
   if (!connected_.load()) {
     const std::string_view msg("Device disconnected, operation aborted.");
-    spdlog::warn(msg);
+    ASTARTE_LOG_WARN(msg);
     throw AstarteOperationRefusedException(msg);
   }
 
+  if (auto cached = property_cache_->get_property(interface_name, path)) {
+    return std::move(cached.value());
+  }
+
   gRPCPropertyIdentifier identifier;
   identifier.set_interface_name(interface_name);
   identifier.set_path(path);
 
   ClientContext context;
+  setup_client_context(context);
   gRPCAstartePropertyIndividual response;
   const Status status = stub_->GetProperty(&context, identifier, &response);
   if (!status.ok()) {
-    spdlog::error("{}: {}", static_cast<int>(status.error_code()), status.error_message());
+    ASTARTE_LOG_ERROR("{}: {}", static_cast<int>(status.error_code()), status.error_message());
     throw AstarteInvalidInputException(status.error_message());
   }
 
-  return GrpcConverterFrom{}(response);
+  AstartePropertyIndividual property = GrpcConverterFrom{}(response);
+  if (property_cache_->is_enabled()) {
+    property_cache_->update(interface_name, path, property.get_value());
+  }
+  return property;
 }
 
-// Private helper to set up the gRPC channel and stub
-void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::setup_grpc_channel() {
-  const grpc::ChannelArguments args;
-  std::vector<std::unique_ptr<ClientInterceptorFactoryInterface>> interceptor_creators;
-  interceptor_creators.push_back(std::make_unique<NodeIdInterceptorFactory>(node_uuid_));
+auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::async_send_individual(
+    std::string_view interface_name, std::string_view path, const AstarteData& data,
+    const std::chrono::system_clock::time_point* timestamp) -> AstarteAwaitable<void> {
+  ASTARTE_LOG_DEBUG("Sending individual asynchronously: {} {}", interface_name, path);
+  if (connected_.load() && !admit_sample(interface_name, path, data, timestamp)) {
+    return make_ready_awaitable();
+  }
+  std::vector<AggregatedObject> ready;
+  if (connected_.load() &&
+      datastream_aggregator_->aggregate(interface_name, path, data, timestamp, ready)) {
+    if (ready.empty()) {
+      return make_ready_awaitable();
+    }
+    // Only the window holding the sample is awaited, a window it closed is sent in the background
+    for (std::size_t index = 0; index + 1 < ready.size(); index++) {
+      static_cast<void>(async_send_message(make_aggregated_message(ready[index]),
+                                           on_aggregated_sent(ready[index])));
+    }
+    return async_send_message(make_aggregated_message(ready.back()),
+                              on_aggregated_sent(ready.back()));
+  }
+  return async_send_message(make_individual_message(interface_name, path, data, timestamp));
+}
 
-  const std::shared_ptr<Channel> channel = CreateCustomChannelWithInterceptors(
-      server_addr_, grpc::InsecureChannelCredentials(), args, std::move(interceptor_creators));
+auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::async_send_object(
+    std::string_view interface_name, std::string_view path, const AstarteDatastreamObject& object,
+    const std::chrono::system_clock::time_point* timestamp) -> AstarteAwaitable<void> {
+  ASTARTE_LOG_DEBUG("Sending object asynchronously: {} {}", interface_name, path);
+  if (connected_.load() && !admit_sample(interface_name, path, object, timestamp)) {
+    return make_ready_awaitable();
+  }
+  return async_send_message(make_object_message(interface_name, path, object, timestamp));
+}
+
+auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::async_set_property(std::string_view interface_name,
+                                                                  std::string_view path,
+                                                                  const AstarteData& data)
+    -> AstarteAwaitable<void> {
+  ASTARTE_LOG_DEBUG("Setting property asynchronously: {} {}", interface_name, path);
+  metrics_.property_updates.add();
+  if (connected_.load() && property_dedup_->suppress(interface_name, path, data)) {
+    ASTARTE_LOG_TRACE("Property already set to the same value: {} {}", interface_name, path);
+    return make_ready_awaitable();
+  }
+  return async_send_message(make_property_message(interface_name, path, data));
+}
 
-  stub_ = gRPCMessageHub::NewStub(channel);
+auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::async_unset_property(
+    std::string_view interface_name, std::string_view path) -> AstarteAwaitable<void> {
+  ASTARTE_LOG_DEBUG("Unsetting property asynchronously: {} {}", interface_name, path);
+  metrics_.property_updates.add();
+  property_dedup_->forget(interface_name, path);
+  return async_send_message(make_property_message(interface_name, path, std::nullopt));
 }
 
-auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::perform_attach() -> std::optional<AttachResult> {
-  // Create the node message for the attach RPC.
-  gRPCNode node;
-  for (const std::string& interface_json : interfaces_bins_) {
-    node.add_interfaces_json(interface_json);
+auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::async_get_all_properties(
+    const std::optional<AstarteOwnership>& ownership)
+    -> AstarteAwaitable<std::list<AstarteStoredProperty>> {
+  ASTARTE_LOG_DEBUG("Getting all stored properties asynchronously.");
+  if (auto cached = property_cache_->get_all_properties(ownership)) {
+    return make_ready_awaitable(std::move(cached.value()));
   }
+  gRPCPropertyFilter filter;
+  if (ownership.has_value()) {
+    filter.set_ownership((ownership == AstarteOwnership::kDevice) ? gRPCOwnership::DEVICE
+                                                                  : gRPCOwnership::SERVER);
+  }
+  return async_unary_call<std::list<AstarteStoredProperty>, gRPCStoredProperties>(
+      std::move(filter),
+      [this](ClientContext* context, const gRPCPropertyFilter* request,
+             gRPCStoredProperties* response, std::function<void(Status)> on_done) {
+        stub_->async()->GetAllProperties(context, request, response, std::move(on_done));
+      });
+}
+
+auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::async_get_properties(
+    std::string_view interface_name) -> AstarteAwaitable<std::list<AstarteStoredProperty>> {
+  ASTARTE_LOG_DEBUG("Getting stored properties asynchronously for interface '{}'", interface_name);
+  if (auto cached = property_cache_->get_properties(interface_name)) {
+    return make_ready_awaitable(std::move(cached.value()));
+  }
+  gRPCInterfaceName grpc_interface_name;
+  grpc_interface_name.set_name(interface_name);
+  return async_unary_call<std::list<AstarteStoredProperty>, gRPCStoredProperties>(
+      std::move(grpc_interface_name),
+      [this](ClientContext* context, const gRPCInterfaceName* request,
+             gRPCStoredProperties* response, std::function<void(Status)> on_done) {
+        stub_->async()->GetProperties(context, request, response, std::move(on_done));
+      });
+}
 
-  // Generate a new client context for the Attach method.
-  // From the documentation it appears that a context needs to be valid for the duration of the RPC
-  // In this case the RPC ends when the return stream is closed, so the context should survive at
-  // least for that long.
-  // See: https://grpc.github.io/grpc/cpp/classgrpc_1_1_client_context.html
-  std::unique_ptr<ClientContext> context = std::make_unique<ClientContext>();
-  std::unique_ptr<ClientReader<gRPCMessageHubEvent>> reader = stub_->Attach(context.get(), node);
+auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::async_get_property(std::string_view interface_name,
+                                                                  std::string_view path)
+    -> AstarteAwaitable<AstartePropertyIndividual> {
+  ASTARTE_LOG_DEBUG("Getting stored property asynchronously for interface '{}' and path '{}'",
+                    interface_name, path);
+  if (auto cached = property_cache_->get_property(interface_name, path)) {
+    return make_ready_awaitable(std::move(cached.value()));
+  }
+  gRPCPropertyIdentifier identifier;
+  identifier.set_interface_name(interface_name);
+  identifier.set_path(path);
+  return async_unary_call<AstartePropertyIndividual, gRPCAstartePropertyIndividual>(
+      std::move(identifier),
+      [this](ClientContext* context, const gRPCPropertyIdentifier* request,
+             gRPCAstartePropertyIndividual* response, std::function<void(Status)> on_done) {
+        stub_->async()->GetProperty(context, request, response, std::move(on_done));
+      });
+}
 
-  reader->WaitForInitialMetadata();
-  auto server_metadata = context->GetServerInitialMetadata();
-  if (server_metadata.empty()) {
-    spdlog::warn("No metadata from server");
-    grpc_stream_error_.store(true);
-    return std::nullopt;
+auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::next_message() -> AstarteAwaitable<AstarteMessage> {
+  auto state = std::make_shared<AstarteAsyncState<AstarteMessage>>(strand_.get_executor());
+  const std::lock_guard<std::mutex> lock(message_waiters_mutex_);
+  std::optional<AstarteMessage> message = rcv_queue_.pop(std::chrono::milliseconds(0));
+  if (message.has_value()) {
+    state->set_value(std::move(message.value()));
+  } else {
+    message_waiters_.push_back(state);
   }
+  return AstarteAwaitable<AstarteMessage>(state);
+}
 
-  grpc_stream_error_.store(false);
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::set_manual_drive(bool enabled) {
+  const std::lock_guard<std::mutex> lock(connection_mutex_);
+  if (state_ != ConnectionState::kIdle) {
+    const std::string_view msg("The drive mode can't be changed while the device is connecting.");
+    ASTARTE_LOG_WARN(msg);
+    throw AstarteOperationRefusedException(msg);
+  }
+  manual_drive_ = enabled;
+  // The timer wheel would start its own thread
+  datastream_aggregator_->set_manual_expiry(enabled);
+}
 
-  return AttachResult{.context = std::move(context), .reader = std::move(reader)};
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::set_property_cache(bool enabled) {
+  {
+    const std::lock_guard<std::mutex> lock(connection_mutex_);
+    if (state_ != ConnectionState::kIdle) {
+      const std::string_view msg("The property cache can't be toggled while connecting.");
+      ASTARTE_LOG_WARN(msg);
+      throw AstarteOperationRefusedException(msg);
+    }
+  }
+  property_cache_->set_enabled(enabled);
 }
 
-void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::connection_attempt(const std::stop_token& token) {
-  if (connected_.load()) {
-    spdlog::warn("Device is already connected.");
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::set_datastream_filter(
+    std::string_view interface_name, std::string_view path, const AstarteDatastreamFilter& filter) {
+  datastream_filters_->set_filter(interface_name, path, filter);
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::remove_datastream_filter(
+    std::string_view interface_name, std::string_view path) {
+  datastream_filters_->remove_filter(interface_name, path);
+}
+
+auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::get_datastream_filter_stats() const
+    -> AstarteDatastreamFilterStats {
+  return datastream_filters_->get_stats();
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::set_rate_limit(const AstarteRateLimit& limit) {
+  rate_limiter_.set_device_limit(limit);
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::remove_rate_limit() {
+  rate_limiter_.set_device_limit(std::nullopt);
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::set_interface_rate_limit(
+    std::string_view interface_name, const AstarteRateLimit& limit) {
+  rate_limiter_.set_interface_limit(interface_name, limit);
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::remove_interface_rate_limit(
+    std::string_view interface_name) {
+  rate_limiter_.set_interface_limit(interface_name, std::nullopt);
+}
+
+auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::get_rate_limit_stats() const
+    -> AstarteRateLimitStats {
+  return rate_limiter_.get_stats();
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::set_interface_priority(
+    std::string_view interface_name, AstarteSendPriority priority) {
+  outbound_->set_interface_priority(interface_name, priority);
+}
+
+auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::get_send_lane_stats(
+    AstarteSendPriority priority) const -> AstarteSendLaneStats {
+  return outbound_->get_stats(priority);
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::set_rpc_stats(bool enabled) {
+  hub_connection_->set_rpc_stats(enabled);
+}
+
+auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::get_rpc_stats() const
+    -> std::vector<AstarteRpcStats> {
+  return hub_connection_->get_rpc_stats();
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::set_datastream_aggregation(
+    std::string_view interface_name, const AstarteDatastreamAggregation& aggregation) {
+  datastream_aggregator_->set_aggregation(interface_name, aggregation);
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::remove_datastream_aggregation(
+    std::string_view interface_name) {
+  send_aggregated_objects(datastream_aggregator_->remove_aggregation(interface_name));
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::flush_datastream_aggregations() {
+  send_aggregated_objects(datastream_aggregator_->take_all());
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::send_aggregated_objects(
+    std::vector<AggregatedObject> objects) {
+  if (objects.empty()) {
+    return;
+  }
+  if (!connected_.load()) {
+    ASTARTE_LOG_WARN("Device disconnected, dropping {} aggregated objects.", objects.size());
     return;
   }
-  spdlog::debug("Attempting to connect to the message hub at {}", server_addr_);
+  for (const AggregatedObject& object : objects) {
+    send_message(make_aggregated_message(object), on_aggregated_sent(object));
+  }
+}
+
+// Invoked on the timer wheel thread, which must never block on a send
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::on_aggregation_expired(AggregatedObject object) {
+  // Failures are logged by the call itself, nobody is waiting for the result
+  static_cast<void>(
+      async_send_message(make_aggregated_message(object), on_aggregated_sent(object)));
+}
+
+auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::make_aggregated_message(
+    const AggregatedObject& object) -> gRPCAstarteMessage {
+  const std::chrono::system_clock::time_point* timestamp =
+      object.timestamp.has_value() ? &object.timestamp.value() : nullptr;
+  return make_object_message(object.interface_name, object.path, object.object, timestamp);
+}
+
+// The samples of the window were checked by the filters on the paths of the source interface
+auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::on_aggregated_sent(const AggregatedObject& object)
+    -> OnSent {
+  if (!datastream_filters_->is_enabled()) {
+    return nullptr;
+  }
+  return [filters = datastream_filters_, object] {
+    const std::chrono::system_clock::time_point timestamp =
+        object.timestamp.value_or(std::chrono::system_clock::now());
+    const std::string prefix = (object.path == "/") ? "" : object.path;
+    for (const auto& [field, value] : object.object) {
+      filters->record(object.source_interface_name, prefix + "/" + field, value, &timestamp);
+    }
+  };
+}
+
+template <typename Sample>
+auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::admit_sample(
+    std::string_view interface_name, std::string_view path, const Sample& sample,
+    const std::chrono::system_clock::time_point* timestamp) -> bool {
+  if (!datastream_filters_->admit(interface_name, path, sample, timestamp)) {
+    ASTARTE_LOG_TRACE("Sample dropped by the datastream filter: {} {}", interface_name, path);
+    return false;
+  }
+  return true;
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::set_property_dedup(bool enabled) {
+  property_dedup_->set_enabled(enabled);
+}
+
+auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::get_suppressed_property_sends() const -> uint64_t {
+  return property_dedup_->get_suppressed_count();
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::set_executor(
+    std::shared_ptr<AstarteExecutor> executor) {
+  {
+    const std::lock_guard<std::mutex> lock(connection_mutex_);
+    if (state_ != ConnectionState::kIdle) {
+      const std::string_view msg("The executor can't be changed while the device is connecting.");
+      ASTARTE_LOG_WARN(msg);
+      throw AstarteOperationRefusedException(msg);
+    }
+  }
+  // Events of a previous connection might still be handled by the old executor
+  strand_.wait_idle();
+  strand_.set_executor(std::move(executor));
+}
+
+auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::run_once(const std::chrono::milliseconds& budget)
+    -> std::size_t {
+  if (!manual_drive_) {
+    const std::string_view msg("The device is not in manual drive mode.");
+    ASTARTE_LOG_WARN(msg);
+    throw AstarteOperationRefusedException(msg);
+  }
 
-  // Create a new channel and initialize the gRPC stub
-  setup_grpc_channel();
+  const auto deadline = std::chrono::system_clock::now() + budget;
+  check_reconnection_deadline();
+  queue_expired_aggregations();
+  const std::chrono::nanoseconds rate_limited = flush_pending_sends();
+
+  // Wait for the first completion, without oversleeping a pending reconnection, the messages
+  // held back by the rate limits or the expiry of an aggregation window
+  auto wait_until = deadline;
+  if (rate_limited.count() != 0) {
+    const auto retry = std::chrono::ceil<std::chrono::microseconds>(rate_limited);
+    wait_until = std::min(wait_until, std::chrono::system_clock::now() + retry);
+  }
+  if (auto window_deadline = datastream_aggregator_->get_next_deadline()) {
+    const auto remaining = std::chrono::ceil<std::chrono::microseconds>(
+        window_deadline.value() - std::chrono::steady_clock::now());
+    wait_until = std::min(wait_until, std::chrono::system_clock::now() + remaining);
+  }
+  {
+    const std::lock_guard<std::mutex> lock(connection_mutex_);
+    if (state_ == ConnectionState::kBackoff) {
+      wait_until = std::min(wait_until, reconnection_deadline_);
+    }
+  }
+
+  std::size_t handled = 0;
+  void* tag = nullptr;
+  bool ok = false;
+  while (cq_.AsyncNext(&tag, &ok, wait_until) == grpc::CompletionQueue::GOT_EVENT) {
+    static_cast<CompletionTag*>(tag)->proceed(ok);
+    handled++;
+    // Following completions are only handled if already available
+    wait_until = std::chrono::system_clock::now();
+    if (wait_until >= deadline) {
+      break;
+    }
+  }
 
-  // perform the attach
-  auto attach_res = perform_attach();
-  if (!attach_res) {
-    spdlog::error("Failed to attach to the message hub");
+  check_reconnection_deadline();
+  queue_expired_aggregations();
+  flush_pending_sends();
+  return handled;
+}
+
+// In manual drive the windows expire on the thread driving the device
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::queue_expired_aggregations() {
+  for (const AggregatedObject& object :
+       datastream_aggregator_->take_expired(std::chrono::steady_clock::now())) {
+    pending_sends_.push_back({make_aggregated_message(object), on_aggregated_sent(object)});
+  }
+}
+
+// The channel can be shared between multiple nodes, so the node id is added to each call.
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::setup_client_context(ClientContext& context) const {
+  context.AddMetadata("node-id", node_uuid_);
+}
+
+// Small messages skip the compression of the channel, which would cost CPU time for no gain.
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::setup_send_compression(
+    ClientContext& context, const gRPCAstarteMessage& message) const {
+  if (hub_connection_->get_compression().get_algorithm() == AstarteCompression::Algorithm::kNone) {
     return;
   }
+  context.set_compression_algorithm(
+      hub_connection_->get_message_compression(message.ByteSizeLong()));
+}
 
-  // the device is connected
-  connected_.store(true);
-  spdlog::info("Node connected");
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::send_message(gRPCAstarteMessage message,
+                                                            OnSent on_sent) {
+  if (manual_drive_) {
+    // The message will be sent by the next run_once call
+    pending_sends_.push_back({std::move(message), std::move(on_sent)});
+    return;
+  }
 
-  std::jthread event_handler(&AstarteDeviceGRPCImpl::handle_events, this, token,
-                             std::move(attach_res->context), std::move(attach_res->reader));
+  const RateLimiter::Admission admission = admit_message(message);
+  switch (admission.action) {
+    case RateLimiter::Admission::Action::kSend:
+      break;
+    case RateLimiter::Admission::Action::kWait:
+      std::this_thread::sleep_for(admission.delay);
+      break;
+    case RateLimiter::Admission::Action::kDefer:
+      // A deferred property could reach the hub after a newer value of the same path
+      if (message.has_property_individual()) {
+        std::this_thread::sleep_for(admission.delay);
+        break;
+      }
+      send_deferred(std::move(message), admission.delay, std::move(on_sent));
+      return;
+    case RateLimiter::Admission::Action::kDrop:
+      ASTARTE_LOG_TRACE("Message dropped by the rate limit: {} {}", message.interface_name(),
+                        message.path());
+      return;
+  }
+
+  // Sent on its priority lane, so that a backlog of other sends can't delay it indefinitely
+  std::promise<Status> done;
+  start_scheduled_send(message, [&done](const Status& status) { done.set_value(status); });
+  const Status status = done.get_future().get();
+  if (!status.ok()) {
+    ASTARTE_LOG_ERROR("{}: {}", static_cast<int>(status.error_code()), status.error_message());
+    throw AstarteInvalidInputException(status.error_message());
+  }
+  if (on_sent) {
+    on_sent();
+  }
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::send_batch(
+    const std::vector<gRPCAstarteMessage*>& messages) {
+  if (!connected_.load()) {
+    const std::string_view msg("Device disconnected, operation aborted.");
+    ASTARTE_LOG_WARN(msg);
+    throw AstarteOperationRefusedException(msg);
+  }
+  if (manual_drive_) {
+    // The messages will be sent by the next run_once call
+    for (const gRPCAstarteMessage* message : messages) {
+      pending_sends_.push_back({*message, nullptr});
+    }
+    return;
+  }
+
+  // Each message is checked on its own, and started no earlier than its admission allows
+  std::vector<const gRPCAstarteMessage*> admitted;
+  std::vector<std::chrono::steady_clock::time_point> not_before;
+  admitted.reserve(messages.size());
+  not_before.reserve(messages.size());
+  for (gRPCAstarteMessage* message : messages) {
+    const RateLimiter::Admission admission = admit_message(*message);
+    switch (admission.action) {
+      case RateLimiter::Admission::Action::kSend:
+        admitted.push_back(message);
+        not_before.emplace_back();
+        break;
+      case RateLimiter::Admission::Action::kWait:
+        admitted.push_back(message);
+        not_before.push_back(
+            std::chrono::steady_clock::now() +
+            std::chrono::ceil<std::chrono::steady_clock::duration>(admission.delay));
+        break;
+      case RateLimiter::Admission::Action::kDefer:
+        send_deferred(*message, admission.delay);
+        break;
+      case RateLimiter::Admission::Action::kDrop:
+        break;
+    }
+  }
+  if (admitted.size() != messages.size()) {
+    ASTARTE_LOG_DEBUG("{} of {} messages deferred or dropped by the rate limits",
+                      messages.size() - admitted.size(), messages.size());
+  }
+
+  // The samples carry their own timestamp, so they can be sent in any order
+  SendPipeline pipeline(MAX_PIPELINED_SENDS, [this, &admitted, &not_before](
+                                                 std::size_t index, SendPipeline::OnDone on_done) {
+    start_scheduled_send(*admitted[index], std::move(on_done), not_before[index]);
+  });
+  const std::vector<Status> results = pipeline.run(admitted.size());
+
+  std::optional<Status> first_error;
+  std::size_t rejected = 0;
+  for (const Status& status : results) {
+    if (!status.ok()) {
+      if (rejected == 0) {
+        first_error.emplace(status);
+      }
+      rejected++;
+    }
+  }
+  if (rejected == 0) {
+    return;
+  }
+  ASTARTE_LOG_ERROR("{} of {} messages rejected, {}: {}", rejected, results.size(),
+                    static_cast<int>(first_error->error_code()), first_error->error_message());
+  throw AstarteInvalidInputException(first_error->error_message());
+}
+
+// The message is owned by the caller, which waits for the send to complete
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::start_scheduled_send(
+    const gRPCAstarteMessage& message, OutboundScheduler::OnDone on_done,
+    std::chrono::steady_clock::time_point not_before) {
+  auto call =
+      std::make_shared<AsyncUnaryCall<const gRPCAstarteMessage*, google::protobuf::Empty>>();
+  setup_client_context(call->context);
+  call->request = &message;
+  OutboundScheduler::StartSend start = [this, call](OutboundScheduler::OnDone lane_done) {
+    // The call data is released together with the completion callback
+    start_send_rpc(&call->context, call->request, &call->response,
+                   [call, lane_done = std::move(lane_done)](const Status& status) {
+                     lane_done(status);
+                   });
+  };
+  const std::chrono::nanoseconds delay = not_before - std::chrono::steady_clock::now();
+  if (delay.count() > 0) {
+    outbound_->submit_after(delay, get_message_priority(message), std::move(start),
+                            std::move(on_done));
+    return;
+  }
+  outbound_->submit(get_message_priority(message), std::move(start), std::move(on_done));
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::start_send_rpc(ClientContext* context,
+                                                              const gRPCAstarteMessage* message,
+                                                              google::protobuf::Empty* response,
+                                                              OutboundScheduler::OnDone on_done) {
+  setup_send_compression(*context, *message);
+  // The property tables are shared with the callback, which might outlive the device
+  stub_->async()->Send(context, message, response,
+                       [cache = property_cache_, dedup = property_dedup_,
+                        filters = datastream_filters_, metrics = &metrics_,
+                        started = std::chrono::steady_clock::now(), message,
+                        on_done = std::move(on_done)](const Status& status) {
+                         record_send(*metrics, started, status);
+                         if (status.ok()) {
+                           on_property_sent(*cache, *dedup, *message);
+                           on_datastream_sent(*filters, *message);
+                         }
+                         on_done(status);
+                       });
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::record_send(
+    SdkMetrics& metrics, std::chrono::steady_clock::time_point started, const Status& status) {
+  metrics.send_latency.record(std::chrono::steady_clock::now() - started);
+  if (status.ok()) {
+    metrics.messages_sent.add();
+  } else {
+    metrics.send_failures.add();
+  }
+}
+
+auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::get_message_priority(
+    const gRPCAstarteMessage& message) -> AstarteSendPriority {
+  return outbound_->get_priority(message.interface_name(), message.has_property_individual());
+}
+
+auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::admit_message(const gRPCAstarteMessage& message)
+    -> RateLimiter::Admission {
+  // The encoded size is only computed when needed
+  if (!rate_limiter_.is_enabled()) {
+    return {};
+  }
+  return rate_limiter_.admit(message.interface_name(), message.ByteSizeLong(),
+                             std::chrono::steady_clock::now());
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::send_deferred(gRPCAstarteMessage message,
+                                                             std::chrono::nanoseconds delay,
+                                                             OnSent on_sent) {
+  auto call = std::make_shared<AsyncUnaryCall<gRPCAstarteMessage, google::protobuf::Empty>>();
+  setup_client_context(call->context);
+  call->request = std::move(message);
+  outbound_->submit_after(
+      delay, get_message_priority(call->request),
+      [this, call](OutboundScheduler::OnDone lane_done) {
+        start_send_rpc(&call->context, &call->request, &call->response,
+                       [call, lane_done = std::move(lane_done)](const Status& status) {
+                         lane_done(status);
+                       });
+      },
+      // Nobody is waiting for the result
+      [on_sent = std::move(on_sent)](const Status& status) {
+        if (!status.ok()) {
+          ASTARTE_LOG_ERROR("Deferred send failed, {}: {}", static_cast<int>(status.error_code()),
+                            status.error_message());
+        } else if (on_sent) {
+          on_sent();
+        }
+      });
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::on_property_sent(PropertyCache& cache,
+                                                                PropertyDedupTable& dedup,
+                                                                const gRPCAstarteMessage& message) {
+  if (!message.has_property_individual() || (!cache.is_enabled() && !dedup.is_enabled())) {
+    return;
+  }
+  const AstartePropertyIndividual property = GrpcConverterFrom{}(message.property_individual());
+  const std::optional<AstarteData>& value = property.get_value();
+  cache.update(message.interface_name(), message.path(), value);
+  if (value.has_value()) {
+    dedup.record(message.interface_name(), message.path(), value.value());
+  }
+}
+
+// The filters compare the next samples against the ones accepted by the message hub
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::on_datastream_sent(
+    DatastreamFilterTable& filters, const gRPCAstarteMessage& message) {
+  if (!filters.is_enabled()) {
+    return;
+  }
+  // The samples without a timestamp were sent at the current time
+  const auto sample_time = [](const auto& sample) -> std::chrono::system_clock::time_point {
+    if (!sample.has_timestamp()) {
+      return std::chrono::system_clock::now();
+    }
+    const google::protobuf::Timestamp& timestamp = sample.timestamp();
+    auto secs = std::chrono::seconds{timestamp.seconds()};
+    auto nanos = std::chrono::nanoseconds{timestamp.nanos()};
+    return std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(secs + nanos));
+  };
+  if (message.has_datastream_individual()) {
+    const gRPCAstarteDatastreamIndividual& individual = message.datastream_individual();
+    const std::chrono::system_clock::time_point timestamp = sample_time(individual);
+    filters.record(message.interface_name(), message.path(),
+                   GrpcConverterFrom{}(individual.data()), &timestamp);
+  } else if (message.has_datastream_object()) {
+    const std::chrono::system_clock::time_point timestamp =
+        sample_time(message.datastream_object());
+    const AstarteDatastreamObject object = GrpcConverterFrom{}(message.datastream_object());
+    filters.record(message.interface_name(), message.path(), object, &timestamp);
+  }
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::request_property_snapshot() {
+  const uint64_t generation = property_cache_->begin_snapshot();
+  auto call = std::make_shared<AsyncUnaryCall<gRPCPropertyFilter, gRPCStoredProperties>>();
+  setup_client_context(call->context);
+  stub_->async()->GetAllProperties(
+      &call->context, &call->request, &call->response,
+      [call, cache = property_cache_, generation](const Status& status) {
+        if (!status.ok()) {
+          ASTARTE_LOG_WARN("Failed to load the properties in the cache: {}",
+                           status.error_message());
+          return;
+        }
+        cache->load_snapshot(generation, GrpcConverterFrom{}(call->response));
+      });
+}
+
+auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::async_send_message(gRPCAstarteMessage message,
+                                                                  OnSent on_sent)
+    -> AstarteAwaitable<void> {
+  RateLimiter::Admission admission;
+  if (connected_.load() && !manual_drive_) {
+    admission = admit_message(message);
+  }
+  if (admission.action == RateLimiter::Admission::Action::kDrop) {
+    ASTARTE_LOG_TRACE("Message dropped by the rate limit: {} {}", message.interface_name(),
+                      message.path());
+    return make_ready_awaitable();
+  }
+
+  // Never blocks, both waiting and deferred messages complete once sent after their delay
+  return async_unary_call<void, google::protobuf::Empty>(
+      std::move(message),
+      [this, delay = admission.delay, on_sent = std::move(on_sent)](
+          ClientContext* context, const gRPCAstarteMessage* request,
+          google::protobuf::Empty* response, std::function<void(Status)> on_done) {
+        OutboundScheduler::StartSend start =
+            [this, context, request, response](OutboundScheduler::OnDone lane_done) {
+              start_send_rpc(context, request, response, std::move(lane_done));
+            };
+        OutboundScheduler::OnDone done = [on_sent, on_done = std::move(on_done)](
+                                             const Status& status) {
+          if (status.ok() && on_sent) {
+            on_sent();
+          }
+          on_done(status);
+        };
+        if (delay.count() == 0) {
+          outbound_->submit(get_message_priority(*request), std::move(start), std::move(done));
+        } else {
+          outbound_->submit_after(delay, get_message_priority(*request), std::move(start),
+                                  std::move(done));
+        }
+      });
+}
+
+auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::make_ready_awaitable() -> AstarteAwaitable<void> {
+  auto state = std::make_shared<AstarteAsyncState<void>>();
+  state->set_value();
+  return AstarteAwaitable<void>(state);
+}
+
+template <typename T>
+auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::make_ready_awaitable(T value)
+    -> AstarteAwaitable<T> {
+  auto state = std::make_shared<AstarteAsyncState<T>>();
+  state->set_value(std::move(value));
+  return AstarteAwaitable<T>(state);
+}
+
+template <typename T, typename Response, typename Request, typename Rpc>
+auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::async_unary_call(Request request, Rpc rpc)
+    -> AstarteAwaitable<T> {
+  auto state = std::make_shared<AstarteAsyncState<T>>(strand_.get_executor());
+  if (!connected_.load() || manual_drive_) {
+    const std::string_view msg = manual_drive_
+                                     ? "Asynchronous operations are not available in manual drive."
+                                     : "Device disconnected, operation aborted.";
+    ASTARTE_LOG_WARN(msg);
+    state->set_exception(std::make_exception_ptr(AstarteOperationRefusedException(msg)));
+    return AstarteAwaitable<T>(state);
+  }
+
+  // The call data must outlive the RPC, it's released together with the completion callback
+  auto call = std::make_shared<AsyncUnaryCall<Request, Response>>();
+  setup_client_context(call->context);
+  call->request = std::move(request);
+  rpc(&call->context, &call->request, &call->response, [call, state](const Status& status) {
+    if (!status.ok()) {
+      ASTARTE_LOG_ERROR("{}: {}", static_cast<int>(status.error_code()), status.error_message());
+      state->set_exception(
+          std::make_exception_ptr(AstarteInvalidInputException(status.error_message())));
+      return;
+    }
+    if constexpr (std::is_void_v<T>) {
+      state->set_value();
+    } else {
+      std::optional<T> result;
+      try {
+        result.emplace(GrpcConverterFrom{}(call->response));
+      } catch (...) {
+        state->set_exception(std::current_exception());
+        return;
+      }
+      state->set_value(std::move(result.value()));
+    }
+  });
+  return AstarteAwaitable<T>(state);
+}
+
+auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::make_individual_message(
+    std::string_view interface_name, std::string_view path, const AstarteData& data,
+    const std::chrono::system_clock::time_point* timestamp) -> gRPCAstarteMessage {
+  gRPCAstarteMessage message;
+  message.set_interface_name(interface_name);
+  message.set_path(path);
+
+  GrpcConverterTo converter;
+  std::unique_ptr<gRPCAstarteDatastreamIndividual> grpc_datastream_individual =
+      converter(data, timestamp);
+  message.set_allocated_datastream_individual(grpc_datastream_individual.release());
+  return message;
+}
+
+auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::make_object_message(
+    std::string_view interface_name, std::string_view path, const AstarteDatastreamObject& object,
+    const std::chrono::system_clock::time_point* timestamp) -> gRPCAstarteMessage {
+  gRPCAstarteMessage message;
+  message.set_interface_name(interface_name);
+  message.set_path(path);
+
+  GrpcConverterTo converter;
+  std::unique_ptr<gRPCAstarteDatastreamObject> grpc_datastream_object =
+      converter(object, timestamp);
+  message.set_allocated_datastream_object(grpc_datastream_object.release());
+  return message;
+}
+
+auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::make_property_message(
+    std::string_view interface_name, std::string_view path, const std::optional<AstarteData>& data)
+    -> gRPCAstarteMessage {
+  gRPCAstarteMessage message;
+  message.set_interface_name(interface_name);
+  message.set_path(path);
+
+  GrpcConverterTo converter;
+  std::unique_ptr<gRPCAstartePropertyIndividual> grpc_property_individual = converter(data);
+  message.set_allocated_property_individual(grpc_property_individual.release());
+  return message;
+}
+
+auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::flush_pending_sends() -> std::chrono::nanoseconds {
+  while (!pending_sends_.empty()) {
+    const gRPCAstarteMessage& message = pending_sends_.front().message;
+    if (rate_limiter_.is_enabled()) {
+      // Messages over the limits are retried by the next iteration, keeping their order
+      const RateLimiter::Admission admission = rate_limiter_.try_admit(
+          message.interface_name(), message.ByteSizeLong(), std::chrono::steady_clock::now());
+      if (admission.action == RateLimiter::Admission::Action::kWait) {
+        return admission.delay;
+      }
+      if (admission.action == RateLimiter::Admission::Action::kDrop) {
+        ASTARTE_LOG_TRACE("Message dropped by the rate limit: {} {}", message.interface_name(),
+                          message.path());
+        pending_sends_.pop_front();
+        continue;
+      }
+    }
+    // The call deletes itself when the response is received, see SendCall::proceed
+    new SendCall(*this, std::move(pending_sends_.front()));
+    pending_sends_.pop_front();
+    pending_send_calls_++;
+  }
+  return std::chrono::nanoseconds(0);
+}
 
-  // Wait for the event stream to finish.
-  if (event_handler.joinable()) {
-    event_handler.join();
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::check_reconnection_deadline() {
+  {
+    const std::lock_guard<std::mutex> lock(connection_mutex_);
+    if ((state_ != ConnectionState::kBackoff) ||
+        (std::chrono::system_clock::now() < reconnection_deadline_)) {
+      return;
+    }
   }
 
-  // the device finished its execution and is disconnected
-  connected_.store(false);
-  spdlog::info("Node disconnected");
+  start_attach();
+}
+
+// Block until all the operations started on the completion queue have been completed
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::drain_completion_queue() {
+  void* tag = nullptr;
+  bool ok = false;
+  while (((attach_call_ != nullptr) || (pending_send_calls_ > 0)) && cq_.Next(&tag, &ok)) {
+    static_cast<CompletionTag*>(tag)->proceed(ok);
+  }
 }
 
-void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::handle_events(
-    const std::stop_token& token, std::unique_ptr<grpc::ClientContext> context,
-    std::unique_ptr<ClientReader<gRPCMessageHubEvent>> reader) {
-  (void)context;
-  spdlog::debug("Event handler thread has been started");
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::start_attach() {
+  AttachCall* attach_call = nullptr;
+  AttachReactor* reactor = nullptr;
+  {
+    const std::lock_guard<std::mutex> lock(connection_mutex_);
+    if (stop_requested_) {
+      state_ = ConnectionState::kIdle;
+      connection_cv_.notify_all();
+      return;
+    }
+    ASTARTE_LOG_DEBUG("Attempting to connect to the message hub at {}",
+                      hub_connection_->get_server_addr());
+    metrics_.connection_attempts.add();
+
+    // Create the node message for the attach RPC.
+    gRPCNode node;
+    for (const std::string& interface_json : interfaces_bins_) {
+      node.add_interfaces_json(interface_json);
+    }
+
+    if (manual_drive_) {
+      // The call deletes itself when the RPC is done, see AttachCall::proceed
+      attach_call = new AttachCall(*this, node);
+      attach_call_ = attach_call;
+    } else {
+      // The reactor is deleted when the RPC is done, see on_detached
+      reactor = new AttachReactor(*this, std::move(node));
+      reactor_ = reactor;
+    }
+    state_ = ConnectionState::kAttaching;
+  }
+
+  if (attach_call != nullptr) {
+    attach_call->start();
+    return;
+  }
+  // Reactions might be invoked inline, so the lock must not be held while starting the RPC.
+  reactor->start();
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::on_attached() {
+  {
+    const std::lock_guard<std::mutex> lock(connection_mutex_);
+    state_ = ConnectionState::kConnected;
+    backoff_.reset();
+    // the device is connected
+    connected_.store(true);
+    ASTARTE_LOG_INFO("Node connected");
+  }
+
+  // Populate the property cache, the callback API can't be used in manual drive mode
+  if (property_cache_->is_enabled() && !manual_drive_) {
+    request_property_snapshot();
+  }
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::on_event(gRPCMessageHubEvent event) {
+  ASTARTE_LOG_DEBUG("Event from the message hub received.");
+  // In manual drive mode all the work is performed by the thread calling run_once
+  if (manual_drive_) {
+    handle_event(event);
+    return;
+  }
+  // The strand keeps the events ordered even on a multi threaded executor
+  strand_.post([this, event = std::move(event)] { handle_event(event); });
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::handle_event(const gRPCMessageHubEvent& event) {
+  metrics_.events_received.add();
+  std::optional<AstarteMessage> parsed_event = AstarteDeviceGRPCImpl::parse_message_hub_event(event);
+  if (!parsed_event.has_value()) {
+    return;
+  }
+
+  const AstarteMessage& message = parsed_event.value();
+  if (!message.is_datastream() && property_cache_->is_enabled()) {
+    property_cache_->update(message.get_interface(), message.get_path(),
+                            message.into<AstartePropertyIndividual>().get_value());
+  }
 
-  gRPCMessageHubEvent msghub_event;
-  while (!token.stop_requested() && reader->Read(&msghub_event)) {
-    spdlog::debug("Event from the message hub received.");
-    std::optional<AstarteMessage> parsed_event =
-        AstarteDeviceGRPCImpl::parse_message_hub_event(msghub_event);
-    if (parsed_event.has_value()) {
-      const AstarteMessage& parsed_message = parsed_event.value();
-      this->rcv_queue_.push(parsed_message);
+  // Coroutines waiting in next_message have precedence over the reception queue
+  std::shared_ptr<AstarteAsyncState<AstarteMessage>> waiter;
+  {
+    const std::lock_guard<std::mutex> lock(message_waiters_mutex_);
+    while (!waiter && !message_waiters_.empty()) {
+      waiter = message_waiters_.front().lock();
+      message_waiters_.pop_front();
+    }
+    if (!waiter) {
+      this->rcv_queue_.push(parsed_event.value());
+      return;
     }
   }
-  spdlog::info("Message hub stream has been interrupted.");
+  waiter->set_value(std::move(parsed_event.value()));
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::on_detached(const grpc::Status& status) {
+  const std::lock_guard<std::mutex> lock(connection_mutex_);
+  // Released before stop_connection can see the stream as terminated, otherwise the device and its
+  // channel might be destroyed while the context of the reactor still references them
+  delete reactor_;
+  reactor_ = nullptr;
+  attach_call_ = nullptr;
+  // Properties might change while disconnected
+  property_cache_->invalidate();
+  property_dedup_->clear();
+
+  if (connected_.exchange(false)) {
+    // the device finished its execution and is disconnected
+    ASTARTE_LOG_INFO("Node disconnected");
+  } else if (!stop_requested_) {
+    ASTARTE_LOG_ERROR("Failed to attach to the message hub");
+  }
 
   // Log an error if the stream has been stopped due to a failure.
-  const Status status = reader->Finish();
-  if (!status.ok() && !token.stop_requested()) {
+  if (!status.ok() && !stop_requested_) {
     grpc_stream_error_.store(true);
-    spdlog::error("{}: {}", static_cast<int>(status.error_code()), status.error_message());
+    ASTARTE_LOG_ERROR("{}: {}", static_cast<int>(status.error_code()), status.error_message());
+  }
+
+  if (stop_requested_) {
+    ASTARTE_LOG_INFO("Stop requested, will not attempt to reconnect.");
+    state_ = ConnectionState::kIdle;
+    connection_cv_.notify_all();
+    return;
+  }
+
+  schedule_reconnection();
+}
+
+// Must be called with the connection mutex held
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::schedule_reconnection() {
+  state_ = ConnectionState::kBackoff;
+  metrics_.reconnections.add();
+  auto delay = backoff_.getNextDelay();
+  ASTARTE_LOG_INFO("Will attempt to reconnect in {} seconds.",
+                   std::chrono::duration_cast<std::chrono::seconds>(delay).count());
+
+  if (manual_drive_) {
+    // The deadline is checked by run_once
+    reconnection_deadline_ = std::chrono::system_clock::now() + delay;
+    return;
+  }
+
+  // Destroying a previous (already expired) alarm is safe even if its callback is still running.
+  reconnection_alarm_ = std::make_unique<grpc::Alarm>();
+  pending_alarms_++;
+  reconnection_alarm_->Set(std::chrono::system_clock::now() + delay, [this](bool expired) {
+    strand_.post([this, expired] { this->on_reconnection_timer(expired); });
+  });
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::on_reconnection_timer(bool expired) {
+  {
+    const std::lock_guard<std::mutex> lock(connection_mutex_);
+    pending_alarms_--;
+    if (!expired || stop_requested_) {
+      state_ = ConnectionState::kIdle;
+      connection_cv_.notify_all();
+      return;
+    }
+  }
+
+  start_attach();
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::stop_connection() {
+  if (manual_drive_) {
+    stop_manual_connection();
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(connection_mutex_);
+  stop_requested_ = true;
+  if ((state_ == ConnectionState::kIdle) && (reactor_ == nullptr) && (pending_alarms_ == 0)) {
+    return;
+  }
+  if (reactor_ != nullptr) {
+    reactor_->cancel();
+  }
+  if (reconnection_alarm_) {
+    reconnection_alarm_->Cancel();
+  }
+
+  // Wait for the Attach RPC and the reconnection timer to report their termination, the callbacks
+  // reference this object so it can't be destroyed before.
+  connection_cv_.wait(lock, [this] { return (reactor_ == nullptr) && (pending_alarms_ == 0); });
+  state_ = ConnectionState::kIdle;
+  ASTARTE_LOG_INFO("Connection loop has been terminated.");
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::stop_manual_connection() {
+  {
+    const std::lock_guard<std::mutex> lock(connection_mutex_);
+    stop_requested_ = true;
+    if ((state_ == ConnectionState::kIdle) && (attach_call_ == nullptr) &&
+        (pending_send_calls_ == 0) && pending_sends_.empty()) {
+      return;
+    }
+    if (attach_call_ != nullptr) {
+      attach_call_->cancel();
+    }
+  }
+
+  if (!pending_sends_.empty()) {
+    ASTARTE_LOG_WARN("Discarding {} messages that have not been sent.", pending_sends_.size());
+    pending_sends_.clear();
+  }
+
+  // No one else is driving the completion queue, wait here for the cancellation to complete
+  drain_completion_queue();
+
+  const std::lock_guard<std::mutex> lock(connection_mutex_);
+  state_ = ConnectionState::kIdle;
+  ASTARTE_LOG_INFO("Connection loop has been terminated.");
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::fail_message_waiters() {
+  std::deque<std::weak_ptr<AstarteAsyncState<AstarteMessage>>> waiters;
+  {
+    const std::lock_guard<std::mutex> lock(message_waiters_mutex_);
+    waiters.swap(message_waiters_);
+  }
+  for (const auto& weak_waiter : waiters) {
+    if (const auto waiter = weak_waiter.lock()) {
+      waiter->set_exception(std::make_exception_ptr(
+          AstarteOperationRefusedException("Device destroyed while waiting for a message.")));
+    }
   }
 }
 
 auto AstarteDeviceGRPC::AstarteDeviceGRPCImpl::parse_message_hub_event(
     const gRPCMessageHubEvent& event) -> std::optional<AstarteMessage> {
-  spdlog::trace("Parsing message hub event.");
+  ASTARTE_LOG_TRACE("Parsing message hub event.");
   std::optional<AstarteMessage> res = std::nullopt;
   if (event.has_message()) {
     const gRPCAstarteMessage& astarteMessage = event.message();
     res = GrpcConverterFrom{}(astarteMessage);
   } else if (event.has_error()) {
     const gRPCMessageHubError& error = event.error();
-    spdlog::error("Message hub error: {}", error.description());
-    spdlog::error("Error source backtrace: ");
+    ASTARTE_LOG_ERROR("Message hub error: {}", error.description());
+    ASTARTE_LOG_ERROR("Error source backtrace: ");
     for (const std::string& source : error.source()) {
-      spdlog::error("  {}", source);
+      ASTARTE_LOG_ERROR("  {}", source);
     }
   } else {
-    spdlog::error("Unknown event type!");
+    ASTARTE_LOG_ERROR("Unknown event type!");
   }
   return res;
 }
 
-void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::connection_loop(const std::stop_token& token) {
-  spdlog::trace("Connection loop started.");
-  ExponentialBackoff backoff(std::chrono::seconds(2), std::chrono::minutes(1));
+AstarteDeviceGRPC::AstarteDeviceGRPCImpl::AttachReactor::AttachReactor(
+    AstarteDeviceGRPCImpl& device, gRPCNode node)
+    : device_(device), node_(std::move(node)) {
+  device_.setup_client_context(context_);
+}
 
-  while (!token.stop_requested()) {
-    connection_attempt(token);
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::AttachReactor::start() {
+  device_.stub_->async()->Attach(&context_, &node_, this);
+  StartRead(&event_);
+  StartCall();
+}
 
-    if (token.stop_requested()) {
-      spdlog::info("Stop requested, will not attempt to reconnect.");
-      break;
-    }
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::AttachReactor::cancel() { context_.TryCancel(); }
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::AttachReactor::OnReadInitialMetadataDone(bool ok) {
+  if (!ok) {
+    // The stream failed before receiving the metadata, OnDone will report the status.
+    return;
+  }
+
+  if (context_.GetServerInitialMetadata().empty()) {
+    ASTARTE_LOG_WARN("No metadata from server");
+    device_.grpc_stream_error_.store(true);
+    context_.TryCancel();
+    return;
+  }
 
-    auto delay = backoff.getNextDelay();
-    spdlog::info("Will attempt to reconnect in {} seconds.",
-                 std::chrono::duration_cast<std::chrono::seconds>(delay).count());
-    std::this_thread::sleep_for(delay);
+  device_.grpc_stream_error_.store(false);
+  device_.on_attached();
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::AttachReactor::OnReadDone(bool ok) {
+  if (!ok) {
+    ASTARTE_LOG_INFO("Message hub stream has been interrupted.");
+    return;
   }
 
-  spdlog::info("Connection loop has been terminated.");
+  device_.on_event(std::move(event_));
+  StartRead(&event_);
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::AttachReactor::OnDone(const grpc::Status& status) {
+  // No reaction will be invoked after OnDone, the device releases the reactor. The status is owned
+  // by the call, which is released together with the context.
+  const grpc::Status final_status = status;
+  device_.on_detached(final_status);
+}
+
+AstarteDeviceGRPC::AstarteDeviceGRPCImpl::AttachCall::AttachCall(AstarteDeviceGRPCImpl& device,
+                                                                 const gRPCNode& node)
+    : device_(device) {
+  device_.setup_client_context(context_);
+  reader_ = device_.stub_->PrepareAsyncAttach(&context_, node, &device_.cq_);
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::AttachCall::start() { reader_->StartCall(this); }
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::AttachCall::cancel() { context_.TryCancel(); }
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::AttachCall::proceed(bool ok) {
+  switch (step_) {
+    case Step::kStart:
+      if (!ok) {
+        finish();
+        return;
+      }
+      step_ = Step::kMetadata;
+      reader_->ReadInitialMetadata(this);
+      break;
+    case Step::kMetadata:
+      if (!ok) {
+        finish();
+        return;
+      }
+      if (context_.GetServerInitialMetadata().empty()) {
+        ASTARTE_LOG_WARN("No metadata from server");
+        device_.grpc_stream_error_.store(true);
+        context_.TryCancel();
+        finish();
+        return;
+      }
+      device_.grpc_stream_error_.store(false);
+      device_.on_attached();
+      step_ = Step::kRead;
+      reader_->Read(&event_, this);
+      break;
+    case Step::kRead:
+      if (!ok) {
+        ASTARTE_LOG_INFO("Message hub stream has been interrupted.");
+        finish();
+        return;
+      }
+      device_.on_event(std::move(event_));
+      reader_->Read(&event_, this);
+      break;
+    case Step::kFinish:
+      device_.on_detached(status_);
+      // No other completion will be generated for this call, it can be safely released.
+      delete this;
+      break;
+  }
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::AttachCall::finish() {
+  step_ = Step::kFinish;
+  reader_->Finish(&status_, this);
+}
+
+AstarteDeviceGRPC::AstarteDeviceGRPCImpl::SendCall::SendCall(AstarteDeviceGRPCImpl& device,
+                                                             PendingSend send)
+    : device_(device),
+      message_(std::move(send.message)),
+      on_sent_(std::move(send.on_sent)),
+      started_(std::chrono::steady_clock::now()) {
+  device_.setup_client_context(context_);
+  device_.setup_send_compression(context_, message_);
+  reader_ = device_.stub_->AsyncSend(&context_, message_, &device_.cq_);
+  reader_->Finish(&response_, &status_, this);
+}
+
+void AstarteDeviceGRPC::AstarteDeviceGRPCImpl::SendCall::proceed(bool /*ok*/) {
+  record_send(device_.metrics_, started_, status_);
+  // Errors can't be reported to the caller of the send, which has already returned.
+  if (!status_.ok()) {
+    ASTARTE_LOG_ERROR("{}: {}", static_cast<int>(status_.error_code()), status_.error_message());
+  } else {
+    on_property_sent(*device_.property_cache_, *device_.property_dedup_, message_);
+    on_datastream_sent(*device_.datastream_filters_, message_);
+    if (on_sent_) {
+      on_sent_();
+    }
+  }
+  device_.pending_send_calls_--;
+  delete this;
 }
 
 }  // namespace AstarteDeviceSdk
@@ -0,0 +1,153 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "astarte_device_sdk/executor.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+
+#include "executor_impl.hpp"
+#include "sdk_logger.hpp"
+
+namespace AstarteDeviceSdk {
+
+namespace {
+// Pool and worker index of the current thread, used to queue tasks posted from within the pool
+// on the queue of the posting thread.
+thread_local const void* current_pool = nullptr;
+thread_local std::size_t current_worker = 0;
+}  // namespace
+
+AstarteWorkStealingExecutor::AstarteWorkStealingExecutor(std::size_t num_threads) {
+  if (num_threads == 0) {
+    num_threads = std::max(std::thread::hardware_concurrency(), 1U);
+  }
+  executor_impl_ = std::make_shared<AstarteWorkStealingExecutorImpl>(num_threads);
+}
+
+AstarteWorkStealingExecutor::~AstarteWorkStealingExecutor() = default;
+
+void AstarteWorkStealingExecutor::post(std::function<void()> task) {
+  executor_impl_->post(std::move(task));
+}
+
+auto AstarteWorkStealingExecutor::get_num_threads() const -> std::size_t {
+  return executor_impl_->get_num_threads();
+}
+
+AstarteWorkStealingExecutor::AstarteWorkStealingExecutorImpl::AstarteWorkStealingExecutorImpl(
+    std::size_t num_threads) {
+  ASTARTE_LOG_DEBUG("Starting a work stealing executor with {} threads.", num_threads);
+  workers_.reserve(num_threads);
+  for (std::size_t i = 0; i < num_threads; i++) {
+    workers_.push_back(std::make_unique<Worker>());
+  }
+  threads_.reserve(num_threads);
+  for (std::size_t i = 0; i < num_threads; i++) {
+    threads_.emplace_back([this, i] { run(i); });
+  }
+}
+
+AstarteWorkStealingExecutor::AstarteWorkStealingExecutorImpl::~AstarteWorkStealingExecutorImpl() {
+  {
+    const std::lock_guard<std::mutex> lock(sleep_mutex_);
+    stopping_ = true;
+  }
+  sleep_cv_.notify_all();
+  threads_.clear();
+}
+
+void AstarteWorkStealingExecutor::AstarteWorkStealingExecutorImpl::post(
+    std::function<void()> task) {
+  const std::size_t index = (current_pool == this)
+                                ? current_worker
+                                : next_worker_.fetch_add(1, std::memory_order_relaxed) %
+                                      workers_.size();
+  // Counted before it is visible to the workers, so that the one running it can't decrement the
+  // counter first
+  {
+    const std::lock_guard<std::mutex> lock(sleep_mutex_);
+    queued_tasks_++;
+  }
+  {
+    Worker& worker = *workers_[index];
+    const std::lock_guard<std::mutex> lock(worker.mutex);
+    worker.tasks.push_back(std::move(task));
+  }
+  sleep_cv_.notify_one();
+}
+
+auto AstarteWorkStealingExecutor::AstarteWorkStealingExecutorImpl::get_num_threads() const
+    -> std::size_t {
+  return workers_.size();
+}
+
+void AstarteWorkStealingExecutor::AstarteWorkStealingExecutorImpl::run(std::size_t index) {
+  current_pool = this;
+  current_worker = index;
+
+  while (true) {
+    std::optional<std::function<void()>> task = pop_local(index);
+    if (!task.has_value()) {
+      task = steal(index);
+    }
+
+    if (task.has_value()) {
+      {
+        const std::lock_guard<std::mutex> lock(sleep_mutex_);
+        queued_tasks_--;
+      }
+      try {
+        (*task)();
+      } catch (const std::exception& e) {
+        ASTARTE_LOG_ERROR("Executor task terminated with an exception: {}", e.what());
+      }
+      continue;
+    }
+
+    // Sleep until some task is queued, pending tasks are run even when the pool is stopping
+    std::unique_lock<std::mutex> lock(sleep_mutex_);
+    sleep_cv_.wait(lock, [this] { return (queued_tasks_ > 0) || stopping_; });
+    if (stopping_ && (queued_tasks_ == 0)) {
+      return;
+    }
+  }
+}
+
+auto AstarteWorkStealingExecutor::AstarteWorkStealingExecutorImpl::pop_local(std::size_t index)
+    -> std::optional<std::function<void()>> {
+  Worker& worker = *workers_[index];
+  const std::lock_guard<std::mutex> lock(worker.mutex);
+  if (worker.tasks.empty()) {
+    return std::nullopt;
+  }
+  // The owner takes the most recent task, which is the most likely to be hot in cache
+  std::function<void()> task = std::move(worker.tasks.back());
+  worker.tasks.pop_back();
+  return task;
+}
+
+auto AstarteWorkStealingExecutor::AstarteWorkStealingExecutorImpl::steal(std::size_t index)
+    -> std::optional<std::function<void()>> {
+  for (std::size_t offset = 1; offset < workers_.size(); offset++) {
+    Worker& victim = *workers_[(index + offset) % workers_.size()];
+    const std::lock_guard<std::mutex> lock(victim.mutex);
+    if (!victim.tasks.empty()) {
+      // Thieves take the oldest task, reducing the contention with the owner
+      std::function<void()> task = std::move(victim.tasks.front());
+      victim.tasks.pop_front();
+      return task;
+    }
+  }
+  return std::nullopt;
+}
+
+}  // namespace AstarteDeviceSdk
@@ -7,15 +7,20 @@
 #include <astarteplatform/msghub/astarte_data.pb.h>
 #include <astarteplatform/msghub/astarte_message.pb.h>
 #include <astarteplatform/msghub/property.pb.h>
+#include <google/protobuf/arena.h>
 #include <google/protobuf/timestamp.pb.h>
-#include <spdlog/spdlog.h>
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <list>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -28,6 +33,7 @@
 #include "astarte_device_sdk/property.hpp"
 #include "astarte_device_sdk/stored_property.hpp"
 #include "grpc_formatter.hpp"  // NOLINT
+#include "sdk_logger.hpp"
 
 namespace AstarteDeviceSdk {
 
@@ -50,52 +56,52 @@ using gRPCAstarteMessage = astarteplatform::msghub::AstarteMessage;
 using gRPCProperty = astarteplatform::msghub::Property;
 
 auto GrpcConverterTo::operator()(int32_t value) -> std::unique_ptr<gRPCAstarteData> {
-  spdlog::trace("Converting integer to gRPC Astarte data.");
+  ASTARTE_LOG_TRACE("Converting integer to gRPC Astarte data.");
   auto grpc_data = std::make_unique<gRPCAstarteData>();
   grpc_data->set_integer(value);
-  spdlog::trace("Resulting gRPC message: \n{}", *grpc_data);
+  ASTARTE_LOG_TRACE("Resulting gRPC message: \n{}", ProtobufText(*grpc_data));
   return grpc_data;
 }
 auto GrpcConverterTo::operator()(int64_t value) -> std::unique_ptr<gRPCAstarteData> {
-  spdlog::trace("Converting long integer to gRPC Astarte data.");
+  ASTARTE_LOG_TRACE("Converting long integer to gRPC Astarte data.");
   auto grpc_data = std::make_unique<gRPCAstarteData>();
   grpc_data->set_long_integer(value);
-  spdlog::trace("Resulting gRPC message: \n{}", *grpc_data);
+  ASTARTE_LOG_TRACE("Resulting gRPC message: \n{}", ProtobufText(*grpc_data));
   return grpc_data;
 }
 auto GrpcConverterTo::operator()(double value) -> std::unique_ptr<gRPCAstarteData> {
-  spdlog::trace("Converting double to gRPC Astarte data.");
+  ASTARTE_LOG_TRACE("Converting double to gRPC Astarte data.");
   auto grpc_data = std::make_unique<gRPCAstarteData>();
   grpc_data->set_double_(value);
-  spdlog::trace("Resulting gRPC message: \n{}", *grpc_data);
+  ASTARTE_LOG_TRACE("Resulting gRPC message: \n{}", ProtobufText(*grpc_data));
   return grpc_data;
 }
 auto GrpcConverterTo::operator()(bool value) -> std::unique_ptr<gRPCAstarteData> {
-  spdlog::trace("Converting boolean to gRPC Astarte data.");
+  ASTARTE_LOG_TRACE("Converting boolean to gRPC Astarte data.");
   auto grpc_data = std::make_unique<gRPCAstarteData>();
   grpc_data->set_boolean(value);
-  spdlog::trace("Resulting gRPC message: \n{}", *grpc_data);
+  ASTARTE_LOG_TRACE("Resulting gRPC message: \n{}", ProtobufText(*grpc_data));
   return grpc_data;
 }
 auto GrpcConverterTo::operator()(const std::string& value) -> std::unique_ptr<gRPCAstarteData> {
-  spdlog::trace("Converting string to gRPC Astarte data.");
+  ASTARTE_LOG_TRACE("Converting string to gRPC Astarte data.");
   auto grpc_data = std::make_unique<gRPCAstarteData>();
   grpc_data->set_string(value);
-  spdlog::trace("Resulting gRPC message: \n{}", *grpc_data);
+  ASTARTE_LOG_TRACE("Resulting gRPC message: \n{}", ProtobufText(*grpc_data));
   return grpc_data;
 }
 auto GrpcConverterTo::operator()(const std::vector<uint8_t>& value)
     -> std::unique_ptr<gRPCAstarteData> {
-  spdlog::trace("Converting binary blob to gRPC Astarte data.");
+  ASTARTE_LOG_TRACE("Converting binary blob to gRPC Astarte data.");
   auto grpc_data = std::make_unique<gRPCAstarteData>();
   std::string str_vector(value.begin(), value.end());
   grpc_data->set_binary_blob(str_vector);
-  spdlog::trace("Resulting gRPC message: \n{}", *grpc_data);
+  ASTARTE_LOG_TRACE("Resulting gRPC message: \n{}", ProtobufText(*grpc_data));
   return grpc_data;
 }
 auto GrpcConverterTo::operator()(std::chrono::system_clock::time_point value)
     -> std::unique_ptr<gRPCAstarteData> {
-  spdlog::trace("Converting date-time array to gRPC Astarte data.");
+  ASTARTE_LOG_TRACE("Converting date-time array to gRPC Astarte data.");
   auto grpc_data = std::make_unique<gRPCAstarteData>();
   const std::chrono::system_clock::duration t_duration = value.time_since_epoch();
   const seconds sec = duration_cast<seconds>(t_duration);
@@ -104,72 +110,72 @@ auto GrpcConverterTo::operator()(std::chrono::system_clock::time_point value)
   timestamp->set_seconds(static_cast<int64_t>(sec.count()));
   timestamp->set_nanos(static_cast<int32_t>(nano.count()));
   grpc_data->set_allocated_date_time(timestamp.release());
-  spdlog::trace("Resulting gRPC message: \n{}", *grpc_data);
+  ASTARTE_LOG_TRACE("Resulting gRPC message: \n{}", ProtobufText(*grpc_data));
   return grpc_data;
 }
 auto GrpcConverterTo::operator()(const std::vector<int32_t>& values)
     -> std::unique_ptr<gRPCAstarteData> {
-  spdlog::trace("Converting integer array to gRPC Astarte data.");
+  ASTARTE_LOG_TRACE("Converting integer array to gRPC Astarte data.");
   auto grpc_data = std::make_unique<gRPCAstarteData>();
   auto grpc_array = std::make_unique<gRPCAstarteIntegerArray>();
   for (const int32_t& value : values) {
     grpc_array->add_values(value);
   }
   grpc_data->set_allocated_integer_array(grpc_array.release());
-  spdlog::trace("Resulting gRPC message: \n{}", *grpc_data);
+  ASTARTE_LOG_TRACE("Resulting gRPC message: \n{}", ProtobufText(*grpc_data));
   return grpc_data;
 }
 auto GrpcConverterTo::operator()(const std::vector<int64_t>& values)
     -> std::unique_ptr<gRPCAstarteData> {
-  spdlog::trace("Converting long integer array to gRPC Astarte data.");
+  ASTARTE_LOG_TRACE("Converting long integer array to gRPC Astarte data.");
   auto grpc_data = std::make_unique<gRPCAstarteData>();
   auto grpc_array = std::make_unique<gRPCAstarteLongIntegerArray>();
   for (const int64_t& value : values) {
     grpc_array->add_values(value);
   }
   grpc_data->set_allocated_long_integer_array(grpc_array.release());
-  spdlog::trace("Resulting gRPC message: \n{}", *grpc_data);
+  ASTARTE_LOG_TRACE("Resulting gRPC message: \n{}", ProtobufText(*grpc_data));
   return grpc_data;
 }
 auto GrpcConverterTo::operator()(const std::vector<double>& values)
     -> std::unique_ptr<gRPCAstarteData> {
-  spdlog::trace("Converting double array to gRPC Astarte data.");
+  ASTARTE_LOG_TRACE("Converting double array to gRPC Astarte data.");
   auto grpc_data = std::make_unique<gRPCAstarteData>();
   auto grpc_array = std::make_unique<gRPCAstarteDoubleArray>();
   for (const double& value : values) {
     grpc_array->add_values(value);
   }
   grpc_data->set_allocated_double_array(grpc_array.release());
-  spdlog::trace("Resulting gRPC message: \n{}", *grpc_data);
+  ASTARTE_LOG_TRACE("Resulting gRPC message: \n{}", ProtobufText(*grpc_data));
   return grpc_data;
 }
 auto GrpcConverterTo::operator()(const std::vector<bool>& values)
     -> std::unique_ptr<gRPCAstarteData> {
-  spdlog::trace("Converting boolean array to gRPC Astarte data.");
+  ASTARTE_LOG_TRACE("Converting boolean array to gRPC Astarte data.");
   auto grpc_data = std::make_unique<gRPCAstarteData>();
   auto grpc_array = std::make_unique<gRPCAstarteBooleanArray>();
   for (const bool& value : values) {
     grpc_array->add_values(value);
   }
   grpc_data->set_allocated_boolean_array(grpc_array.release());
-  spdlog::trace("Resulting gRPC message: \n{}", *grpc_data);
+  ASTARTE_LOG_TRACE("Resulting gRPC message: \n{}", ProtobufText(*grpc_data));
   return grpc_data;
 }
 auto GrpcConverterTo::operator()(const std::vector<std::string>& values)
     -> std::unique_ptr<gRPCAstarteData> {
-  spdlog::trace("Converting string array to gRPC Astarte data.");
+  ASTARTE_LOG_TRACE("Converting string array to gRPC Astarte data.");
   auto grpc_data = std::make_unique<gRPCAstarteData>();
   auto grpc_array = std::make_unique<gRPCAstarteStringArray>();
   for (const std::string& value : values) {
     grpc_array->add_values(value);
   }
   grpc_data->set_allocated_string_array(grpc_array.release());
-  spdlog::trace("Resulting gRPC message: \n{}", *grpc_data);
+  ASTARTE_LOG_TRACE("Resulting gRPC message: \n{}", ProtobufText(*grpc_data));
   return grpc_data;
 }
 auto GrpcConverterTo::operator()(const std::vector<std::vector<uint8_t>>& values)
     -> std::unique_ptr<gRPCAstarteData> {
-  spdlog::trace("Converting binary blob array to gRPC Astarte data.");
+  ASTARTE_LOG_TRACE("Converting binary blob array to gRPC Astarte data.");
   auto grpc_data = std::make_unique<gRPCAstarteData>();
   auto grpc_array = std::make_unique<gRPCAstarteBinaryBlobArray>();
   for (const std::vector<uint8_t>& value : values) {
@@ -177,12 +183,12 @@ auto GrpcConverterTo::operator()(const std::vector<std::vector<uint8_t>>& values
     grpc_array->add_values(str_value);
   }
   grpc_data->set_allocated_binary_blob_array(grpc_array.release());
-  spdlog::trace("Resulting gRPC message: \n{}", *grpc_data);
+  ASTARTE_LOG_TRACE("Resulting gRPC message: \n{}", ProtobufText(*grpc_data));
   return grpc_data;
 }
 auto GrpcConverterTo::operator()(const std::vector<std::chrono::system_clock::time_point>& values)
     -> std::unique_ptr<gRPCAstarteData> {
-  spdlog::trace("Converting date-time array to gRPC Astarte data.");
+  ASTARTE_LOG_TRACE("Converting date-time array to gRPC Astarte data.");
   auto grpc_data = std::make_unique<gRPCAstarteData>();
   auto grpc_array = std::make_unique<gRPCAstarteDateTimeArray>();
   for (const std::chrono::system_clock::time_point& value : values) {
@@ -196,7 +202,7 @@ auto GrpcConverterTo::operator()(const std::vector<std::chrono::system_clock::ti
     timestamp->set_nanos(static_cast<int32_t>(nano.count()));
   }
   grpc_data->set_allocated_date_time_array(grpc_array.release());
-  spdlog::trace("Resulting gRPC message: \n{}", *grpc_data);
+  ASTARTE_LOG_TRACE("Resulting gRPC message: \n{}", ProtobufText(*grpc_data));
   return grpc_data;
 }
 
@@ -205,7 +211,7 @@ auto GrpcConverterTo::operator()(const std::vector<std::chrono::system_clock::ti
 auto GrpcConverterTo::operator()(const AstarteData& value,
                                  const std::chrono::system_clock::time_point* timestamp)
     -> std::unique_ptr<gRPCAstarteDatastreamIndividual> {
-  spdlog::trace("Converting Astarte datastream individual to gRPC.");
+  ASTARTE_LOG_TRACE("Converting Astarte datastream individual to gRPC.");
   auto grpc_individual = std::make_unique<gRPCAstarteDatastreamIndividual>();
 
   if (timestamp != nullptr) {
@@ -221,7 +227,7 @@ auto GrpcConverterTo::operator()(const AstarteData& value,
 
   std::unique_ptr<gRPCAstarteData> grpc_data = std::visit(GrpcConverterTo(), value.get_raw_data());
   grpc_individual->set_allocated_data(grpc_data.release());
-  spdlog::trace("Resulting gRPC message: \n{}", *grpc_individual);
+  ASTARTE_LOG_TRACE("Resulting gRPC message: \n{}", ProtobufText(*grpc_individual));
   return grpc_individual;
 }
 // NOLINTEND(clang-analyzer-cplusplus.NewDeleteLeaks)
@@ -231,7 +237,7 @@ auto GrpcConverterTo::operator()(const AstarteData& value,
 auto GrpcConverterTo::operator()(const AstarteDatastreamObject& value,
                                  const std::chrono::system_clock::time_point* timestamp)
     -> std::unique_ptr<gRPCAstarteDatastreamObject> {
-  spdlog::trace("Converting Astarte datastream object to gRPC.");
+  ASTARTE_LOG_TRACE("Converting Astarte datastream object to gRPC.");
   auto grpc_object = std::make_unique<gRPCAstarteDatastreamObject>();
 
   if (timestamp != nullptr) {
@@ -257,49 +263,49 @@ auto GrpcConverterTo::operator()(const AstarteDatastreamObject& value,
     // As a consequence ownership of this grpc_data is not released.
     (*grpc_map)[path] = *grpc_data;
   }
-  spdlog::trace("Resulting gRPC message: \n{}", *grpc_object);
+  ASTARTE_LOG_TRACE("Resulting gRPC message: \n{}", ProtobufText(*grpc_object));
   return grpc_object;
 }
 // NOLINTEND(clang-analyzer-cplusplus.NewDeleteLeaks)
 
 auto GrpcConverterTo::operator()(const std::optional<AstarteData>& value)
     -> std::unique_ptr<gRPCAstartePropertyIndividual> {
-  spdlog::trace("Converting Astarte property individual to gRPC.");
+  ASTARTE_LOG_TRACE("Converting Astarte property individual to gRPC.");
   auto grpc_property = std::make_unique<gRPCAstartePropertyIndividual>();
   if (value.has_value()) {
     const AstarteData& data = value.value();
     std::unique_ptr<gRPCAstarteData> grpc_data = std::visit(GrpcConverterTo(), data.get_raw_data());
     grpc_property->set_allocated_data(grpc_data.release());
   }
-  spdlog::trace("Resulting gRPC message: \n{}", *grpc_property);
+  ASTARTE_LOG_TRACE("Resulting gRPC message: \n{}", ProtobufText(*grpc_property));
   return grpc_property;
 }
 
 // NOLINTBEGIN(readability-function-size)
 auto GrpcConverterFrom::operator()(const gRPCAstarteData& value) -> AstarteData {
-  spdlog::trace("Converting Astarte data from gRPC, message: \n{}", value);
+  ASTARTE_LOG_TRACE("Converting Astarte data from gRPC, message: \n{}", ProtobufText(value));
   switch (value.astarte_data_case()) {
     case gRPCAstarteData::kDouble:
-      spdlog::trace("Case kDouble");
+      ASTARTE_LOG_TRACE("Case kDouble");
       return AstarteData(value.double_());
     case gRPCAstarteData::kInteger:
-      spdlog::trace("Case kInteger");
+      ASTARTE_LOG_TRACE("Case kInteger");
       return AstarteData(value.integer());
     case gRPCAstarteData::kBoolean:
-      spdlog::trace("Case kBoolean");
+      ASTARTE_LOG_TRACE("Case kBoolean");
       return AstarteData(value.boolean());
     case gRPCAstarteData::kLongInteger:
-      spdlog::trace("Case kLongInteger");
+      ASTARTE_LOG_TRACE("Case kLongInteger");
       return AstarteData(value.long_integer());
     case gRPCAstarteData::kString:
-      spdlog::trace("Case kString");
+      ASTARTE_LOG_TRACE("Case kString");
       return AstarteData(value.string());
     case gRPCAstarteData::kBinaryBlob:
-      spdlog::trace("Case kBinaryBlob");
+      ASTARTE_LOG_TRACE("Case kBinaryBlob");
       return AstarteData(
           std::vector<uint8_t>(value.binary_blob().begin(), value.binary_blob().end()));
     case gRPCAstarteData::kDateTime: {
-      spdlog::trace("Case kDateTime");
+      ASTARTE_LOG_TRACE("Case kDateTime");
       const google::protobuf::Timestamp& timestamp = value.date_time();
       auto secs = std::chrono::seconds{timestamp.seconds()};
       auto nanos = std::chrono::nanoseconds{timestamp.nanos()};
@@ -308,27 +314,27 @@ auto GrpcConverterFrom::operator()(const gRPCAstarteData& value) -> AstarteData
       return AstarteData(timepoint);
     }
     case gRPCAstarteData::kDoubleArray:
-      spdlog::trace("Case kDoubleArray");
+      ASTARTE_LOG_TRACE("Case kDoubleArray");
       return AstarteData(std::vector<double>(value.double_array().values().begin(),
                                              value.double_array().values().end()));
     case gRPCAstarteData::kIntegerArray:
-      spdlog::trace("Case kIntegerArray");
+      ASTARTE_LOG_TRACE("Case kIntegerArray");
       return AstarteData(std::vector<int32_t>(value.integer_array().values().begin(),
                                               value.integer_array().values().end()));
     case gRPCAstarteData::kBooleanArray:
-      spdlog::trace("Case kBooleanArray");
+      ASTARTE_LOG_TRACE("Case kBooleanArray");
       return AstarteData(std::vector<bool>(value.boolean_array().values().begin(),
                                            value.boolean_array().values().end()));
     case gRPCAstarteData::kLongIntegerArray:
-      spdlog::trace("Case kLongIntegerArray");
+      ASTARTE_LOG_TRACE("Case kLongIntegerArray");
       return AstarteData(std::vector<int64_t>(value.long_integer_array().values().begin(),
                                               value.long_integer_array().values().end()));
     case gRPCAstarteData::kStringArray:
-      spdlog::trace("Case kStringArray");
+      ASTARTE_LOG_TRACE("Case kStringArray");
       return AstarteData(std::vector<std::string>(value.string_array().values().begin(),
                                                   value.string_array().values().end()));
     case gRPCAstarteData::kBinaryBlobArray: {
-      spdlog::trace("Case kBinaryBlobArray");
+      ASTARTE_LOG_TRACE("Case kBinaryBlobArray");
       std::vector<std::vector<uint8_t>> binblob_vect;
       for (const auto& str : value.binary_blob_array().values()) {
         binblob_vect.emplace_back(str.begin(), str.end());
@@ -336,7 +342,7 @@ auto GrpcConverterFrom::operator()(const gRPCAstarteData& value) -> AstarteData
       return AstarteData(binblob_vect);
     }
     case gRPCAstarteData::kDateTimeArray: {
-      spdlog::trace("Case kDateTimeArray");
+      ASTARTE_LOG_TRACE("Case kDateTimeArray");
       std::vector<std::chrono::system_clock::time_point> timestamp_vect;
       for (const auto& timestamp : value.date_time_array().values()) {
         auto secs = std::chrono::seconds{timestamp.seconds()};
@@ -348,7 +354,7 @@ auto GrpcConverterFrom::operator()(const gRPCAstarteData& value) -> AstarteData
       return AstarteData(timestamp_vect);
     }
     default:
-      spdlog::trace("Case for gRPCAstarteData goes to default statement: ASTARTE_DATA_NOT_SET");
+      ASTARTE_LOG_TRACE("Case for gRPCAstarteData goes to default statement: ASTARTE_DATA_NOT_SET");
       break;
   }
   throw AstarteInternalException("Found an unrecognized gRPC gRPCAstarteData.");
@@ -357,14 +363,16 @@ auto GrpcConverterFrom::operator()(const gRPCAstarteData& value) -> AstarteData
 
 auto GrpcConverterFrom::operator()(const gRPCAstarteDatastreamIndividual& value)
     -> AstarteDatastreamIndividual {
-  spdlog::trace("Converting Astarte datastream individual from gRPC, message: \n{}", value);
+  ASTARTE_LOG_TRACE(
+      "Converting Astarte datastream individual from gRPC, message: \n{}", ProtobufText(value));
   const gRPCAstarteData& grpc_data(value.data());
   return AstarteDatastreamIndividual((*this)(grpc_data));
 }
 
 auto GrpcConverterFrom::operator()(const gRPCAstarteDatastreamObject& value)
     -> AstarteDatastreamObject {
-  spdlog::trace("Converting Astarte datastream object from gRPC, message: \n{}", value);
+  ASTARTE_LOG_TRACE(
+      "Converting Astarte datastream object from gRPC, message: \n{}", ProtobufText(value));
   AstarteDatastreamObject object;
   const google::protobuf::Map<std::string, gRPCAstarteData>& grpc_data = value.data();
   for (const auto& [key, data] : grpc_data) {
@@ -375,7 +383,8 @@ auto GrpcConverterFrom::operator()(const gRPCAstarteDatastreamObject& value)
 
 auto GrpcConverterFrom::operator()(const gRPCAstartePropertyIndividual& value)
     -> AstartePropertyIndividual {
-  spdlog::trace("Converting Astarte property individual from gRPC, message: \n{}", value);
+  ASTARTE_LOG_TRACE(
+      "Converting Astarte property individual from gRPC, message: \n{}", ProtobufText(value));
   if (value.has_data()) {
     const gRPCAstarteData& grpc_data(value.data());
     return AstartePropertyIndividual((*this)(grpc_data));
@@ -384,7 +393,7 @@ auto GrpcConverterFrom::operator()(const gRPCAstartePropertyIndividual& value)
 }
 
 auto GrpcConverterFrom::operator()(const gRPCAstarteMessage& value) -> AstarteMessage {
-  spdlog::trace("Converting Astarte message from gRPC, message: \n{}", value);
+  ASTARTE_LOG_TRACE("Converting Astarte message from gRPC, message: \n{}", ProtobufText(value));
   if (value.has_datastream_individual()) {
     const gRPCAstarteDatastreamIndividual& grpc_datastream_individual =
         value.datastream_individual();
@@ -411,20 +420,113 @@ auto GrpcConverterFrom::operator()(const gRPCAstarteMessage& value) -> AstarteMe
 }
 
 auto GrpcConverterFrom::operator()(const gRPCOwnership& value) -> AstarteOwnership {
-  spdlog::trace("Converting Astarte ownership from gRPC.");
+  ASTARTE_LOG_TRACE("Converting Astarte ownership from gRPC.");
   return (value == gRPCOwnership::DEVICE) ? AstarteOwnership::kDevice : AstarteOwnership::kServer;
 }
 
 auto GrpcConverterFrom::operator()(const gRPCStoredProperties& value)
     -> std::list<AstarteStoredProperty> {
-  spdlog::trace("Converting Astarte stored property from gRPC.");
+  ASTARTE_LOG_TRACE("Converting Astarte stored property from gRPC.");
+  StoredPropertiesDecoder decoder(value);
   std::list<AstarteStoredProperty> stored_properties;
-  for (const gRPCProperty& stored_property : value.properties()) {
-    stored_properties.emplace_back(
-        stored_property.interface_name(), stored_property.path(), stored_property.version_major(),
-        (*this)(stored_property.ownership()), (*this)(stored_property.data()));
+  for (std::size_t index = 0; index < decoder.size(); index++) {
+    stored_properties.push_back(decoder.decode(index));
   }
   return stored_properties;
 }
 
+StoredPropertiesDecoder::StoredPropertiesDecoder(const gRPCStoredProperties& value)
+    : value_(value) {}
+
+auto StoredPropertiesDecoder::size() const -> std::size_t {
+  return static_cast<std::size_t>(value_.properties_size());
+}
+
+auto StoredPropertiesDecoder::decode(std::size_t index) -> AstarteStoredProperty {
+  const gRPCProperty& stored_property = value_.properties(static_cast<int>(index));
+  return AstarteStoredProperty(intern(stored_property.interface_name()), stored_property.path(),
+                               stored_property.version_major(),
+                               GrpcConverterFrom{}(stored_property.ownership()),
+                               GrpcConverterFrom{}(stored_property.data()));
+}
+
+auto StoredPropertiesDecoder::to_vector() -> std::vector<AstarteStoredProperty> {
+  std::vector<AstarteStoredProperty> stored_properties;
+  stored_properties.reserve(size());
+  for (std::size_t index = 0; index < size(); index++) {
+    stored_properties.push_back(decode(index));
+  }
+  return stored_properties;
+}
+
+auto StoredPropertiesDecoder::intern(const std::string& interface_name)
+    -> std::shared_ptr<const std::string> {
+  auto iter = interface_names_.find(interface_name);
+  if (iter == interface_names_.end()) {
+    auto shared_name = std::make_shared<const std::string>(interface_name);
+    iter = interface_names_.emplace(interface_name, std::move(shared_name)).first;
+  }
+  return iter->second;
+}
+
+template <typename T>
+auto encode_series(google::protobuf::Arena& arena, std::string_view interface_name,
+                   std::string_view path, std::span<const T> values,
+                   std::span<const std::chrono::system_clock::time_point> timestamps)
+    -> std::vector<gRPCAstarteMessage*> {
+  if (values.size() != timestamps.size()) {
+    throw AstarteInvalidInputException(
+        "The series has a different number of values and timestamps.");
+  }
+  const std::size_t count = values.size();
+
+  // Split the timestamps in a branchless arithmetic pass the compiler can vectorize
+  constexpr int64_t NANOS_PER_SECOND = 1000000000;
+  std::vector<int64_t> secs(count);
+  std::vector<int32_t> nanos(count);
+  for (std::size_t index = 0; index < count; index++) {
+    const int64_t total = duration_cast<nanoseconds>(timestamps[index].time_since_epoch()).count();
+    const int64_t quotient = total / NANOS_PER_SECOND;
+    const int64_t remainder = total % NANOS_PER_SECOND;
+    // Protobuf timestamps require non negative nanoseconds
+    const int64_t borrow = (remainder < 0) ? 1 : 0;
+    secs[index] = quotient - borrow;
+    nanos[index] = static_cast<int32_t>(remainder + (borrow * NANOS_PER_SECOND));
+  }
+
+  std::vector<gRPCAstarteMessage*> messages(count);
+  for (std::size_t index = 0; index < count; index++) {
+    auto* message = google::protobuf::Arena::CreateMessage<gRPCAstarteMessage>(&arena);
+    message->set_interface_name(interface_name);
+    message->set_path(path);
+    gRPCAstarteDatastreamIndividual* individual = message->mutable_datastream_individual();
+    gRPCAstarteData* data = individual->mutable_data();
+    if constexpr (std::is_same_v<T, int32_t>) {
+      data->set_integer(values[index]);
+    } else if constexpr (std::is_same_v<T, int64_t>) {
+      data->set_long_integer(values[index]);
+    } else {
+      data->set_double_(values[index]);
+    }
+    google::protobuf::Timestamp* timestamp = individual->mutable_timestamp();
+    timestamp->set_seconds(secs[index]);
+    timestamp->set_nanos(nanos[index]);
+    messages[index] = message;
+  }
+  return messages;
+}
+
+template auto encode_series<int32_t>(google::protobuf::Arena&, std::string_view, std::string_view,
+                                     std::span<const int32_t>,
+                                     std::span<const std::chrono::system_clock::time_point>)
+    -> std::vector<gRPCAstarteMessage*>;
+template auto encode_series<int64_t>(google::protobuf::Arena&, std::string_view, std::string_view,
+                                     std::span<const int64_t>,
+                                     std::span<const std::chrono::system_clock::time_point>)
+    -> std::vector<gRPCAstarteMessage*>;
+template auto encode_series<double>(google::protobuf::Arena&, std::string_view, std::string_view,
+                                    std::span<const double>,
+                                    std::span<const std::chrono::system_clock::time_point>)
+    -> std::vector<gRPCAstarteMessage*>;
+
 }  // namespace AstarteDeviceSdk
@@ -4,32 +4,156 @@
 
 #include "grpc_interceptors.hpp"
 
+#include <astarteplatform/msghub/astarte_data.pb.h>
+#include <astarteplatform/msghub/message_hub_service.pb.h>
+#include <astarteplatform/msghub/property.pb.h>
+#include <grpcpp/grpcpp.h>
+#include <grpcpp/support/client_interceptor.h>
 #include <grpcpp/support/interceptor.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
 #include <utility>
+#include <vector>
+
+#include "astarte_device_sdk/rpc_stats.hpp"
 
 namespace AstarteDeviceSdk {
 
 using grpc::experimental::InterceptionHookPoints;
 
-NodeIdInterceptor::NodeIdInterceptor(std::string node_id) : node_id_(std::move(node_id)) {}
+namespace {
+
+template <typename Message>
+auto message_size(const void* message) -> std::size_t {
+  return static_cast<const Message*>(message)->ByteSizeLong();
+}
+
+// Received messages are handed to the interceptors deserialized and untyped
+auto get_received_size(std::string_view method) -> RpcMethodStats::ReceivedSize {
+  if (method == "/astarteplatform.msghub.MessageHub/Attach") {
+    return &message_size<astarteplatform::msghub::MessageHubEvent>;
+  }
+  if ((method == "/astarteplatform.msghub.MessageHub/GetProperties") ||
+      (method == "/astarteplatform.msghub.MessageHub/GetAllProperties")) {
+    return &message_size<astarteplatform::msghub::StoredProperties>;
+  }
+  if (method == "/astarteplatform.msghub.MessageHub/GetProperty") {
+    return &message_size<astarteplatform::msghub::AstartePropertyIndividual>;
+  }
+  return nullptr;
+}
+
+}  // namespace
 
-void NodeIdInterceptor::Intercept(InterceptorBatchMethods* methods) {
+RpcMethodStats::RpcMethodStats(std::string method)
+    : method(std::move(method)), received_size(get_received_size(this->method)) {}
+
+auto RpcMethodStats::load() const -> AstarteRpcStats {
+  AstarteRpcStats stats;
+  stats.method = method;
+  stats.calls = calls.load(std::memory_order_relaxed);
+  stats.messages_sent = messages_sent.load(std::memory_order_relaxed);
+  stats.bytes_sent = bytes_sent.load(std::memory_order_relaxed);
+  stats.messages_received = messages_received.load(std::memory_order_relaxed);
+  stats.bytes_received = bytes_received.load(std::memory_order_relaxed);
+  for (std::size_t code = 0; code < AstarteRpcStats::STATUS_CODES; code++) {
+    stats.status_codes.at(code) = status_codes.at(code).load(std::memory_order_relaxed);
+  }
+  stats.latency.name = method;
+  stats.latency.help = "Latency of the calls, from their start to the reception of their status.";
+  latency.load(stats.latency);
+  return stats;
+}
+
+void RpcStatsTable::set_enabled(bool enabled) {
+  enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+auto RpcStatsTable::is_enabled() const -> bool { return enabled_.load(std::memory_order_relaxed); }
+
+auto RpcStatsTable::get_method(std::string_view method) -> RpcMethodStats& {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  auto iter = methods_.find(method);
+  if (iter == methods_.end()) {
+    iter = methods_
+               .emplace(std::string(method),
+                        std::make_unique<RpcMethodStats>(std::string(method)))
+               .first;
+  }
+  return *iter->second;
+}
+
+auto RpcStatsTable::snapshot() const -> std::vector<AstarteRpcStats> {
+  std::vector<AstarteRpcStats> snapshot;
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    snapshot.reserve(methods_.size());
+    for (const auto& [method, stats] : methods_) {
+      snapshot.push_back(stats->load());
+    }
+  }
+  std::sort(snapshot.begin(), snapshot.end(),
+            [](const AstarteRpcStats& lhs, const AstarteRpcStats& rhs) {
+              return lhs.method < rhs.method;
+            });
+  return snapshot;
+}
+
+RpcStatsInterceptor::RpcStatsInterceptor(std::shared_ptr<RpcStatsTable> table,
+                                         RpcMethodStats& stats)
+    : table_(std::move(table)), stats_(stats) {}
+
+void RpcStatsInterceptor::Intercept(InterceptorBatchMethods* methods) {
   if (methods->QueryInterceptionHookPoint(InterceptionHookPoints::PRE_SEND_INITIAL_METADATA)) {
-    // Add the node ID to the metadata
-    auto* metadata = methods->GetSendInitialMetadata();
-    metadata->insert({"node-id", node_id_});
+    started_ = std::chrono::steady_clock::now();
+    stats_.calls.fetch_add(1, std::memory_order_relaxed);
+  }
+  if (methods->QueryInterceptionHookPoint(InterceptionHookPoints::PRE_SEND_MESSAGE)) {
+    // The buffer serialized here is the one sent, the message is not serialized twice
+    const grpc::ByteBuffer* buffer = methods->GetSerializedSendMessage();
+    stats_.messages_sent.fetch_add(1, std::memory_order_relaxed);
+    if (buffer != nullptr) {
+      stats_.bytes_sent.fetch_add(buffer->Length(), std::memory_order_relaxed);
+    }
+  }
+  if (methods->QueryInterceptionHookPoint(InterceptionHookPoints::POST_RECV_MESSAGE)) {
+    // Failed reads, such as the end of a stream, are reported without a message
+    const void* message = methods->GetRecvMessage();
+    if (message != nullptr) {
+      stats_.messages_received.fetch_add(1, std::memory_order_relaxed);
+      if (stats_.received_size != nullptr) {
+        stats_.bytes_received.fetch_add(stats_.received_size(message), std::memory_order_relaxed);
+      }
+    }
+  }
+  if (methods->QueryInterceptionHookPoint(InterceptionHookPoints::POST_RECV_STATUS)) {
+    stats_.latency.record(std::chrono::steady_clock::now() - started_);
+    const grpc::Status* status = methods->GetRecvStatus();
+    const auto code = static_cast<std::size_t>(status != nullptr ? status->error_code()
+                                                                  : grpc::StatusCode::UNKNOWN);
+    stats_.status_codes.at(std::min(code, AstarteRpcStats::STATUS_CODES - 1))
+        .fetch_add(1, std::memory_order_relaxed);
   }
   methods->Proceed();
 }
 
-NodeIdInterceptorFactory::NodeIdInterceptorFactory(std::string node_id)
-    : node_id_(std::move(node_id)) {}
+RpcStatsInterceptorFactory::RpcStatsInterceptorFactory(std::shared_ptr<RpcStatsTable> table)
+    : table_(std::move(table)) {}
 
-auto NodeIdInterceptorFactory::CreateClientInterceptor(ClientRpcInfo* info) -> Interceptor* {
-  (void)info;
-  return new NodeIdInterceptor(node_id_);
+auto RpcStatsInterceptorFactory::CreateClientInterceptor(ClientRpcInfo* info) -> Interceptor* {
+  if (!table_->is_enabled()) {
+    return nullptr;
+  }
+  // Owned and deleted by the gRPC library at the end of the call
+  return new RpcStatsInterceptor(table_, table_->get_method(info->method()));
 }
 
 }  // namespace AstarteDeviceSdk
@@ -0,0 +1,121 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "astarte_device_sdk/hub_connection.hpp"
+
+#include <grpcpp/create_channel.h>
+#include <grpcpp/grpcpp.h>
+#include <grpcpp/security/credentials.h>
+#include <grpcpp/support/channel_arguments.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "astarte_device_sdk/compression.hpp"
+#include "astarte_device_sdk/rpc_stats.hpp"
+#include "grpc_interceptors.hpp"
+#include "hub_connection_impl.hpp"
+#include "sdk_logger.hpp"
+
+namespace AstarteDeviceSdk {
+
+namespace {
+
+auto to_grpc_algorithm(AstarteCompression::Algorithm algorithm) -> grpc_compression_algorithm {
+  switch (algorithm) {
+    case AstarteCompression::Algorithm::kDeflate:
+      return GRPC_COMPRESS_DEFLATE;
+    case AstarteCompression::Algorithm::kGzip:
+      return GRPC_COMPRESS_GZIP;
+    case AstarteCompression::Algorithm::kNone:
+      break;
+  }
+  return GRPC_COMPRESS_NONE;
+}
+
+}  // namespace
+
+auto get_message_compression(const AstarteCompression& compression, std::size_t size)
+    -> grpc_compression_algorithm {
+  if (size < compression.get_min_size()) {
+    return GRPC_COMPRESS_NONE;
+  }
+  return to_grpc_algorithm(compression.get_algorithm());
+}
+
+AstarteHubConnection::AstarteHubConnection(const std::string& server_addr)
+    : AstarteHubConnection(server_addr, AstarteCompression(AstarteCompression::Algorithm::kNone)) {
+}
+
+AstarteHubConnection::AstarteHubConnection(const std::string& server_addr,
+                                           const AstarteCompression& compression)
+    : hub_connection_impl_{std::make_shared<AstarteHubConnectionImpl>(server_addr, compression)} {}
+
+AstarteHubConnection::~AstarteHubConnection() = default;
+
+auto AstarteHubConnection::get_server_addr() const -> const std::string& {
+  return hub_connection_impl_->get_server_addr();
+}
+
+auto AstarteHubConnection::get_compression() const -> const AstarteCompression& {
+  return hub_connection_impl_->get_compression();
+}
+
+void AstarteHubConnection::set_rpc_stats(bool enabled) {
+  hub_connection_impl_->set_rpc_stats(enabled);
+}
+
+auto AstarteHubConnection::get_rpc_stats() const -> std::vector<AstarteRpcStats> {
+  return hub_connection_impl_->get_rpc_stats();
+}
+
+AstarteHubConnection::AstarteHubConnectionImpl::AstarteHubConnectionImpl(
+    std::string server_addr, AstarteCompression compression)
+    : server_addr_(std::move(server_addr)),
+      compression_(compression),
+      rpc_stats_(std::make_shared<RpcStatsTable>()) {
+  ASTARTE_LOG_DEBUG("Creating the gRPC channel toward the message hub at {}", server_addr_);
+  grpc::ChannelArguments args;
+  if (compression_.get_algorithm() != AstarteCompression::Algorithm::kNone) {
+    args.SetCompressionAlgorithm(to_grpc_algorithm(compression_.get_algorithm()));
+  }
+  // The interceptor is skipped by the calls started while the statistics are disabled
+  std::vector<std::unique_ptr<grpc::experimental::ClientInterceptorFactoryInterface>> interceptors;
+  interceptors.push_back(std::make_unique<RpcStatsInterceptorFactory>(rpc_stats_));
+  channel_ = grpc::experimental::CreateCustomChannelWithInterceptors(
+      server_addr_, grpc::InsecureChannelCredentials(), args, std::move(interceptors));
+}
+
+auto AstarteHubConnection::AstarteHubConnectionImpl::get_server_addr() const -> const std::string& {
+  return server_addr_;
+}
+
+auto AstarteHubConnection::AstarteHubConnectionImpl::get_channel() const
+    -> const std::shared_ptr<grpc::Channel>& {
+  return channel_;
+}
+
+auto AstarteHubConnection::AstarteHubConnectionImpl::get_compression() const
+    -> const AstarteCompression& {
+  return compression_;
+}
+
+auto AstarteHubConnection::AstarteHubConnectionImpl::get_message_compression(std::size_t size) const
+    -> grpc_compression_algorithm {
+  return AstarteDeviceSdk::get_message_compression(compression_, size);
+}
+
+void AstarteHubConnection::AstarteHubConnectionImpl::set_rpc_stats(bool enabled) {
+  rpc_stats_->set_enabled(enabled);
+}
+
+auto AstarteHubConnection::AstarteHubConnectionImpl::get_rpc_stats() const
+    -> std::vector<AstarteRpcStats> {
+  return rpc_stats_->snapshot();
+}
+
+}  // namespace AstarteDeviceSdk
@@ -0,0 +1,239 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "astarte_device_sdk/json.hpp"
+
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+#include "astarte_device_sdk/base64.hpp"
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/formatter.hpp"
+#include "astarte_device_sdk/individual.hpp"
+#include "astarte_device_sdk/msg.hpp"
+#include "astarte_device_sdk/object.hpp"
+#include "astarte_device_sdk/ownership.hpp"
+#include "astarte_device_sdk/property.hpp"
+#include "astarte_device_sdk/stored_property.hpp"
+
+namespace AstarteDeviceSdk {
+
+namespace {
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+constexpr std::string_view HEX_DIGITS = "0123456789abcdef";
+
+void append_integer(std::string& out, int64_t value) {
+  std::array<char, 24> digits{};
+  const auto result = std::to_chars(digits.begin(), digits.end(), value);
+  out.append(digits.begin(), result.ptr);
+}
+
+// Zero padded to the width, the value must fit in it
+void append_padded(std::string& out, unsigned value, std::size_t width) {
+  const std::size_t start = out.size();
+  out.resize(start + width);
+  for (std::size_t index = start + width; index > start; index--) {
+    out[index - 1] = static_cast<char>('0' + (value % 10));
+    value /= 10;
+  }
+}
+
+void append_value(std::string& out, int32_t value) { append_integer(out, value); }
+
+void append_value(std::string& out, int64_t value) { append_integer(out, value); }
+
+// The shortest representation that reads back to the same double. Integral values, common in the
+// samples, take the faster integer path.
+void append_value(std::string& out, double value) {
+  if (!std::isfinite(value)) {
+    out += "null";
+    return;
+  }
+  constexpr double max_exact_integer = 9007199254740992.0;
+  if ((std::abs(value) < max_exact_integer) && (std::trunc(value) == value) &&
+      !((value == 0) && std::signbit(value))) {
+    append_integer(out, static_cast<int64_t>(value));
+    return;
+  }
+  // The formatting library is faster than std::to_chars on the doubles with older standard
+  // libraries, the result is the same shortest representation
+  ASTARTE_NS_FORMAT::format_to(std::back_inserter(out), "{}", value);
+}
+
+void append_value(std::string& out, bool value) { out += value ? "true" : "false"; }
+
+// Only the quotes, the backslashes and the control characters are escaped, the rest of the UTF-8
+// text is copied as it is
+void append_value(std::string& out, std::string_view value) {
+  out += '"';
+  std::size_t start = 0;
+  for (std::size_t index = 0; index < value.size(); index++) {
+    const auto character = static_cast<unsigned char>(value[index]);
+    if ((character >= 0x20) && (character != '"') && (character != '\\')) {
+      continue;
+    }
+    out.append(value.substr(start, index - start));
+    start = index + 1;
+    switch (character) {
+      case '"':
+        out += "\\\"";
+        break;
+      case '\\':
+        out += "\\\\";
+        break;
+      case '\n':
+        out += "\\n";
+        break;
+      case '\r':
+        out += "\\r";
+        break;
+      case '\t':
+        out += "\\t";
+        break;
+      default:
+        out += "\\u00";
+        out += HEX_DIGITS[character >> 4];
+        out += HEX_DIGITS[character & 0xF];
+        break;
+    }
+  }
+  out.append(value.substr(start));
+  out += '"';
+}
+
+void append_value(std::string& out, const std::string& value) {
+  append_value(out, std::string_view(value));
+}
+
+void append_value(std::string& out, const std::vector<uint8_t>& value) {
+  out += '"';
+  base64_encode(value, out);
+  out += '"';
+}
+
+// ISO 8601 in UTC with milliseconds, such as "2025-01-31T10:20:30.450Z"
+void append_value(std::string& out, const std::chrono::system_clock::time_point& value) {
+  const auto milliseconds = std::chrono::floor<std::chrono::milliseconds>(value);
+  const auto days = std::chrono::floor<std::chrono::days>(milliseconds);
+  const std::chrono::year_month_day date(days);
+  const std::chrono::hh_mm_ss time(milliseconds - days);
+  const int year = static_cast<int>(date.year());
+  out += '"';
+  if ((year >= 0) && (year <= 9999)) {
+    append_padded(out, static_cast<unsigned>(year), 4);
+  } else {
+    append_integer(out, year);
+  }
+  out += '-';
+  append_padded(out, static_cast<unsigned>(date.month()), 2);
+  out += '-';
+  append_padded(out, static_cast<unsigned>(date.day()), 2);
+  out += 'T';
+  append_padded(out, static_cast<unsigned>(time.hours().count()), 2);
+  out += ':';
+  append_padded(out, static_cast<unsigned>(time.minutes().count()), 2);
+  out += ':';
+  append_padded(out, static_cast<unsigned>(time.seconds().count()), 2);
+  out += '.';
+  append_padded(out, static_cast<unsigned>(time.subseconds().count()), 3);
+  out += "Z\"";
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+
+template <typename T>
+void append_value(std::string& out, const std::vector<T>& values) {
+  out += '[';
+  bool first = true;
+  for (const T& value : values) {
+    if (!first) {
+      out += ',';
+    }
+    first = false;
+    append_value(out, value);
+  }
+  out += ']';
+}
+
+// Booleans are packed in the vector, they can't be bound to a const reference
+void append_value(std::string& out, const std::vector<bool>& values) {
+  out += '[';
+  for (std::size_t index = 0; index < values.size(); index++) {
+    if (index != 0) {
+      out += ',';
+    }
+    append_value(out, static_cast<bool>(values[index]));
+  }
+  out += ']';
+}
+
+}  // namespace
+
+void AstarteJsonWriter::clear() { buffer_.clear(); }
+
+auto AstarteJsonWriter::view() const -> std::string_view { return buffer_; }
+
+void AstarteJsonWriter::write(const AstarteData& data) {
+  std::visit([this](const auto& value) { append_value(buffer_, value); }, data.get_raw_data());
+}
+
+void AstarteJsonWriter::write(const AstarteDatastreamIndividual& data) { write(data.get_value()); }
+
+void AstarteJsonWriter::write(const AstarteDatastreamObject& data) {
+  buffer_ += '{';
+  bool first = true;
+  for (const auto& [path, value] : data) {
+    if (!first) {
+      buffer_ += ',';
+    }
+    first = false;
+    append_value(buffer_, path);
+    buffer_ += ':';
+    write(value);
+  }
+  buffer_ += '}';
+}
+
+void AstarteJsonWriter::write(const AstartePropertyIndividual& data) {
+  if (data.get_value().has_value()) {
+    write(data.get_value().value());
+  } else {
+    buffer_ += "null";
+  }
+}
+
+void AstarteJsonWriter::write(const AstarteMessage& msg) {
+  buffer_ += R"({"interface":)";
+  append_value(buffer_, msg.get_interface());
+  buffer_ += R"(,"path":)";
+  append_value(buffer_, msg.get_path());
+  buffer_ += R"(,"value":)";
+  std::visit([this](const auto& data) { write(data); }, msg.get_raw_data());
+  buffer_ += '}';
+}
+
+void AstarteJsonWriter::write(const AstarteStoredProperty& prop) {
+  buffer_ += R"({"interface":)";
+  append_value(buffer_, prop.get_interface_name());
+  buffer_ += R"(,"version_major":)";
+  append_integer(buffer_, prop.get_version_major());
+  buffer_ += R"(,"path":)";
+  append_value(buffer_, prop.get_path());
+  buffer_ += R"(,"ownership":)";
+  append_value(buffer_, ownership_as_str(prop.get_ownership()));
+  buffer_ += R"(,"value":)";
+  write(prop.get_value());
+  buffer_ += '}';
+}
+
+}  // namespace AstarteDeviceSdk
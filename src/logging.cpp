@@ -0,0 +1,159 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "astarte_device_sdk/logging.hpp"
+
+#include <spdlog/details/log_msg.h>
+#include <spdlog/details/log_msg_buffer.h>
+#include <spdlog/formatter.h>
+#include <spdlog/logger.h>
+#include <spdlog/sinks/sink.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
+#include <spdlog/spdlog.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+#include "sdk_logger.hpp"
+
+namespace AstarteDeviceSdk {
+
+namespace {
+
+auto to_log_level(spdlog::level::level_enum level) -> AstarteLogLevel {
+  switch (level) {
+    case spdlog::level::trace:
+      return AstarteLogLevel::kTrace;
+    case spdlog::level::debug:
+      return AstarteLogLevel::kDebug;
+    case spdlog::level::info:
+      return AstarteLogLevel::kInfo;
+    case spdlog::level::warn:
+      return AstarteLogLevel::kWarn;
+    case spdlog::level::err:
+      return AstarteLogLevel::kError;
+    default:
+      return AstarteLogLevel::kCritical;
+  }
+}
+
+// Queues the formatted lines in a bounded queue, written by its own thread to the standard output
+// or to the user callback. When the queue is full the new lines are dropped, logging never blocks.
+class QueuedSink final : public spdlog::sinks::sink {
+ public:
+  QueuedSink()
+      : console_(std::make_shared<spdlog::sinks::stdout_color_sink_mt>()),
+        worker_([this] { run(); }) {}
+  ~QueuedSink() override {
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    condition_.notify_one();
+    worker_.join();
+  }
+  QueuedSink(const QueuedSink& other) = delete;
+  QueuedSink(QueuedSink&& other) = delete;
+  auto operator=(const QueuedSink& other) -> QueuedSink& = delete;
+  auto operator=(QueuedSink&& other) -> QueuedSink& = delete;
+
+  void log(const spdlog::details::log_msg& msg) override {
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      if (lines_.size() >= ASTARTE_LOG_QUEUE_CAPACITY) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return;
+      }
+      lines_.emplace_back(msg);
+    }
+    condition_.notify_one();
+  }
+  void flush() override { console_->flush(); }
+  void set_pattern(const std::string& pattern) override { console_->set_pattern(pattern); }
+  void set_formatter(std::unique_ptr<spdlog::formatter> sink_formatter) override {
+    console_->set_formatter(std::move(sink_formatter));
+  }
+
+  void set_callback(AstarteLogCallback callback) {
+    std::shared_ptr<const AstarteLogCallback> shared;
+    if (callback) {
+      shared = std::make_shared<const AstarteLogCallback>(std::move(callback));
+    }
+    const std::lock_guard<std::mutex> lock(mutex_);
+    callback_ = std::move(shared);
+  }
+  [[nodiscard]] auto dropped() const -> uint64_t {
+    return dropped_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  void run() {
+    std::deque<spdlog::details::log_msg_buffer> batch;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      condition_.wait(lock, [this] { return stop_ || !lines_.empty(); });
+      // The queued lines are written before stopping
+      if (lines_.empty()) {
+        return;
+      }
+      batch.swap(lines_);
+      const std::shared_ptr<const AstarteLogCallback> callback = callback_;
+      lock.unlock();
+      for (const spdlog::details::log_msg_buffer& line : batch) {
+        if (callback) {
+          (*callback)(to_log_level(line.level),
+                      std::string_view(line.payload.data(), line.payload.size()));
+        } else {
+          console_->log(line);
+        }
+      }
+      batch.clear();
+      lock.lock();
+    }
+  }
+
+  std::shared_ptr<spdlog::sinks::sink> console_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::deque<spdlog::details::log_msg_buffer> lines_;
+  std::shared_ptr<const AstarteLogCallback> callback_;
+  std::atomic<uint64_t> dropped_{0};
+  bool stop_{false};
+  // Last member, the thread starts once the rest of the sink is initialized
+  std::thread worker_;
+};
+
+auto sdk_sink() -> const std::shared_ptr<QueuedSink>& {
+  static const std::shared_ptr<QueuedSink> sink = std::make_shared<QueuedSink>();
+  return sink;
+}
+
+}  // namespace
+
+auto sdk_logger() -> spdlog::logger* {
+  static const std::shared_ptr<spdlog::logger> logger = [] {
+    auto logger = std::make_shared<spdlog::logger>("astarte_device_sdk", sdk_sink());
+    // Registered, so that spdlog::set_level and spdlog::set_pattern apply to the library too
+    spdlog::initialize_logger(logger);
+    return logger;
+  }();
+  return logger.get();
+}
+
+void set_log_callback(AstarteLogCallback callback) {
+  static_cast<void>(sdk_logger());
+  sdk_sink()->set_callback(std::move(callback));
+}
+
+auto get_dropped_log_count() -> uint64_t { return sdk_sink()->dropped(); }
+
+}  // namespace AstarteDeviceSdk
@@ -0,0 +1,137 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "astarte_device_sdk/metrics.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+#include "metrics_registry.hpp"
+
+namespace AstarteDeviceSdk {
+
+namespace {
+
+void append_escaped_help(std::string& text, std::string_view help) {
+  for (const char character : help) {
+    if (character == '\\') {
+      text += "\\\\";
+    } else if (character == '\n') {
+      text += "\\n";
+    } else {
+      text += character;
+    }
+  }
+}
+
+void append_header(std::string& text, const std::string& name, const std::string& help,
+                   std::string_view type) {
+  text += "# HELP ";
+  text += name;
+  text += ' ';
+  append_escaped_help(text, help);
+  text += "\n# TYPE ";
+  text += name;
+  text += ' ';
+  text += type;
+  text += '\n';
+}
+
+template <typename T>
+void append_number(std::string& text, T value) {
+  // Long enough for any integer and for the shortest representation of any double
+  std::array<char, 32> buffer{};
+  const std::to_chars_result result =
+      std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+  text.append(buffer.data(), result.ptr);
+}
+
+void append_seconds(std::string& text, std::chrono::nanoseconds duration) {
+  append_number(text, std::chrono::duration<double>(duration).count());
+}
+
+}  // namespace
+
+auto AstarteHistogramMetric::percentile(double quantile) const -> std::chrono::nanoseconds {
+  if (count == 0) {
+    return std::chrono::nanoseconds(0);
+  }
+  const auto rank =
+      static_cast<uint64_t>(std::ceil(std::clamp(quantile, 0.0, 1.0) * static_cast<double>(count)));
+  uint64_t seen = 0;
+  for (const auto& [bound, samples] : buckets) {
+    seen += samples;
+    if ((seen >= rank) && (seen != 0)) {
+      return bound;
+    }
+  }
+  return buckets.empty() ? std::chrono::nanoseconds(0) : buckets.back().first;
+}
+
+auto get_metrics_snapshot() -> AstarteMetricsSnapshot {
+  // The metrics of the devices are registered even if no device has been created yet
+  static_cast<void>(sdk_metrics());
+  return MetricsRegistry::global().snapshot();
+}
+
+auto to_prometheus_text(const AstarteMetricsSnapshot& snapshot) -> std::string {
+  std::string text;
+  for (const AstarteCounterMetric& counter : snapshot.counters) {
+    append_header(text, counter.name, counter.help, "counter");
+    text += counter.name;
+    text += ' ';
+    append_number(text, counter.value);
+    text += '\n';
+  }
+  for (const AstarteGaugeMetric& gauge : snapshot.gauges) {
+    append_header(text, gauge.name, gauge.help, "gauge");
+    text += gauge.name;
+    text += ' ';
+    append_number(text, gauge.value);
+    text += '\n';
+  }
+  for (const AstarteHistogramMetric& histogram : snapshot.histograms) {
+    append_header(text, histogram.name, histogram.help, "histogram");
+    // Prometheus buckets are cumulative, only the powers of two are exported
+    uint64_t cumulative = 0;
+    for (std::size_t bucket = 0; bucket < histogram.buckets.size(); bucket++) {
+      const auto& [bound, samples] = histogram.buckets.at(bucket);
+      cumulative += samples;
+      const bool last = (bucket + 1 == histogram.buckets.size());
+      if (last || !std::has_single_bit(static_cast<uint64_t>(bound.count()))) {
+        continue;
+      }
+      text += histogram.name;
+      text += "_bucket{le=\"";
+      append_seconds(text, bound);
+      text += "\"} ";
+      append_number(text, cumulative);
+      text += '\n';
+    }
+    text += histogram.name;
+    text += "_bucket{le=\"+Inf\"} ";
+    append_number(text, histogram.count);
+    text += '\n';
+    text += histogram.name;
+    text += "_sum ";
+    append_seconds(text, histogram.sum);
+    text += '\n';
+    text += histogram.name;
+    text += "_count ";
+    append_number(text, histogram.count);
+    text += '\n';
+  }
+  return text;
+}
+
+}  // namespace AstarteDeviceSdk
@@ -0,0 +1,170 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "metrics_registry.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bitset>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "astarte_device_sdk/metrics.hpp"
+
+namespace AstarteDeviceSdk {
+
+namespace {
+
+struct MetricsSlots {
+  std::mutex mutex;
+  std::bitset<METRICS_SLOTS> used;
+};
+
+// Never destroyed, threads might exit after the static destructors have run
+auto get_metrics_slots() -> MetricsSlots& {
+  static auto* slots = new MetricsSlots();
+  return *slots;
+}
+
+// Releases the slot of a thread when it exits, its cells keep their values for the next owner
+struct MetricsSlotRelease {
+  std::size_t slot{METRICS_SLOTS};
+
+  MetricsSlotRelease() = default;
+  ~MetricsSlotRelease() {
+    if (slot < METRICS_SLOTS) {
+      MetricsSlots& slots = get_metrics_slots();
+      const std::lock_guard<std::mutex> lock(slots.mutex);
+      slots.used.reset(slot);
+    }
+  }
+  MetricsSlotRelease(const MetricsSlotRelease& other) = delete;
+  MetricsSlotRelease(MetricsSlotRelease&& other) = delete;
+  auto operator=(const MetricsSlotRelease& other) -> MetricsSlotRelease& = delete;
+  auto operator=(MetricsSlotRelease&& other) -> MetricsSlotRelease& = delete;
+};
+
+}  // namespace
+
+auto acquire_metrics_slot() -> std::size_t {
+  thread_local MetricsSlotRelease release;
+  MetricsSlots& slots = get_metrics_slots();
+  const std::lock_guard<std::mutex> lock(slots.mutex);
+  for (std::size_t slot = 0; slot < METRICS_SLOTS; slot++) {
+    if (!slots.used.test(slot)) {
+      slots.used.set(slot);
+      release.slot = slot;
+      return slot;
+    }
+  }
+  return METRICS_SLOTS;
+}
+
+auto Counter::load() const -> uint64_t {
+  uint64_t total = 0;
+  for (const Cell& cell : cells_) {
+    total += cell.value.load(std::memory_order_relaxed);
+  }
+  return total;
+}
+
+auto Gauge::load() const -> int64_t {
+  int64_t total = 0;
+  for (const Cell& cell : cells_) {
+    total += cell.value.load(std::memory_order_relaxed);
+  }
+  return total;
+}
+
+void LatencyHistogram::load(AstarteHistogramMetric& metric) const {
+  metric.count = 0;
+  metric.sum = std::chrono::nanoseconds(0);
+  metric.buckets.clear();
+  metric.buckets.reserve(BUCKETS);
+  for (std::size_t bucket = 0; bucket < BUCKETS; bucket++) {
+    metric.buckets.emplace_back(std::chrono::nanoseconds(upper_bound(bucket)), 0);
+  }
+  uint64_t sum = 0;
+  for (const Cell& cell : cells_) {
+    for (std::size_t bucket = 0; bucket < BUCKETS; bucket++) {
+      const uint64_t count = cell.counts.at(bucket).load(std::memory_order_relaxed);
+      metric.buckets.at(bucket).second += count;
+      metric.count += count;
+    }
+    sum += cell.sum.load(std::memory_order_relaxed);
+  }
+  metric.sum = std::chrono::nanoseconds(sum);
+}
+
+auto MetricsRegistry::global() -> MetricsRegistry& {
+  static MetricsRegistry registry;
+  return registry;
+}
+
+auto MetricsRegistry::add_counter(std::string name, std::string help) -> Counter& {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  return counters_.emplace_back(std::move(name), std::move(help)).metric;
+}
+
+auto MetricsRegistry::add_gauge(std::string name, std::string help) -> Gauge& {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  return gauges_.emplace_back(std::move(name), std::move(help)).metric;
+}
+
+auto MetricsRegistry::add_histogram(std::string name, std::string help) -> LatencyHistogram& {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  return histograms_.emplace_back(std::move(name), std::move(help)).metric;
+}
+
+auto MetricsRegistry::snapshot() const -> AstarteMetricsSnapshot {
+  AstarteMetricsSnapshot snapshot;
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    for (const Entry<Counter>& entry : counters_) {
+      snapshot.counters.push_back({entry.name, entry.help, entry.metric.load()});
+    }
+    for (const Entry<Gauge>& entry : gauges_) {
+      snapshot.gauges.push_back({entry.name, entry.help, entry.metric.load()});
+    }
+    for (const Entry<LatencyHistogram>& entry : histograms_) {
+      AstarteHistogramMetric& histogram = snapshot.histograms.emplace_back();
+      histogram.name = entry.name;
+      histogram.help = entry.help;
+      entry.metric.load(histogram);
+    }
+  }
+  auto by_name = [](const auto& first, const auto& second) { return first.name < second.name; };
+  std::ranges::sort(snapshot.counters, by_name);
+  std::ranges::sort(snapshot.gauges, by_name);
+  std::ranges::sort(snapshot.histograms, by_name);
+  return snapshot;
+}
+
+auto sdk_metrics() -> SdkMetrics& {
+  static SdkMetrics metrics{
+      MetricsRegistry::global().add_counter("astarte_sdk_messages_sent_total",
+                                            "Messages successfully sent to the message hub."),
+      MetricsRegistry::global().add_counter("astarte_sdk_send_failures_total",
+                                            "Messages whose send to the message hub failed."),
+      MetricsRegistry::global().add_counter("astarte_sdk_property_updates_total",
+                                            "Properties set or unset by the devices."),
+      MetricsRegistry::global().add_counter("astarte_sdk_events_received_total",
+                                            "Events received from the message hub."),
+      MetricsRegistry::global().add_counter("astarte_sdk_connection_attempts_total",
+                                            "Attempts to attach to the message hub."),
+      MetricsRegistry::global().add_counter("astarte_sdk_reconnections_total",
+                                            "Reconnections scheduled after a lost connection."),
+      MetricsRegistry::global().add_gauge("astarte_sdk_receive_queue_depth",
+                                          "Received messages not yet polled by the application."),
+      MetricsRegistry::global().add_histogram("astarte_sdk_send_latency_seconds",
+                                              "Time between the start of a send and its response."),
+  };
+  return metrics;
+}
+
+}  // namespace AstarteDeviceSdk
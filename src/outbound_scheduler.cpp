@@ -0,0 +1,152 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "outbound_scheduler.hpp"
+
+#include <grpcpp/grpcpp.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "astarte_device_sdk/send_priority.hpp"
+#include "timer_wheel.hpp"
+
+namespace AstarteDeviceSdk {
+
+OutboundScheduler::OutboundScheduler(std::size_t high_window, std::size_t normal_window,
+                                     TimerWheel& wheel)
+    : wheel_(wheel), lanes_{Lane{.window = high_window}, Lane{.window = normal_window}} {}
+
+void OutboundScheduler::set_interface_priority(std::string_view interface_name,
+                                               AstarteSendPriority priority) {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  overrides_.insert_or_assign(std::string(interface_name), priority);
+  has_overrides_.store(true, std::memory_order_release);
+}
+
+auto OutboundScheduler::get_priority(std::string_view interface_name, bool is_property)
+    -> AstarteSendPriority {
+  if (has_overrides_.load(std::memory_order_acquire)) {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = overrides_.find(interface_name);
+    if (iter != overrides_.end()) {
+      return iter->second;
+    }
+  }
+  return is_property ? AstarteSendPriority::kHigh : AstarteSendPriority::kNormal;
+}
+
+void OutboundScheduler::submit(AstarteSendPriority priority, StartSend start, OnDone on_done) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (closed_) {
+    lock.unlock();
+    on_done(grpc::Status(grpc::StatusCode::CANCELLED, "The device has been destroyed."));
+    return;
+  }
+  lanes_.at(static_cast<std::size_t>(priority))
+      .queue.push_back(
+          Pending{std::move(start), std::move(on_done), std::chrono::steady_clock::now()});
+  dispatch(lock);
+}
+
+void OutboundScheduler::submit_after(std::chrono::nanoseconds delay, AstarteSendPriority priority,
+                                     StartSend start, OnDone on_done) {
+  wheel_.schedule(std::chrono::ceil<std::chrono::milliseconds>(delay),
+                  [weak = weak_from_this(), priority, start = std::move(start),
+                   on_done = std::move(on_done)]() mutable {
+                    auto self = weak.lock();
+                    if (!self) {
+                      on_done(grpc::Status(grpc::StatusCode::CANCELLED,
+                                           "The device has been destroyed."));
+                      return;
+                    }
+                    self->submit(priority, std::move(start), std::move(on_done));
+                  });
+}
+
+auto OutboundScheduler::get_stats(AstarteSendPriority priority) -> AstarteSendLaneStats {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  const Lane& lane = lanes_.at(static_cast<std::size_t>(priority));
+  AstarteSendLaneStats stats;
+  stats.sent = lane.sent;
+  stats.queued = lane.queue.size();
+  if (lane.sent != 0) {
+    stats.mean_wait = std::chrono::duration_cast<std::chrono::microseconds>(
+        lane.total_wait / static_cast<int64_t>(lane.sent));
+  }
+  stats.max_wait = std::chrono::duration_cast<std::chrono::microseconds>(lane.max_wait);
+  return stats;
+}
+
+void OutboundScheduler::close() {
+  std::deque<Pending> cancelled;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    closed_ = true;
+    for (Lane& lane : lanes_) {
+      while (!lane.queue.empty()) {
+        cancelled.push_back(std::move(lane.queue.front()));
+        lane.queue.pop_front();
+      }
+    }
+    // The sends being started might still use the resources of the device
+    idle_cv_.wait(lock, [this] { return starting_ == 0; });
+  }
+  for (Pending& pending : cancelled) {
+    pending.on_done(grpc::Status(grpc::StatusCode::CANCELLED, "The device has been destroyed."));
+  }
+}
+
+void OutboundScheduler::dispatch(std::unique_lock<std::mutex>& lock) {
+  // The high priority lane comes first, then the lower ones
+  for (std::size_t index = 0; index < lanes_.size();) {
+    Lane& lane = lanes_.at(index);
+    if (closed_ || lane.queue.empty() || (lane.in_flight >= lane.window)) {
+      index++;
+      continue;
+    }
+
+    Pending pending = std::move(lane.queue.front());
+    lane.queue.pop_front();
+    lane.in_flight++;
+    lane.sent++;
+    const auto wait = std::chrono::steady_clock::now() - pending.enqueued;
+    lane.total_wait += wait;
+    lane.max_wait = std::max(lane.max_wait, wait);
+    starting_++;
+
+    // The send might complete inline, never start it while holding the lock
+    lock.unlock();
+    const auto priority = static_cast<AstarteSendPriority>(index);
+    pending.start([self = shared_from_this(), priority,
+                   on_done = std::move(pending.on_done)](const grpc::Status& status) {
+      self->complete(priority);
+      on_done(status);
+    });
+    lock.lock();
+
+    starting_--;
+    if (starting_ == 0) {
+      idle_cv_.notify_all();
+    }
+    // A higher priority send might have been queued in the meantime
+    index = 0;
+  }
+}
+
+void OutboundScheduler::complete(AstarteSendPriority priority) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  lanes_.at(static_cast<std::size_t>(priority)).in_flight--;
+  dispatch(lock);
+}
+
+}  // namespace AstarteDeviceSdk
@@ -0,0 +1,273 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "property_cache.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/ownership.hpp"
+#include "astarte_device_sdk/property.hpp"
+#include "astarte_device_sdk/stored_property.hpp"
+#include "sdk_logger.hpp"
+
+namespace AstarteDeviceSdk {
+
+void PropertyCache::set_enabled(bool enabled) { enabled_.store(enabled); }
+
+auto PropertyCache::is_enabled() const -> bool { return enabled_.load(); }
+
+void PropertyCache::add_interface(std::string_view json) {
+  const std::string interface_json(json);
+  const std::regex type_pattern(R"(\"type\"\s*:\s*\"properties\")");
+  if (!std::regex_search(interface_json, type_pattern)) {
+    return;
+  }
+
+  std::smatch name_match;
+  std::smatch version_match;
+  std::smatch ownership_match;
+  const std::regex name_pattern(R"(\"interface_name\"\s*:\s*\"([^\"]+)\")");
+  const std::regex version_pattern(R"(\"version_major\"\s*:\s*(\d+))");
+  const std::regex ownership_pattern(R"(\"ownership\"\s*:\s*\"(device|server)\")");
+  if (!std::regex_search(interface_json, name_match, name_pattern) ||
+      !std::regex_search(interface_json, version_match, version_pattern) ||
+      !std::regex_search(interface_json, ownership_match, ownership_pattern)) {
+    ASTARTE_LOG_WARN("Malformed properties interface, its properties will not be cached.");
+    return;
+  }
+
+  auto interface = std::make_shared<InterfaceProperties>();
+  interface->version_major = static_cast<int32_t>(std::stoi(version_match[1].str()));
+  interface->ownership = (ownership_match[1].str() == "server") ? AstarteOwnership::kServer
+                                                                : AstarteOwnership::kDevice;
+
+  const std::lock_guard<std::mutex> lock(write_mutex_);
+  auto snapshot = std::make_shared<Snapshot>(*load());
+  snapshot->insert_or_assign(name_match[1].str(), std::move(interface));
+  snapshot_.store(std::move(snapshot), std::memory_order_release);
+}
+
+void PropertyCache::remove_interface(std::string_view interface_name) {
+  const std::lock_guard<std::mutex> lock(write_mutex_);
+  auto snapshot = std::make_shared<Snapshot>(*load());
+  auto iter = snapshot->find(interface_name);
+  if (iter == snapshot->end()) {
+    return;
+  }
+  snapshot->erase(iter);
+  snapshot_.store(std::move(snapshot), std::memory_order_release);
+}
+
+auto PropertyCache::begin_snapshot() -> uint64_t {
+  const std::lock_guard<std::mutex> lock(write_mutex_);
+  snapshot_pending_ = true;
+  updated_while_pending_.clear();
+  return ++generation_;
+}
+
+void PropertyCache::load_snapshot(uint64_t generation,
+                                  const std::list<AstarteStoredProperty>& properties) {
+  const std::lock_guard<std::mutex> lock(write_mutex_);
+  // The cache has been invalidated, or another snapshot requested, since this one was requested
+  if (!snapshot_pending_ || (generation != generation_)) {
+    ASTARTE_LOG_DEBUG("Discarded an outdated snapshot of the properties.");
+    return;
+  }
+  const std::shared_ptr<const Snapshot> current = load();
+
+  // Start from empty interfaces, keeping only the values updated after the snapshot request. The
+  // buckets are filled in place and shared once complete.
+  using Buckets = std::array<ValueBucket, VALUE_BUCKETS>;
+  StringMap<std::pair<std::shared_ptr<InterfaceProperties>, Buckets>> interfaces;
+  for (const auto& [name, interface] : *current) {
+    auto loaded = std::make_shared<InterfaceProperties>();
+    loaded->version_major = interface->version_major;
+    loaded->ownership = interface->ownership;
+    loaded->complete = true;
+    Buckets buckets;
+    for (const std::shared_ptr<const ValueBucket>& bucket : interface->values) {
+      if (!bucket) {
+        continue;
+      }
+      for (const auto& [path, value] : *bucket) {
+        if (updated_while_pending_.contains({name, path})) {
+          buckets.at(bucket_index(path)).insert_or_assign(path, value);
+        }
+      }
+    }
+    interfaces.insert_or_assign(name, std::make_pair(std::move(loaded), std::move(buckets)));
+  }
+
+  for (const AstarteStoredProperty& property : properties) {
+    auto iter = interfaces.find(property.get_interface_name());
+    if (iter == interfaces.end()) {
+      continue;
+    }
+    if (!updated_while_pending_.contains({property.get_interface_name(), property.get_path()})) {
+      iter->second.second.at(bucket_index(property.get_path()))
+          .insert_or_assign(property.get_path(), property.get_value());
+    }
+  }
+
+  auto snapshot = std::make_shared<Snapshot>();
+  for (auto& [name, loaded] : interfaces) {
+    auto& [interface, buckets] = loaded;
+    for (std::size_t index = 0; index < VALUE_BUCKETS; index++) {
+      if (!buckets.at(index).empty()) {
+        interface->values.at(index) =
+            std::make_shared<const ValueBucket>(std::move(buckets.at(index)));
+      }
+    }
+    snapshot->insert_or_assign(name, std::move(interface));
+  }
+  snapshot_pending_ = false;
+  updated_while_pending_.clear();
+  snapshot_.store(std::move(snapshot), std::memory_order_release);
+  ASTARTE_LOG_DEBUG("Loaded {} properties in the cache.", properties.size());
+}
+
+void PropertyCache::invalidate() {
+  const std::lock_guard<std::mutex> lock(write_mutex_);
+  auto snapshot = std::make_shared<Snapshot>();
+  for (const auto& [name, interface] : *load()) {
+    auto cleared = std::make_shared<InterfaceProperties>();
+    cleared->version_major = interface->version_major;
+    cleared->ownership = interface->ownership;
+    snapshot->insert_or_assign(name, std::move(cleared));
+  }
+  generation_++;
+  snapshot_pending_ = false;
+  updated_while_pending_.clear();
+  snapshot_.store(std::move(snapshot), std::memory_order_release);
+}
+
+void PropertyCache::update(std::string_view interface_name, std::string_view path,
+                           const std::optional<AstarteData>& value) {
+  const std::lock_guard<std::mutex> lock(write_mutex_);
+  const std::shared_ptr<const Snapshot> current = load();
+  auto iter = current->find(interface_name);
+  if (iter == current->end()) {
+    return;
+  }
+
+  // Only the bucket of the path is copied, the other buckets and interfaces are shared
+  auto interface = std::make_shared<InterfaceProperties>(*iter->second);
+  set_value(*interface, path, value);
+  auto snapshot = std::make_shared<Snapshot>(*current);
+  snapshot->insert_or_assign(std::string(interface_name), std::move(interface));
+  if (snapshot_pending_) {
+    updated_while_pending_.emplace(interface_name, path);
+  }
+  snapshot_.store(std::move(snapshot), std::memory_order_release);
+}
+
+auto PropertyCache::get_property(std::string_view interface_name, std::string_view path) const
+    -> std::optional<AstartePropertyIndividual> {
+  if (!is_enabled()) {
+    return std::nullopt;
+  }
+  const std::shared_ptr<const Snapshot> snapshot = load();
+  auto interface_iter = snapshot->find(interface_name);
+  if (interface_iter == snapshot->end()) {
+    return std::nullopt;
+  }
+  const InterfaceProperties& interface = *interface_iter->second;
+  if (const std::optional<AstarteData>* value = find_value(interface, path)) {
+    return AstartePropertyIndividual(*value);
+  }
+  if (interface.complete) {
+    return AstartePropertyIndividual(std::nullopt);
+  }
+  return std::nullopt;
+}
+
+auto PropertyCache::get_properties(std::string_view interface_name) const
+    -> std::optional<std::list<AstarteStoredProperty>> {
+  if (!is_enabled()) {
+    return std::nullopt;
+  }
+  const std::shared_ptr<const Snapshot> snapshot = load();
+  auto iter = snapshot->find(interface_name);
+  if ((iter == snapshot->end()) || !iter->second->complete) {
+    return std::nullopt;
+  }
+  std::list<AstarteStoredProperty> properties;
+  append_properties(iter->first, *iter->second, properties);
+  return properties;
+}
+
+auto PropertyCache::get_all_properties(const std::optional<AstarteOwnership>& ownership) const
+    -> std::optional<std::list<AstarteStoredProperty>> {
+  if (!is_enabled()) {
+    return std::nullopt;
+  }
+  const std::shared_ptr<const Snapshot> snapshot = load();
+  std::list<AstarteStoredProperty> properties;
+  for (const auto& [name, interface] : *snapshot) {
+    if (ownership.has_value() && (interface->ownership != ownership.value())) {
+      continue;
+    }
+    if (!interface->complete) {
+      return std::nullopt;
+    }
+    append_properties(name, *interface, properties);
+  }
+  return properties;
+}
+
+auto PropertyCache::load() const -> std::shared_ptr<const Snapshot> {
+  return snapshot_.load(std::memory_order_acquire);
+}
+
+auto PropertyCache::bucket_index(std::string_view path) -> std::size_t {
+  return std::hash<std::string_view>{}(path) % VALUE_BUCKETS;
+}
+
+auto PropertyCache::find_value(const InterfaceProperties& interface, std::string_view path)
+    -> const std::optional<AstarteData>* {
+  const std::shared_ptr<const ValueBucket>& bucket = interface.values.at(bucket_index(path));
+  if (!bucket) {
+    return nullptr;
+  }
+  auto iter = bucket->find(path);
+  return (iter != bucket->end()) ? &iter->second : nullptr;
+}
+
+void PropertyCache::set_value(InterfaceProperties& interface, std::string_view path,
+                              const std::optional<AstarteData>& value) {
+  std::shared_ptr<const ValueBucket>& bucket = interface.values.at(bucket_index(path));
+  auto updated = bucket ? std::make_shared<ValueBucket>(*bucket) : std::make_shared<ValueBucket>();
+  updated->insert_or_assign(std::string(path), value);
+  bucket = std::move(updated);
+}
+
+void PropertyCache::append_properties(const std::string& interface_name,
+                                      const InterfaceProperties& interface,
+                                      std::list<AstarteStoredProperty>& properties) {
+  for (const std::shared_ptr<const ValueBucket>& bucket : interface.values) {
+    if (!bucket) {
+      continue;
+    }
+    for (const auto& [path, value] : *bucket) {
+      if (value.has_value()) {
+        properties.emplace_back(interface_name, path, interface.version_major,
+                                interface.ownership, value.value());
+      }
+    }
+  }
+}
+
+}  // namespace AstarteDeviceSdk
@@ -0,0 +1,130 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "property_dedup.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+
+namespace AstarteDeviceSdk {
+
+namespace {
+
+void hash_combine(std::size_t& seed, std::size_t value) {
+  seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6U) + (seed >> 2U);
+}
+
+template <typename T>
+auto hash_value(const T& value) -> std::size_t {
+  if constexpr (std::is_same_v<T, std::chrono::system_clock::time_point>) {
+    return std::hash<std::chrono::system_clock::rep>{}(value.time_since_epoch().count());
+  } else {
+    return std::hash<T>{}(value);
+  }
+}
+
+template <typename T>
+auto hash_value(const std::vector<T>& values) -> std::size_t {
+  if constexpr (std::is_same_v<T, uint8_t>) {
+    const std::string_view bytes(reinterpret_cast<const char*>(values.data()), values.size());
+    return std::hash<std::string_view>{}(bytes);
+  } else {
+    std::size_t seed = values.size();
+    for (const auto& value : values) {
+      hash_combine(seed, hash_value(static_cast<const T&>(value)));
+    }
+    return seed;
+  }
+}
+
+}  // namespace
+
+void PropertyDedupTable::set_enabled(bool enabled) {
+  enabled_.store(enabled);
+  if (!enabled) {
+    clear();
+  }
+}
+
+auto PropertyDedupTable::is_enabled() const -> bool { return enabled_.load(); }
+
+auto PropertyDedupTable::suppress(std::string_view interface_name, std::string_view path,
+                                  const AstarteData& data) -> bool {
+  if (!is_enabled()) {
+    return false;
+  }
+  const std::size_t data_hash = hash(data);
+  const std::lock_guard<std::mutex> lock(mutex_);
+  auto interface_iter = entries_.find(interface_name);
+  if (interface_iter == entries_.end()) {
+    return false;
+  }
+  auto entry_iter = interface_iter->second.find(path);
+  if (entry_iter == interface_iter->second.end()) {
+    return false;
+  }
+  const Entry& entry = entry_iter->second;
+  if ((entry.hash != data_hash) || (entry.data != data)) {
+    return false;
+  }
+  suppressed_++;
+  return true;
+}
+
+void PropertyDedupTable::record(std::string_view interface_name, std::string_view path,
+                                const AstarteData& data) {
+  if (!is_enabled()) {
+    return;
+  }
+  Entry entry{hash(data), data};
+  const std::lock_guard<std::mutex> lock(mutex_);
+  auto interface_iter = entries_.find(interface_name);
+  if (interface_iter == entries_.end()) {
+    interface_iter = entries_.emplace(std::string(interface_name), StringMap<Entry>()).first;
+  }
+  auto entry_iter = interface_iter->second.find(path);
+  if (entry_iter == interface_iter->second.end()) {
+    interface_iter->second.emplace(std::string(path), std::move(entry));
+  } else {
+    entry_iter->second = std::move(entry);
+  }
+}
+
+void PropertyDedupTable::forget(std::string_view interface_name, std::string_view path) {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  auto interface_iter = entries_.find(interface_name);
+  if (interface_iter == entries_.end()) {
+    return;
+  }
+  auto entry_iter = interface_iter->second.find(path);
+  if (entry_iter != interface_iter->second.end()) {
+    interface_iter->second.erase(entry_iter);
+  }
+}
+
+void PropertyDedupTable::clear() {
+  const std::lock_guard<std::mutex> lock(mutex_);
+  entries_.clear();
+}
+
+auto PropertyDedupTable::get_suppressed_count() const -> uint64_t { return suppressed_.load(); }
+
+auto PropertyDedupTable::hash(const AstarteData& data) -> std::size_t {
+  std::size_t seed = data.get_raw_data().index();
+  std::visit([&seed](const auto& value) { hash_combine(seed, hash_value(value)); },
+             data.get_raw_data());
+  return seed;
+}
+
+}  // namespace AstarteDeviceSdk
@@ -0,0 +1,41 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "astarte_device_sdk/property_update.hpp"
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "astarte_device_sdk/data.hpp"
+
+namespace AstarteDeviceSdk {
+
+AstartePropertyUpdate::AstartePropertyUpdate(std::string_view interface_name,
+                                             std::string_view path, AstarteData data)
+    : interface_name_(interface_name), path_(path), data_(std::move(data)) {}
+
+AstartePropertyUpdate::AstartePropertyUpdate(std::string_view interface_name,
+                                             std::string_view path)
+    : interface_name_(interface_name), path_(path) {}
+
+auto AstartePropertyUpdate::get_interface_name() const -> const std::string& {
+  return interface_name_;
+}
+
+auto AstartePropertyUpdate::get_path() const -> const std::string& { return path_; }
+
+auto AstartePropertyUpdate::get_value() const -> const std::optional<AstarteData>& {
+  return data_;
+}
+
+AstartePropertyUpdateStatus::AstartePropertyUpdateStatus(std::string_view error)
+    : ok_(false), error_(error) {}
+
+auto AstartePropertyUpdateStatus::is_ok() const -> bool { return ok_; }
+
+auto AstartePropertyUpdateStatus::get_error() const -> const std::string& { return error_; }
+
+}  // namespace AstarteDeviceSdk
@@ -0,0 +1,40 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "astarte_device_sdk/rate_limit.hpp"
+
+#include <cstdint>
+#include <optional>
+
+namespace AstarteDeviceSdk {
+
+AstarteRateLimit::AstarteRateLimit(OverLimit over_limit) : over_limit_(over_limit) {}
+
+auto AstarteRateLimit::with_messages(double per_second, uint64_t burst) -> AstarteRateLimit& {
+  messages_per_second_ = per_second;
+  message_burst_ = burst;
+  return *this;
+}
+
+auto AstarteRateLimit::with_bytes(double per_second, uint64_t burst) -> AstarteRateLimit& {
+  bytes_per_second_ = per_second;
+  byte_burst_ = burst;
+  return *this;
+}
+
+auto AstarteRateLimit::get_over_limit() const -> OverLimit { return over_limit_; }
+
+auto AstarteRateLimit::get_messages_per_second() const -> const std::optional<double>& {
+  return messages_per_second_;
+}
+
+auto AstarteRateLimit::get_message_burst() const -> uint64_t { return message_burst_; }
+
+auto AstarteRateLimit::get_bytes_per_second() const -> const std::optional<double>& {
+  return bytes_per_second_;
+}
+
+auto AstarteRateLimit::get_byte_burst() const -> uint64_t { return byte_burst_; }
+
+}  // namespace AstarteDeviceSdk
@@ -0,0 +1,265 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "rate_limiter.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+
+#include "astarte_device_sdk/rate_limit.hpp"
+
+namespace AstarteDeviceSdk {
+
+namespace {
+
+auto to_nanoseconds(std::chrono::steady_clock::time_point time) -> int64_t {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+}
+
+}  // namespace
+
+GcraBucket::GcraBucket(double per_second, uint64_t burst)
+    // A null rate would never admit anything, it's rounded to a unit every few years
+    : interval_(1e9 / std::max(per_second, 1e-9)),
+      tolerance_(std::llround(interval_ * static_cast<double>(std::max<uint64_t>(burst, 1)))) {}
+
+auto GcraBucket::try_acquire(uint64_t cost, std::chrono::steady_clock::time_point now)
+    -> std::chrono::nanoseconds {
+  const int64_t now_ns = to_nanoseconds(now);
+  const int64_t step = increment(cost);
+  // Requests larger than the burst are admitted when the bucket is full
+  const int64_t tolerance = std::max(tolerance_, step);
+  int64_t arrival = theoretical_arrival_.load(std::memory_order_relaxed);
+  while (true) {
+    const int64_t next = std::max(arrival, now_ns) + step;
+    if (next - now_ns > tolerance) {
+      return std::chrono::nanoseconds(next - now_ns - tolerance);
+    }
+    if (theoretical_arrival_.compare_exchange_weak(arrival, next, std::memory_order_relaxed)) {
+      return std::chrono::nanoseconds(0);
+    }
+  }
+}
+
+auto GcraBucket::reserve(uint64_t cost, std::chrono::steady_clock::time_point now)
+    -> std::chrono::nanoseconds {
+  const int64_t now_ns = to_nanoseconds(now);
+  const int64_t step = increment(cost);
+  const int64_t tolerance = std::max(tolerance_, step);
+  int64_t arrival = theoretical_arrival_.load(std::memory_order_relaxed);
+  int64_t next = 0;
+  do {
+    next = std::max(arrival, now_ns) + step;
+  } while (!theoretical_arrival_.compare_exchange_weak(arrival, next, std::memory_order_relaxed));
+  return std::chrono::nanoseconds(std::max<int64_t>(next - now_ns - tolerance, 0));
+}
+
+void GcraBucket::refund(uint64_t cost) {
+  theoretical_arrival_.fetch_sub(increment(cost), std::memory_order_relaxed);
+}
+
+auto GcraBucket::increment(uint64_t cost) const -> int64_t {
+  return std::llround(interval_ * static_cast<double>(cost));
+}
+
+RateLimiter::Limit::Limit(const AstarteRateLimit& limit) : over_limit(limit.get_over_limit()) {
+  if (limit.get_messages_per_second().has_value()) {
+    messages.emplace(limit.get_messages_per_second().value(), limit.get_message_burst());
+  }
+  if (limit.get_bytes_per_second().has_value()) {
+    bytes.emplace(limit.get_bytes_per_second().value(), limit.get_byte_burst());
+  }
+}
+
+auto RateLimiter::Limit::try_acquire(std::size_t size, std::chrono::steady_clock::time_point now)
+    -> std::chrono::nanoseconds {
+  if (messages.has_value()) {
+    const std::chrono::nanoseconds delay = messages->try_acquire(1, now);
+    if (delay.count() != 0) {
+      return delay;
+    }
+  }
+  if (bytes.has_value()) {
+    const std::chrono::nanoseconds delay = bytes->try_acquire(size, now);
+    if (delay.count() != 0) {
+      if (messages.has_value()) {
+        messages->refund(1);
+      }
+      return delay;
+    }
+  }
+  return std::chrono::nanoseconds(0);
+}
+
+auto RateLimiter::Limit::reserve(std::size_t size, std::chrono::steady_clock::time_point now)
+    -> std::chrono::nanoseconds {
+  std::chrono::nanoseconds delay(0);
+  if (messages.has_value()) {
+    delay = messages->reserve(1, now);
+  }
+  if (bytes.has_value()) {
+    delay = std::max(delay, bytes->reserve(size, now));
+  }
+  return delay;
+}
+
+void RateLimiter::Limit::refund(std::size_t size) {
+  if (messages.has_value()) {
+    messages->refund(1);
+  }
+  if (bytes.has_value()) {
+    bytes->refund(size);
+  }
+}
+
+void RateLimiter::set_device_limit(const std::optional<AstarteRateLimit>& limit) {
+  const std::unique_lock<std::shared_mutex> lock(mutex_);
+  device_limit_ = limit.has_value() ? std::make_shared<Limit>(limit.value()) : nullptr;
+  has_limits_.store((device_limit_ != nullptr) || !interface_limits_.empty(),
+                    std::memory_order_release);
+}
+
+void RateLimiter::set_interface_limit(std::string_view interface_name,
+                                      const std::optional<AstarteRateLimit>& limit) {
+  const std::unique_lock<std::shared_mutex> lock(mutex_);
+  if (limit.has_value()) {
+    interface_limits_.insert_or_assign(std::string(interface_name),
+                                       std::make_shared<Limit>(limit.value()));
+  } else {
+    auto iter = interface_limits_.find(interface_name);
+    if (iter != interface_limits_.end()) {
+      interface_limits_.erase(iter);
+    }
+  }
+  has_limits_.store((device_limit_ != nullptr) || !interface_limits_.empty(),
+                    std::memory_order_release);
+}
+
+auto RateLimiter::is_enabled() const -> bool {
+  return has_limits_.load(std::memory_order_acquire);
+}
+
+auto RateLimiter::admit(std::string_view interface_name, std::size_t bytes,
+                        std::chrono::steady_clock::time_point now) -> Admission {
+  if (!has_limits_.load(std::memory_order_acquire)) {
+    return {};
+  }
+  const Limits limits = find_limits(interface_name);
+  if (!limits[0] && !limits[1]) {
+    return {};
+  }
+
+  Admission admission;
+  for (std::size_t index = 0; index < limits.size(); index++) {
+    if (!limits.at(index)) {
+      continue;
+    }
+    Limit& limit = *limits.at(index);
+    if (limit.over_limit == AstarteRateLimit::OverLimit::kDrop) {
+      // Dropped messages must not take their share of the other limits
+      if (limit.try_acquire(bytes, now).count() != 0) {
+        refund(limits, index, bytes);
+        admission = Admission{Admission::Action::kDrop, std::chrono::nanoseconds(0)};
+        break;
+      }
+      continue;
+    }
+    const std::chrono::nanoseconds delay = limit.reserve(bytes, now);
+    if (delay > admission.delay) {
+      admission.delay = delay;
+      admission.action = (limit.over_limit == AstarteRateLimit::OverLimit::kBlock)
+                             ? Admission::Action::kWait
+                             : Admission::Action::kDefer;
+    }
+  }
+  count(admission);
+  return admission;
+}
+
+auto RateLimiter::try_admit(std::string_view interface_name, std::size_t bytes,
+                            std::chrono::steady_clock::time_point now) -> Admission {
+  if (!has_limits_.load(std::memory_order_acquire)) {
+    return {};
+  }
+  const Limits limits = find_limits(interface_name);
+  if (!limits[0] && !limits[1]) {
+    return {};
+  }
+
+  for (std::size_t index = 0; index < limits.size(); index++) {
+    if (!limits.at(index)) {
+      continue;
+    }
+    Limit& limit = *limits.at(index);
+    const std::chrono::nanoseconds delay = limit.try_acquire(bytes, now);
+    if (delay.count() == 0) {
+      continue;
+    }
+    refund(limits, index, bytes);
+    if (limit.over_limit == AstarteRateLimit::OverLimit::kDrop) {
+      const Admission dropped{Admission::Action::kDrop, std::chrono::nanoseconds(0)};
+      count(dropped);
+      return dropped;
+    }
+    // Retried later, it's counted once sent
+    return Admission{Admission::Action::kWait, delay};
+  }
+  const Admission admitted;
+  count(admitted);
+  return admitted;
+}
+
+auto RateLimiter::get_stats() const -> AstarteRateLimitStats {
+  return AstarteRateLimitStats{admitted_.load(), delayed_.load(), deferred_.load(),
+                               dropped_.load()};
+}
+
+auto RateLimiter::find_limits(std::string_view interface_name) -> Limits {
+  // Every lookup updates the reader count of the lock, shared by all the sending threads. The
+  // devices without limits skip it.
+  const std::shared_lock<std::shared_mutex> lock(mutex_);
+  Limits limits{nullptr, device_limit_};
+  auto iter = interface_limits_.find(interface_name);
+  if (iter != interface_limits_.end()) {
+    limits[0] = iter->second;
+  }
+  return limits;
+}
+
+void RateLimiter::refund(const Limits& limits, std::size_t count, std::size_t bytes) {
+  for (std::size_t index = 0; index < count; index++) {
+    if (limits.at(index)) {
+      limits.at(index)->refund(bytes);
+    }
+  }
+}
+
+void RateLimiter::count(const Admission& admission) {
+  switch (admission.action) {
+    case Admission::Action::kSend:
+      admitted_.fetch_add(1, std::memory_order_relaxed);
+      break;
+    case Admission::Action::kWait:
+      delayed_.fetch_add(1, std::memory_order_relaxed);
+      break;
+    case Admission::Action::kDefer:
+      deferred_.fetch_add(1, std::memory_order_relaxed);
+      break;
+    case Admission::Action::kDrop:
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+      break;
+  }
+}
+
+}  // namespace AstarteDeviceSdk
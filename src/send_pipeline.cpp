@@ -0,0 +1,95 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "send_pipeline.hpp"
+
+#include <grpcpp/grpcpp.h>
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace AstarteDeviceSdk {
+
+SendPipeline::SendPipeline(std::size_t max_in_flight, StartSend start_send)
+    : max_in_flight_(max_in_flight), start_send_(std::move(start_send)) {}
+
+auto SendPipeline::run(const std::vector<std::string>& keys) -> std::vector<grpc::Status> {
+  auto state = std::make_shared<State>();
+  state->total = keys.size();
+  state->keys = keys;
+  state->statuses.resize(keys.size());
+  for (std::size_t index = 0; index < keys.size(); index++) {
+    std::deque<std::size_t>& queue = state->queues[keys[index]];
+    queue.push_back(index);
+    if (queue.size() == 1) {
+      state->ready.push_back(index);
+    }
+  }
+  return wait(state);
+}
+
+auto SendPipeline::run(std::size_t count) -> std::vector<grpc::Status> {
+  auto state = std::make_shared<State>();
+  state->total = count;
+  state->statuses.resize(count);
+  for (std::size_t index = 0; index < count; index++) {
+    state->ready.push_back(index);
+  }
+  return wait(state);
+}
+
+auto SendPipeline::wait(const std::shared_ptr<State>& state) -> std::vector<grpc::Status> {
+  start_ready(state, max_in_flight_, start_send_);
+
+  std::unique_lock<std::mutex> lock(state->mutex);
+  state->done_cv.wait(lock, [&state] { return state->completed == state->total; });
+  return std::move(state->statuses);
+}
+
+void SendPipeline::start_ready(const std::shared_ptr<State>& state, std::size_t max_in_flight,
+                               const StartSend& start_send) {
+  std::unique_lock<std::mutex> lock(state->mutex);
+  // The completions running inline, or on other threads while a send is starting, return here and
+  // the loop of the outermost call starts their ready sends, keeping the stack depth constant
+  if (state->starting) {
+    return;
+  }
+  state->starting = true;
+  while (!state->ready.empty() && (state->in_flight < max_in_flight)) {
+    const std::size_t index = state->ready.front();
+    state->ready.pop_front();
+    state->in_flight++;
+    // The send might complete inline, never start it while holding the lock
+    lock.unlock();
+    start_send(index, [state, index, max_in_flight, start_send](const grpc::Status& status) {
+      {
+        const std::lock_guard<std::mutex> done_lock(state->mutex);
+        state->statuses[index] = status;
+        state->in_flight--;
+        state->completed++;
+        if (!state->keys.empty()) {
+          std::deque<std::size_t>& queue = state->queues[state->keys[index]];
+          queue.pop_front();
+          if (!queue.empty()) {
+            state->ready.push_back(queue.front());
+          }
+        }
+        if (state->completed == state->total) {
+          state->done_cv.notify_all();
+          return;
+        }
+      }
+      start_ready(state, max_in_flight, start_send);
+    });
+    lock.lock();
+  }
+  state->starting = false;
+}
+
+}  // namespace AstarteDeviceSdk
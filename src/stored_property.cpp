@@ -5,6 +5,7 @@
 #include "astarte_device_sdk/stored_property.hpp"
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -17,14 +18,23 @@ namespace AstarteDeviceSdk {
 AstarteStoredProperty::AstarteStoredProperty(std::string_view interface_name, std::string_view path,
                                              int32_t version_major, AstarteOwnership ownership,
                                              AstarteData data)
-    : interface_name_(interface_name),
+    : interface_name_(std::make_shared<const std::string>(interface_name)),
+      path_(path),
+      version_major_(version_major),
+      ownership_(ownership),
+      data_(std::move(data)) {}
+
+AstarteStoredProperty::AstarteStoredProperty(std::shared_ptr<const std::string> interface_name,
+                                             std::string_view path, int32_t version_major,
+                                             AstarteOwnership ownership, AstarteData data)
+    : interface_name_(std::move(interface_name)),
       path_(path),
       version_major_(version_major),
       ownership_(ownership),
       data_(std::move(data)) {}
 
 auto AstarteStoredProperty::get_interface_name() const -> const std::string& {
-  return interface_name_;
+  return *interface_name_;
 }
 
 auto AstarteStoredProperty::get_path() const -> const std::string& { return path_; }
@@ -36,7 +46,7 @@ auto AstarteStoredProperty::get_ownership() const -> const AstarteOwnership& { r
 auto AstarteStoredProperty::get_value() const -> const AstarteData& { return data_; }
 
 auto AstarteStoredProperty::operator==(const AstarteStoredProperty& other) const -> bool {
-  return (interface_name_ == other.interface_name_) && (path_ == other.path_) &&
+  return (*interface_name_ == *other.interface_name_) && (path_ == other.path_) &&
          (version_major_ == other.version_major_) && (ownership_ == other.ownership_) &&
          (data_ == other.data_);
 }
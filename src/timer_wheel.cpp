@@ -0,0 +1,97 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "timer_wheel.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace AstarteDeviceSdk {
+
+TimerWheel::TimerWheel(std::chrono::milliseconds tick, std::size_t slots)
+    : tick_(std::max(tick, std::chrono::milliseconds(1))),
+      slots_(std::max<std::size_t>(slots, 1)) {}
+
+TimerWheel::~TimerWheel() {
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  cv_.notify_all();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+auto TimerWheel::shared() -> TimerWheel& {
+  // 10ms ticks and a turn of about 5s suit windows from tens of milliseconds to a few seconds
+  static TimerWheel wheel(std::chrono::milliseconds(10), 512);
+  return wheel;
+}
+
+void TimerWheel::schedule(std::chrono::milliseconds delay, Callback callback) {
+  {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    const auto now = std::chrono::steady_clock::now();
+    if (pending_ == 0) {
+      // The wheel was idle, start counting the ticks from now
+      next_tick_ = now + tick_;
+    }
+    // The current tick may be almost over, so the ticks are counted from the next one
+    const std::chrono::nanoseconds after_next_tick =
+        std::max<std::chrono::nanoseconds>(delay - (next_tick_ - now), std::chrono::nanoseconds(0));
+    const auto ticks = static_cast<uint64_t>(
+        1 + ((after_next_tick + tick_ - std::chrono::nanoseconds(1)) / tick_));
+    const std::size_t slot = (cursor_ + ticks) % slots_.size();
+    slots_[slot].push_back(Timer{(ticks - 1) / slots_.size(), std::move(callback)});
+    pending_++;
+    if (!thread_.joinable()) {
+      thread_ = std::thread(&TimerWheel::run, this);
+    }
+  }
+  cv_.notify_one();
+}
+
+void TimerWheel::run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (!stopping_) {
+    if (pending_ == 0) {
+      cv_.wait(lock, [this] { return stopping_ || (pending_ != 0); });
+      continue;
+    }
+    if (cv_.wait_until(lock, next_tick_, [this] { return stopping_; })) {
+      break;
+    }
+
+    cursor_ = (cursor_ + 1) % slots_.size();
+    next_tick_ += tick_;
+    std::vector<Timer> expired;
+    std::vector<Timer> waiting;
+    for (Timer& timer : slots_[cursor_]) {
+      if (timer.rounds == 0) {
+        expired.push_back(std::move(timer));
+      } else {
+        timer.rounds--;
+        waiting.push_back(std::move(timer));
+      }
+    }
+    slots_[cursor_] = std::move(waiting);
+    pending_ -= expired.size();
+
+    // Callbacks may schedule other timers
+    lock.unlock();
+    for (Timer& timer : expired) {
+      timer.callback();
+    }
+    lock.lock();
+  }
+}
+
+}  // namespace AstarteDeviceSdk
@@ -0,0 +1,246 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <astarteplatform/msghub/astarte_data.pb.h>
+#include <astarteplatform/msghub/astarte_message.pb.h>
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+
+#include "allocation_counter.hpp"
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/device_grpc.hpp"
+#include "astarte_device_sdk/msg.hpp"
+#include "astarte_device_sdk/object.hpp"
+#include "fake_message_hub.hpp"
+#include "grpc_converter.hpp"
+
+using AstarteDeviceSdk::AllocationCount;
+using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::AstarteDatastreamObject;
+using AstarteDeviceSdk::AstarteDeviceGRPC;
+using AstarteDeviceSdk::AstarteMessage;
+using AstarteDeviceSdk::FakeMessageHub;
+using AstarteDeviceSdk::FakeMessageHubServer;
+using AstarteDeviceSdk::GrpcConverterFrom;
+using AstarteDeviceSdk::GrpcConverterTo;
+using AstarteDeviceSdk::process_allocations;
+using AstarteDeviceSdk::set_process_allocation_counting;
+using AstarteDeviceSdk::ThreadAllocationScope;
+
+namespace {
+
+const char* const DATASTREAM = "org.astarte-platform.test.DeviceDatastream";
+const char* const OBJECT = "org.astarte-platform.test.DeviceAggregate";
+const char* const PROPERTY = "org.astarte-platform.test.DeviceProperty";
+const char* const SERVER_DATASTREAM = "org.astarte-platform.test.ServerDatastream";
+
+// The budgets are the allocations measured with gRPC 1.51 plus some headroom, since the gRPC
+// internals allocate differently across versions. Lower them when an allocation is removed.
+constexpr int WARMUP_CALLS = 20;
+constexpr int MEASURED_CALLS = 200;
+
+// Allocations of a single call, averaged over many calls
+struct PerCall {
+  double allocations;
+  double bytes;
+};
+
+auto average(const AllocationCount& count) -> PerCall {
+  return {.allocations = static_cast<double>(count.allocations) / MEASURED_CALLS,
+          .bytes = static_cast<double>(count.bytes) / MEASURED_CALLS};
+}
+
+// Allocations made by the calling thread, the only ones that are deterministic
+auto measure_thread(const std::function<void(int)>& call) -> PerCall {
+  for (int index = 0; index < WARMUP_CALLS; index++) {
+    call(index);
+  }
+  const ThreadAllocationScope scope;
+  for (int index = 0; index < MEASURED_CALLS; index++) {
+    call(WARMUP_CALLS + index);
+  }
+  return average(scope.get());
+}
+
+// Allocations made by all the threads, including the gRPC ones and the fake message hub
+auto measure_process(const std::function<void(int)>& call) -> PerCall {
+  for (int index = 0; index < WARMUP_CALLS; index++) {
+    call(index);
+  }
+  set_process_allocation_counting(true);
+  const AllocationCount start = process_allocations();
+  for (int index = 0; index < MEASURED_CALLS; index++) {
+    call(WARMUP_CALLS + index);
+  }
+  const AllocationCount end = process_allocations();
+  set_process_allocation_counting(false);
+  return average(end - start);
+}
+
+// Reports the measure in the test output and in the XML report, then checks the budget
+void check_budget(const char* name, const PerCall& measured, double budget) {
+  testing::Test::RecordProperty(std::string(name) + "_allocations",
+                                std::to_string(measured.allocations));
+  testing::Test::RecordProperty(std::string(name) + "_bytes", std::to_string(measured.bytes));
+  std::printf("[ ALLOCS   ] %s: %.1f allocations, %.0f bytes per call\n", name,
+              measured.allocations, measured.bytes);
+  EXPECT_LE(measured.allocations, budget) << name << " exceeds its allocation budget.";
+}
+
+auto server_event(int sequence) -> FakeMessageHub::Event {
+  FakeMessageHub::Event event;
+  astarteplatform::msghub::AstarteMessage* message = event.mutable_message();
+  message->set_interface_name(SERVER_DATASTREAM);
+  message->set_path("/sensor/value");
+  message->mutable_datastream_individual()->mutable_data()->set_integer(sequence);
+  return event;
+}
+
+// A single device is shared by the whole suite, the measures are not affected by its state
+class AstarteTestAllocationBudget : public testing::Test {
+ protected:
+  static void SetUpTestSuite() {
+    spdlog::set_level(spdlog::level::warn);
+    server_ = std::make_unique<FakeMessageHubServer>();
+    device_ = std::make_unique<AstarteDeviceGRPC>(server_->get_address(), "allocation-node");
+    device_->connect();
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!device_->is_connected() && (std::chrono::steady_clock::now() < deadline)) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+  }
+
+  static void TearDownTestSuite() {
+    device_->disconnect();
+    device_.reset();
+    server_.reset();
+  }
+
+  void SetUp() override { ASSERT_TRUE(device_->is_connected()); }
+
+  static std::unique_ptr<FakeMessageHubServer> server_;
+  static std::unique_ptr<AstarteDeviceGRPC> device_;
+};
+
+std::unique_ptr<FakeMessageHubServer> AstarteTestAllocationBudget::server_;
+std::unique_ptr<AstarteDeviceGRPC> AstarteTestAllocationBudget::device_;
+
+}  // namespace
+
+TEST(AstarteTestAllocationCounter, CountsThreadAllocations) {
+  const ThreadAllocationScope scope;
+  auto value = std::make_unique<std::array<char, 100>>();
+  EXPECT_EQ(scope.get().allocations, 1);
+  EXPECT_GE(scope.get().bytes, 100);
+}
+
+TEST(AstarteTestAllocationCounter, IgnoresOtherThreads) {
+  const ThreadAllocationScope scope;
+  std::thread([] { auto value = std::make_unique<std::string>(100000, 'a'); }).join();
+  // Starting the thread allocates its state on this thread, the string is not counted
+  EXPECT_LT(scope.get().bytes, 100000);
+}
+
+TEST(AstarteTestConversionAllocations, IndividualToGrpc) {
+  const AstarteData data(23.5);
+  const PerCall measured = measure_thread([&data](int /*index*/) {
+    GrpcConverterTo converter;
+    auto converted = converter(data);
+  });
+  check_budget("GrpcConverterTo(AstarteData)", measured, 2);
+}
+
+TEST(AstarteTestConversionAllocations, MessageFromGrpc) {
+  const FakeMessageHub::Event event = server_event(1);
+  const PerCall measured = measure_thread([&event](int /*index*/) {
+    AstarteMessage message = GrpcConverterFrom{}(event.message());
+  });
+  check_budget("GrpcConverterFrom(AstarteMessage)", measured, 2);
+}
+
+TEST_F(AstarteTestAllocationBudget, SendIndividual) {
+  auto call = [](int index) {
+    device_->send_individual(DATASTREAM, "/sensor/value", AstarteData(static_cast<double>(index)),
+                             nullptr);
+  };
+  check_budget("send_individual", measure_thread(call), 32);
+  check_budget("send_individual (process)", measure_process(call), 64);
+}
+
+TEST_F(AstarteTestAllocationBudget, SendObject) {
+  auto call = [](int index) {
+    const AstarteDatastreamObject object = {{"temperature", AstarteData(21.5)},
+                                            {"humidity", AstarteData(48.0)},
+                                            {"sequence", AstarteData(index)}};
+    device_->send_object(OBJECT, "/sensor", object, nullptr);
+  };
+  check_budget("send_object", measure_thread(call), 45);
+  check_budget("send_object (process)", measure_process(call), 80);
+}
+
+TEST_F(AstarteTestAllocationBudget, SetProperty) {
+  auto call = [](int index) {
+    device_->set_property(PROPERTY, "/sensor/counter", AstarteData(index));
+  };
+  check_budget("set_property", measure_thread(call), 32);
+  check_budget("set_property (process)", measure_process(call), 70);
+}
+
+TEST_F(AstarteTestAllocationBudget, UnsetProperty) {
+  auto call = [](int /*index*/) { device_->unset_property(PROPERTY, "/sensor/counter"); };
+  check_budget("unset_property", measure_thread(call), 32);
+}
+
+TEST_F(AstarteTestAllocationBudget, GetProperty) {
+  device_->set_property(PROPERTY, "/sensor/counter", AstarteData(1));
+  auto call = [](int /*index*/) {
+    auto property = device_->get_property(PROPERTY, "/sensor/counter");
+  };
+  check_budget("get_property", measure_thread(call), 18);
+}
+
+TEST_F(AstarteTestAllocationBudget, GetProperties) {
+  for (int index = 0; index < 10; index++) {
+    device_->set_property(PROPERTY, "/sensor" + std::to_string(index) + "/counter",
+                          AstarteData(index));
+  }
+  auto call = [](int /*index*/) { auto properties = device_->get_properties(PROPERTY); };
+  check_budget("get_properties (10 properties)", measure_thread(call), 130);
+}
+
+TEST_F(AstarteTestAllocationBudget, GetAllProperties) {
+  for (int index = 0; index < 10; index++) {
+    device_->set_property(PROPERTY, "/sensor" + std::to_string(index) + "/counter",
+                          AstarteData(index));
+  }
+  auto call = [](int /*index*/) { auto properties = device_->get_all_properties({}); };
+  check_budget("get_all_properties (10 properties)", measure_thread(call), 130);
+}
+
+// The events are decoded on a gRPC thread, only the process wide count covers them
+TEST_F(AstarteTestAllocationBudget, ReceiveEvent) {
+  // A device that stops receiving fails the test instead of hanging it
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+  int missed = 0;
+  auto call = [&deadline, &missed](int index) {
+    server_->hub().push_event(server_event(index));
+    std::optional<AstarteMessage> message;
+    while (!message.has_value() && (std::chrono::steady_clock::now() < deadline)) {
+      message = device_->poll_incoming(std::chrono::milliseconds(100));
+    }
+    missed += message.has_value() ? 0 : 1;
+  };
+  check_budget("poll_incoming (process)", measure_process(call), 40);
+  EXPECT_EQ(missed, 0) << "The device stopped receiving the events.";
+}
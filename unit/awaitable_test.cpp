@@ -0,0 +1,75 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "astarte_device_sdk/awaitable.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+#include "astarte_device_sdk/exceptions.hpp"
+
+using AstarteDeviceSdk::AstarteAsyncState;
+using AstarteDeviceSdk::AstarteAwaitable;
+using AstarteDeviceSdk::AstarteOperationRefusedException;
+
+namespace {
+
+// Minimal eagerly started coroutine type, used to await the results
+struct Task {
+  struct promise_type {
+    auto get_return_object() -> Task { return {}; }
+    auto initial_suspend() -> std::suspend_never { return {}; }
+    auto final_suspend() noexcept -> std::suspend_never { return {}; }
+    void return_void() {}
+    void unhandled_exception() { std::terminate(); }
+  };
+};
+
+auto await_value(AstarteAwaitable<std::string> awaitable, std::optional<std::string>& result)
+    -> Task {
+  result = co_await awaitable;
+}
+
+auto await_error(AstarteAwaitable<void> awaitable, std::optional<std::string>& error) -> Task {
+  try {
+    co_await awaitable;
+  } catch (const AstarteOperationRefusedException& e) {
+    error = e.what();
+  }
+}
+
+}  // namespace
+
+TEST(AstarteTestAwaitable, CompletedBeforeAwait) {
+  auto state = std::make_shared<AstarteAsyncState<std::string>>();
+  state->set_value("ready");
+  std::optional<std::string> result;
+  await_value(AstarteAwaitable<std::string>(state), result);
+  EXPECT_EQ(result, "ready");
+}
+
+TEST(AstarteTestAwaitable, CompletedAfterAwait) {
+  auto state = std::make_shared<AstarteAsyncState<std::string>>();
+  std::optional<std::string> result;
+  await_value(AstarteAwaitable<std::string>(state), result);
+  EXPECT_EQ(result, std::nullopt);
+  state->set_value("resumed");
+  EXPECT_EQ(result, "resumed");
+}
+
+TEST(AstarteTestAwaitable, CompletedWithError) {
+  auto state = std::make_shared<AstarteAsyncState<void>>();
+  std::optional<std::string> error;
+  await_error(AstarteAwaitable<void>(state), error);
+  EXPECT_EQ(error, std::nullopt);
+  state->set_exception(std::make_exception_ptr(AstarteOperationRefusedException("refused")));
+  EXPECT_EQ(error, "refused");
+}
@@ -0,0 +1,153 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "astarte_device_sdk/base64.hpp"
+#include "astarte_device_sdk/exceptions.hpp"
+#include "base64_kernels.hpp"
+
+using AstarteDeviceSdk::AstarteInvalidInputException;
+using AstarteDeviceSdk::base64_decode;
+using AstarteDeviceSdk::base64_encode;
+using AstarteDeviceSdk::base64_implementation;
+using AstarteDeviceSdk::base64_scalar_kernels;
+using AstarteDeviceSdk::base64_supported_kernels;
+using AstarteDeviceSdk::Base64Kernels;
+
+namespace {
+
+constexpr std::string_view ALPHABET =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+    "abcdefghijklmnopqrstuvwxyz"
+    "0123456789+/";
+
+auto random_bytes(std::size_t size) -> std::vector<uint8_t> {
+  static std::mt19937 generator(42);
+  std::uniform_int_distribution<unsigned> distribution(0, 255);
+  std::vector<uint8_t> data(size);
+  for (uint8_t& byte : data) {
+    byte = static_cast<uint8_t>(distribution(generator));
+  }
+  return data;
+}
+
+auto to_bytes(std::string_view text) -> std::vector<uint8_t> {
+  return {text.begin(), text.end()};
+}
+
+}  // namespace
+
+TEST(AstarteTestBase64, KnownValues) {
+  const std::vector<std::pair<std::string_view, std::string_view>> values = {
+      {"", ""},
+      {"f", "Zg=="},
+      {"fo", "Zm8="},
+      {"foo", "Zm9v"},
+      {"foob", "Zm9vYg=="},
+      {"fooba", "Zm9vYmE="},
+      {"foobar", "Zm9vYmFy"},
+      {"\xFF\xFE", "//4="}};
+  for (const auto& [bytes, text] : values) {
+    EXPECT_EQ(base64_encode(to_bytes(bytes)), text);
+    EXPECT_EQ(base64_decode(text), to_bytes(bytes));
+  }
+}
+
+TEST(AstarteTestBase64, EncodeAppends) {
+  std::string out = "blob:";
+  base64_encode(to_bytes("foo"), out);
+  EXPECT_EQ(out, "blob:Zm9v");
+}
+
+TEST(AstarteTestBase64, RoundTrip) {
+  for (std::size_t size = 0; size < 300; size++) {
+    const std::vector<uint8_t> data = random_bytes(size);
+    const std::string text = base64_encode(data);
+    ASSERT_EQ(text.size(), AstarteDeviceSdk::base64_encoded_size(size));
+    ASSERT_EQ(base64_decode(text), data) << "size " << size;
+  }
+  const std::vector<uint8_t> large = random_bytes((1 << 20) + 1);
+  EXPECT_EQ(base64_decode(base64_encode(large)), large);
+}
+
+TEST(AstarteTestBase64, KernelsMatchScalar) {
+  const Base64Kernels& scalar = base64_scalar_kernels();
+  for (const Base64Kernels* kernels : base64_supported_kernels()) {
+    for (std::size_t size = 0; size < 400; size += 3) {
+      const std::vector<uint8_t> data = random_bytes(size);
+      std::string expected(AstarteDeviceSdk::base64_encoded_size(size), '\0');
+      ASSERT_EQ(scalar.encode(data, expected.data()), size);
+
+      std::string text(expected.size(), '\0');
+      const std::size_t encoded = kernels->encode(data, text.data());
+      ASSERT_EQ(encoded % 3, 0) << kernels->name;
+      ASSERT_LE(encoded, size) << kernels->name;
+      // The kernels leave at most one of their steps to the scalar code
+      ASSERT_GE(encoded + 64, size) << kernels->name;
+      EXPECT_EQ(text.substr(0, encoded / 3 * 4), expected.substr(0, encoded / 3 * 4))
+          << kernels->name << " size " << size;
+
+      std::vector<uint8_t> bytes(size);
+      const std::size_t decoded = kernels->decode(expected, bytes.data());
+      ASSERT_EQ(decoded % 4, 0) << kernels->name;
+      ASSERT_LE(decoded, expected.size()) << kernels->name;
+      ASSERT_GE(decoded + 64, expected.size()) << kernels->name;
+      bytes.resize(decoded / 4 * 3);
+      EXPECT_EQ(bytes, std::vector<uint8_t>(data.begin(), data.begin() + (decoded / 4 * 3)))
+          << kernels->name << " size " << size;
+    }
+  }
+}
+
+TEST(AstarteTestBase64, KernelsStopBeforeInvalidCharacters) {
+  const std::string valid = base64_encode(random_bytes(192));
+  for (const Base64Kernels* kernels : base64_supported_kernels()) {
+    for (std::size_t position = 0; position < valid.size(); position++) {
+      for (unsigned value = 0; value < 256; value++) {
+        if (ALPHABET.find(static_cast<char>(value)) != std::string_view::npos) {
+          continue;
+        }
+        std::string text = valid;
+        text[position] = static_cast<char>(value);
+        std::vector<uint8_t> bytes(192);
+        ASSERT_LE(kernels->decode(text, bytes.data()), position / 4 * 4)
+            << kernels->name << " position " << position << " value " << value;
+      }
+    }
+  }
+}
+
+TEST(AstarteTestBase64, RejectsInvalidText) {
+  const std::string valid = base64_encode(random_bytes(96));
+  for (std::size_t position = 0; position < valid.size(); position++) {
+    for (unsigned value = 0; value < 256; value++) {
+      const bool padding = (value == '=') && (position == valid.size() - 1);
+      if (padding || (ALPHABET.find(static_cast<char>(value)) != std::string_view::npos)) {
+        continue;
+      }
+      std::string text = valid;
+      text[position] = static_cast<char>(value);
+      EXPECT_THROW(base64_decode(text), AstarteInvalidInputException)
+          << "position " << position << " value " << value;
+    }
+  }
+  EXPECT_THROW(base64_decode("Zg="), AstarteInvalidInputException);
+  EXPECT_THROW(base64_decode("Z==="), AstarteInvalidInputException);
+  EXPECT_THROW(base64_decode("===="), AstarteInvalidInputException);
+  EXPECT_THROW(base64_decode("Zg==Zg=="), AstarteInvalidInputException);
+  EXPECT_THROW(base64_decode("Zm9v\nYmF"), AstarteInvalidInputException);
+}
+
+TEST(AstarteTestBase64, UsesTheFastestKernels) {
+  EXPECT_EQ(base64_implementation(), base64_supported_kernels().back()->name);
+}
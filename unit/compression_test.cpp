@@ -0,0 +1,45 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "astarte_device_sdk/compression.hpp"
+
+#include <grpc/compression.h>
+#include <gtest/gtest.h>
+
+#include "astarte_device_sdk/hub_connection.hpp"
+#include "hub_connection_impl.hpp"
+
+using AstarteDeviceSdk::AstarteCompression;
+using AstarteDeviceSdk::AstarteHubConnection;
+using AstarteDeviceSdk::get_message_compression;
+
+TEST(AstarteTestCompression, ConnectionSettings) {
+  const AstarteHubConnection compressed(
+      "localhost:50051",
+      AstarteCompression(AstarteCompression::Algorithm::kGzip).with_min_size(256));
+  EXPECT_EQ(compressed.get_compression().get_algorithm(), AstarteCompression::Algorithm::kGzip);
+  EXPECT_EQ(compressed.get_compression().get_min_size(), 256);
+
+  const AstarteHubConnection uncompressed("localhost:50051");
+  EXPECT_EQ(uncompressed.get_compression().get_algorithm(), AstarteCompression::Algorithm::kNone);
+  EXPECT_EQ(uncompressed.get_compression().get_min_size(), AstarteCompression::DEFAULT_MIN_SIZE);
+}
+
+TEST(AstarteTestCompression, MessageCompressionThreshold) {
+  const AstarteCompression gzip =
+      AstarteCompression(AstarteCompression::Algorithm::kGzip).with_min_size(256);
+  EXPECT_EQ(get_message_compression(gzip, 0), GRPC_COMPRESS_NONE);
+  EXPECT_EQ(get_message_compression(gzip, 255), GRPC_COMPRESS_NONE);
+  EXPECT_EQ(get_message_compression(gzip, 256), GRPC_COMPRESS_GZIP);
+  EXPECT_EQ(get_message_compression(gzip, 4096), GRPC_COMPRESS_GZIP);
+
+  const AstarteCompression deflate =
+      AstarteCompression(AstarteCompression::Algorithm::kDeflate).with_min_size(64);
+  EXPECT_EQ(get_message_compression(deflate, 63), GRPC_COMPRESS_NONE);
+  EXPECT_EQ(get_message_compression(deflate, 64), GRPC_COMPRESS_DEFLATE);
+
+  // Without an algorithm nothing is compressed, whatever the size
+  const AstarteCompression none(AstarteCompression::Algorithm::kNone);
+  EXPECT_EQ(get_message_compression(none, 1 << 20), GRPC_COMPRESS_NONE);
+}
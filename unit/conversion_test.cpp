@@ -3,15 +3,34 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <gmock/gmock.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/text_format.h>
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <span>
+#include <string>
+#include <vector>
+
 #include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/exceptions.hpp"
+#include "astarte_device_sdk/ownership.hpp"
+#include "astarte_device_sdk/stored_property.hpp"
 #include "grpc_converter.hpp"
+#include "grpc_formatter.hpp"
 
 using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::AstarteInvalidInputException;
+using AstarteDeviceSdk::AstarteOwnership;
+using AstarteDeviceSdk::AstarteStoredProperty;
+using AstarteDeviceSdk::encode_series;
 using AstarteDeviceSdk::gRPCAstarteData;
+using AstarteDeviceSdk::gRPCAstarteMessage;
 using AstarteDeviceSdk::GrpcConverterFrom;
 using AstarteDeviceSdk::GrpcConverterTo;
+using AstarteDeviceSdk::gRPCStoredProperties;
+using AstarteDeviceSdk::ProtobufText;
+using AstarteDeviceSdk::StoredPropertiesDecoder;
 
 TEST(AstarteTestConversion, DataToGRPC) {
   int32_t value = 199;
@@ -24,3 +43,64 @@ TEST(AstarteTestConversion, DataToGRPC) {
   AstarteData original = converter(*grpc_individual);
   EXPECT_EQ(original.into<int32_t>(), value);
 }
+
+TEST(AstarteTestConversion, StoredPropertiesFromGRPC) {
+  gRPCStoredProperties grpc_properties;
+  for (int32_t value = 0; value < 3; value++) {
+    auto* grpc_property = grpc_properties.add_properties();
+    grpc_property->set_interface_name("org.astarte-platform.test.DeviceProperty");
+    grpc_property->set_path("/" + std::to_string(value) + "/rate");
+    grpc_property->set_version_major(1);
+    grpc_property->set_ownership(astarteplatform::msghub::Ownership::DEVICE);
+    grpc_property->set_allocated_data(GrpcConverterTo()(value).release());
+  }
+
+  std::vector<AstarteStoredProperty> properties =
+      StoredPropertiesDecoder(grpc_properties).to_vector();
+  ASSERT_EQ(properties.size(), 3);
+  EXPECT_EQ(properties[2], AstarteStoredProperty("org.astarte-platform.test.DeviceProperty",
+                                                 "/2/rate", 1, AstarteOwnership::kDevice,
+                                                 AstarteData(2)));
+  // The interface name is decoded once and shared
+  EXPECT_EQ(&properties[0].get_interface_name(), &properties[1].get_interface_name());
+  EXPECT_EQ(GrpcConverterFrom()(grpc_properties).size(), 3);
+}
+
+TEST(AstarteTestConversion, SeriesToGRPC) {
+  using std::chrono::system_clock;
+  const std::vector<double> values{1.5, -2.0, 3.25};
+  const std::vector<system_clock::time_point> timestamps{
+      system_clock::time_point(std::chrono::milliseconds(1700000000123)),
+      system_clock::time_point(std::chrono::seconds(1700000001)),
+      // Before the epoch, the nanoseconds must stay positive
+      system_clock::time_point(std::chrono::milliseconds(-1500))};
+
+  google::protobuf::Arena arena;
+  const std::vector<gRPCAstarteMessage*> messages = encode_series<double>(
+      arena, "org.astarte-platform.test.Sensors", "/1/value", values, timestamps);
+  ASSERT_EQ(messages.size(), 3);
+  EXPECT_EQ(messages[0]->interface_name(), "org.astarte-platform.test.Sensors");
+  EXPECT_EQ(messages[0]->path(), "/1/value");
+  EXPECT_EQ(messages[1]->datastream_individual().data().astarte_data_case(),
+            gRPCAstarteData::kDouble);
+  EXPECT_EQ(GrpcConverterFrom()(messages[1]->datastream_individual()).get_value(),
+            AstarteData(-2.0));
+  EXPECT_EQ(messages[0]->datastream_individual().timestamp().seconds(), 1700000000);
+  EXPECT_EQ(messages[0]->datastream_individual().timestamp().nanos(), 123000000);
+  EXPECT_EQ(messages[2]->datastream_individual().timestamp().seconds(), -2);
+  EXPECT_EQ(messages[2]->datastream_individual().timestamp().nanos(), 500000000);
+
+  const std::vector<int32_t> integers{1, 2};
+  EXPECT_THROW(encode_series<int32_t>(arena, "org.astarte-platform.test.Sensors", "/1/value",
+                                      integers, timestamps),
+               AstarteInvalidInputException);
+}
+
+TEST(AstarteTestConversion, ProtobufTextFormat) {
+  gRPCAstarteData grpc_data;
+  grpc_data.set_integer(42);
+  std::string expected;
+  google::protobuf::TextFormat::PrintToString(grpc_data, &expected);
+  EXPECT_EQ(ASTARTE_NS_FORMAT::format("{}", ProtobufText(grpc_data)), expected);
+  EXPECT_EQ(ProtobufText(grpc_data).to_string(), "integer: 42\n");
+}
@@ -0,0 +1,208 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "datastream_aggregator.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/datastream_aggregation.hpp"
+#include "astarte_device_sdk/object.hpp"
+#include "timer_wheel.hpp"
+
+using AstarteDeviceSdk::AggregatedObject;
+using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::AstarteDatastreamAggregation;
+using AstarteDeviceSdk::AstarteDatastreamObject;
+using AstarteDeviceSdk::DatastreamAggregator;
+using AstarteDeviceSdk::TimerWheel;
+using std::chrono::system_clock;
+
+namespace {
+
+const std::string INTERFACE = "org.astarte-platform.test.Sensors";
+const std::string OBJECT_INTERFACE = "org.astarte-platform.test.SensorsAggregate";
+const system_clock::time_point START(std::chrono::seconds(1700000000));
+
+}  // namespace
+
+TEST(AstarteTestDatastreamAggregator, TimerWheelExpiresInOrder) {
+  TimerWheel wheel(std::chrono::milliseconds(1), 4);
+  std::mutex mutex;
+  std::vector<int> fired;
+  std::promise<void> done;
+  // Longer than a full turn of the wheel
+  wheel.schedule(std::chrono::milliseconds(12), [&] {
+    const std::lock_guard<std::mutex> lock(mutex);
+    fired.push_back(3);
+    done.set_value();
+  });
+  wheel.schedule(std::chrono::milliseconds(2), [&] {
+    const std::lock_guard<std::mutex> lock(mutex);
+    fired.push_back(1);
+  });
+  wheel.schedule(std::chrono::milliseconds(6), [&] {
+    const std::lock_guard<std::mutex> lock(mutex);
+    fired.push_back(2);
+  });
+
+  ASSERT_EQ(done.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+  const std::lock_guard<std::mutex> lock(mutex);
+  EXPECT_THAT(fired, testing::ElementsAre(1, 2, 3));
+}
+
+TEST(AstarteTestDatastreamAggregator, TimerWheelNeverFiresEarly) {
+  constexpr int TIMERS = 20;
+  TimerWheel wheel(std::chrono::milliseconds(10), 8);
+  std::mutex mutex;
+  std::vector<std::chrono::steady_clock::duration> early;
+  std::atomic<int> fired{0};
+  std::promise<void> done;
+  for (int index = 0; index < TIMERS; index++) {
+    // Scheduled at different points of the current tick
+    const std::chrono::milliseconds delay(10 + ((index * 7) % 30));
+    const auto scheduled = std::chrono::steady_clock::now();
+    wheel.schedule(delay, [&, delay, scheduled] {
+      const auto elapsed = std::chrono::steady_clock::now() - scheduled;
+      const std::lock_guard<std::mutex> lock(mutex);
+      if (elapsed < delay) {
+        early.push_back(delay - elapsed);
+      }
+      if (++fired == TIMERS) {
+        done.set_value();
+      }
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(3));
+  }
+
+  ASSERT_EQ(done.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+  const std::lock_guard<std::mutex> lock(mutex);
+  EXPECT_TRUE(early.empty()) << early.size() << " timers fired early";
+}
+
+TEST(AstarteTestDatastreamAggregator, CompleteAndRepeatedFields) {
+  TimerWheel wheel(std::chrono::milliseconds(10), 16);
+  auto aggregator = std::make_shared<DatastreamAggregator>(wheel, [](AggregatedObject) {});
+  aggregator->set_aggregation(INTERFACE,
+                              AstarteDatastreamAggregation(OBJECT_INTERFACE, std::chrono::hours(1))
+                                  .with_fields({"temperature", "humidity"}));
+
+  std::vector<AggregatedObject> ready;
+  // Interfaces without aggregation are sent as they are
+  EXPECT_FALSE(aggregator->aggregate("org.astarte-platform.test.Other", "/1/temperature",
+                                     AstarteData(20.0), nullptr, ready));
+  EXPECT_TRUE(
+      aggregator->aggregate(INTERFACE, "/1/temperature", AstarteData(20.0), &START, ready));
+  EXPECT_TRUE(ready.empty());
+  EXPECT_TRUE(
+      aggregator->aggregate(INTERFACE, "/2/temperature", AstarteData(30.0), nullptr, ready));
+  EXPECT_TRUE(aggregator->aggregate(INTERFACE, "/1/humidity", AstarteData(40.0), nullptr, ready));
+  ASSERT_EQ(ready.size(), 1);
+  EXPECT_EQ(ready.front().interface_name, OBJECT_INTERFACE);
+  EXPECT_EQ(ready.front().path, "/1");
+  EXPECT_EQ(ready.front().object, AstarteDatastreamObject({{"temperature", AstarteData(20.0)},
+                                                           {"humidity", AstarteData(40.0)}}));
+  EXPECT_EQ(ready.front().timestamp, START);
+
+  // A repeated field sends the incomplete window and starts a new one
+  ready.clear();
+  EXPECT_TRUE(
+      aggregator->aggregate(INTERFACE, "/2/temperature", AstarteData(31.0), nullptr, ready));
+  ASSERT_EQ(ready.size(), 1);
+  EXPECT_EQ(ready.front().path, "/2");
+  EXPECT_EQ(ready.front().object, AstarteDatastreamObject({{"temperature", AstarteData(30.0)}}));
+  EXPECT_EQ(ready.front().timestamp, std::nullopt);
+
+  const std::vector<AggregatedObject> open = aggregator->remove_aggregation(INTERFACE);
+  ASSERT_EQ(open.size(), 1);
+  EXPECT_EQ(open.front().object, AstarteDatastreamObject({{"temperature", AstarteData(31.0)}}));
+  ready.clear();
+  EXPECT_FALSE(
+      aggregator->aggregate(INTERFACE, "/2/temperature", AstarteData(32.0), nullptr, ready));
+}
+
+TEST(AstarteTestDatastreamAggregator, RepeatedFieldCompletingTheNextWindow) {
+  TimerWheel wheel(std::chrono::milliseconds(10), 16);
+  auto aggregator = std::make_shared<DatastreamAggregator>(wheel, [](AggregatedObject) {});
+  aggregator->set_aggregation(
+      INTERFACE, AstarteDatastreamAggregation(OBJECT_INTERFACE, std::chrono::hours(1)));
+
+  std::vector<AggregatedObject> ready;
+  EXPECT_TRUE(aggregator->aggregate(INTERFACE, "/temperature", AstarteData(20.0), nullptr, ready));
+  // The open window keeps going with the new fields
+  aggregator->set_aggregation(INTERFACE,
+                              AstarteDatastreamAggregation(OBJECT_INTERFACE, std::chrono::hours(1))
+                                  .with_fields({"temperature"}));
+  EXPECT_TRUE(aggregator->aggregate(INTERFACE, "/temperature", AstarteData(21.0), nullptr, ready));
+
+  // Both the closed and the completed windows are sent right away
+  ASSERT_EQ(ready.size(), 2);
+  EXPECT_EQ(ready.front().object, AstarteDatastreamObject({{"temperature", AstarteData(20.0)}}));
+  EXPECT_EQ(ready.back().object, AstarteDatastreamObject({{"temperature", AstarteData(21.0)}}));
+  EXPECT_TRUE(aggregator->take_all().empty());
+}
+
+TEST(AstarteTestDatastreamAggregator, WindowExpiry) {
+  TimerWheel wheel(std::chrono::milliseconds(1), 16);
+  std::promise<AggregatedObject> flushed;
+  auto aggregator = std::make_shared<DatastreamAggregator>(
+      wheel, [&flushed](AggregatedObject object) { flushed.set_value(std::move(object)); });
+  aggregator->set_aggregation(
+      INTERFACE, AstarteDatastreamAggregation(OBJECT_INTERFACE, std::chrono::milliseconds(20)));
+
+  std::vector<AggregatedObject> ready;
+  EXPECT_TRUE(aggregator->aggregate(INTERFACE, "/temperature", AstarteData(20.0), nullptr, ready));
+  EXPECT_TRUE(aggregator->aggregate(INTERFACE, "/humidity", AstarteData(40.0), nullptr, ready));
+  EXPECT_TRUE(ready.empty());
+
+  std::future<AggregatedObject> future = flushed.get_future();
+  ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+  const AggregatedObject object = future.get();
+  EXPECT_EQ(object.path, "/");
+  EXPECT_EQ(object.object.size(), 2);
+  EXPECT_TRUE(aggregator->take_all().empty());
+  aggregator->close();
+}
+
+TEST(AstarteTestDatastreamAggregator, ManualExpiry) {
+  TimerWheel wheel(std::chrono::milliseconds(1), 16);
+  std::atomic<int> flushed{0};
+  auto aggregator = std::make_shared<DatastreamAggregator>(
+      wheel, [&flushed](AggregatedObject) { flushed++; });
+  aggregator->set_manual_expiry(true);
+  aggregator->set_aggregation(
+      INTERFACE, AstarteDatastreamAggregation(OBJECT_INTERFACE, std::chrono::milliseconds(5)));
+  EXPECT_FALSE(aggregator->get_next_deadline().has_value());
+
+  std::vector<AggregatedObject> ready;
+  const auto before = std::chrono::steady_clock::now();
+  EXPECT_TRUE(aggregator->aggregate(INTERFACE, "/temperature", AstarteData(20.0), nullptr, ready));
+  const std::optional<std::chrono::steady_clock::time_point> deadline =
+      aggregator->get_next_deadline();
+  ASSERT_TRUE(deadline.has_value());
+  EXPECT_GE(deadline.value(), before + std::chrono::milliseconds(5));
+  EXPECT_TRUE(aggregator->take_expired(before).empty());
+
+  // Well past the window, the wheel would have flushed it by now
+  std::this_thread::sleep_for(std::chrono::milliseconds(30));
+  EXPECT_EQ(flushed, 0);
+  const std::vector<AggregatedObject> expired =
+      aggregator->take_expired(std::chrono::steady_clock::now());
+  ASSERT_EQ(expired.size(), 1);
+  EXPECT_EQ(expired.front().object, AstarteDatastreamObject({{"temperature", AstarteData(20.0)}}));
+  EXPECT_FALSE(aggregator->get_next_deadline().has_value());
+  EXPECT_EQ(flushed, 0);
+  aggregator->close();
+}
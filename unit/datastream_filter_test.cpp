@@ -0,0 +1,107 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/datastream_filter.hpp"
+#include "astarte_device_sdk/object.hpp"
+#include "datastream_filter_table.hpp"
+
+using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::AstarteDatastreamFilter;
+using AstarteDeviceSdk::AstarteDatastreamObject;
+using AstarteDeviceSdk::DatastreamFilterTable;
+using std::chrono::system_clock;
+
+namespace {
+
+const std::string INTERFACE = "org.astarte-platform.test.Sensors";
+const system_clock::time_point START(std::chrono::seconds(1700000000));
+
+// Checks a sample, recording it as sent when admitted
+template <typename Sample>
+auto send(DatastreamFilterTable& table, const std::string& path, const Sample& sample,
+          const system_clock::time_point* timestamp) -> bool {
+  if (!table.admit(INTERFACE, path, sample, timestamp)) {
+    return false;
+  }
+  table.record(INTERFACE, path, sample, timestamp);
+  return true;
+}
+
+}  // namespace
+
+TEST(AstarteTestDatastreamFilter, AbsoluteDeadband) {
+  DatastreamFilterTable table;
+  table.set_filter(INTERFACE, "/temperature", AstarteDatastreamFilter::absolute_deadband(0.5));
+
+  EXPECT_TRUE(send(table, "/temperature", AstarteData(20.0), &START));
+  EXPECT_FALSE(send(table, "/temperature", AstarteData(20.4), &START));
+  EXPECT_FALSE(send(table, "/temperature", AstarteData(19.6), &START));
+  EXPECT_TRUE(send(table, "/temperature", AstarteData(20.6), &START));
+  // Compared against the last sent value, 20.6
+  EXPECT_FALSE(send(table, "/temperature", AstarteData(20.2), &START));
+  // Paths without filters are always admitted, and not counted
+  EXPECT_TRUE(send(table, "/humidity", AstarteData(40.0), &START));
+  EXPECT_TRUE(send(table, "/humidity", AstarteData(40.0), &START));
+
+  EXPECT_EQ(table.get_stats().sent, 2);
+  EXPECT_EQ(table.get_stats().filtered, 3);
+}
+
+TEST(AstarteTestDatastreamFilter, RelativeDeadbandAndHeartbeat) {
+  DatastreamFilterTable table;
+  table.set_filter(INTERFACE, "",
+                   AstarteDatastreamFilter::relative_deadband(0.1).with_max_silence(
+                       std::chrono::seconds(60)));
+
+  EXPECT_TRUE(send(table, "/power", AstarteData(int64_t{1000}), &START));
+  EXPECT_FALSE(send(table, "/power", AstarteData(int64_t{1090}), &START));
+  EXPECT_TRUE(send(table, "/power", AstarteData(int64_t{1200}), &START));
+  const system_clock::time_point later = START + std::chrono::seconds(30);
+  EXPECT_FALSE(send(table, "/power", AstarteData(int64_t{1200}), &later));
+  const system_clock::time_point silent = START + std::chrono::seconds(61);
+  EXPECT_TRUE(send(table, "/power", AstarteData(int64_t{1200}), &silent));
+
+  table.remove_filter(INTERFACE, "");
+  EXPECT_TRUE(send(table, "/power", AstarteData(int64_t{1200}), &silent));
+}
+
+TEST(AstarteTestDatastreamFilter, ChangeOnlyObjects) {
+  DatastreamFilterTable table;
+  table.set_filter(INTERFACE, "/status", AstarteDatastreamFilter::absolute_deadband(1.0));
+  const AstarteDatastreamObject first = {{"/state", AstarteData(std::string("running"))},
+                                         {"/load", AstarteData(50)}};
+  const AstarteDatastreamObject close = {{"/state", AstarteData(std::string("running"))},
+                                         {"/load", AstarteData(51)}};
+  const AstarteDatastreamObject changed = {{"/state", AstarteData(std::string("stopped"))},
+                                           {"/load", AstarteData(51)}};
+
+  EXPECT_TRUE(send(table, "/status", first, &START));
+  EXPECT_FALSE(send(table, "/status", close, &START));
+  // Strings are sent when they change, regardless of the deadband
+  EXPECT_TRUE(send(table, "/status", changed, &START));
+}
+
+TEST(AstarteTestDatastreamFilter, RecordsOnlySentSamples) {
+  DatastreamFilterTable table;
+  table.set_filter(INTERFACE, "", AstarteDatastreamFilter::change_only());
+
+  EXPECT_TRUE(send(table, "/state", AstarteData(1), &START));
+  // Admitted, but never sent
+  EXPECT_TRUE(table.admit(INTERFACE, "/state", AstarteData(2), &START));
+  EXPECT_TRUE(send(table, "/state", AstarteData(2), &START));
+  EXPECT_FALSE(send(table, "/state", AstarteData(2), &START));
+  // The samples of paths never checked are not recorded
+  table.record(INTERFACE, "/other", AstarteData(2), &START);
+  EXPECT_TRUE(send(table, "/other", AstarteData(2), &START));
+
+  EXPECT_EQ(table.get_stats().sent, 3);
+  EXPECT_EQ(table.get_stats().filtered, 1);
+}
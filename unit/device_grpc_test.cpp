@@ -0,0 +1,290 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <astarteplatform/msghub/astarte_data.pb.h>
+#include <astarteplatform/msghub/astarte_message.pb.h>
+#include <grpcpp/grpcpp.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/datastream_aggregation.hpp"
+#include "astarte_device_sdk/datastream_filter.hpp"
+#include "astarte_device_sdk/device_grpc.hpp"
+#include "astarte_device_sdk/individual.hpp"
+#include "astarte_device_sdk/msg.hpp"
+#include "astarte_device_sdk/property.hpp"
+#include "astarte_device_sdk/property_update.hpp"
+#include "astarte_device_sdk/rate_limit.hpp"
+#include "fake_message_hub.hpp"
+
+using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::AstarteDatastreamAggregation;
+using AstarteDeviceSdk::AstarteDatastreamFilter;
+using AstarteDeviceSdk::AstarteDatastreamIndividual;
+using AstarteDeviceSdk::AstarteDeviceGRPC;
+using AstarteDeviceSdk::AstarteMessage;
+using AstarteDeviceSdk::AstartePropertyIndividual;
+using AstarteDeviceSdk::AstartePropertyUpdate;
+using AstarteDeviceSdk::AstartePropertyUpdateStatus;
+using AstarteDeviceSdk::AstarteRateLimit;
+using AstarteDeviceSdk::FakeMessageHub;
+using AstarteDeviceSdk::FakeMessageHubServer;
+
+namespace {
+
+const char* const DEVICE_AGGREGATE = "org.astarte-platform.test.DeviceAggregate";
+const char* const DEVICE_DATASTREAM = "org.astarte-platform.test.DeviceDatastream";
+const char* const DEVICE_PROPERTY = "org.astarte-platform.test.DeviceProperty";
+const char* const SERVER_DATASTREAM = "org.astarte-platform.test.ServerDatastream";
+
+// The first reconnection is delayed by the backoff of the device
+constexpr std::chrono::seconds TIMEOUT(10);
+
+auto wait_until(const std::function<bool()>& condition) -> bool {
+  const auto deadline = std::chrono::steady_clock::now() + TIMEOUT;
+  while (!condition()) {
+    if (std::chrono::steady_clock::now() >= deadline) {
+      return false;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  return true;
+}
+
+auto server_event(uint64_t sequence) -> FakeMessageHub::Event {
+  FakeMessageHub::Event event;
+  astarteplatform::msghub::AstarteMessage* message = event.mutable_message();
+  message->set_interface_name(SERVER_DATASTREAM);
+  message->set_path("/sequence");
+  message->mutable_datastream_individual()->mutable_data()->set_integer(
+      static_cast<int32_t>(sequence));
+  return event;
+}
+
+class AstarteTestDeviceGRPC : public testing::Test {
+ protected:
+  void SetUp() override {
+    device_ = std::make_unique<AstarteDeviceGRPC>(server_.get_address(), "test-node");
+    device_->connect();
+    ASSERT_TRUE(wait_until([this] { return device_->is_connected(); }));
+  }
+
+  void TearDown() override { device_->disconnect(); }
+
+  auto hub() -> FakeMessageHub& { return server_.hub(); }
+
+  // Declared first, so that it outlives the device
+  FakeMessageHubServer server_;
+  std::unique_ptr<AstarteDeviceGRPC> device_;
+};
+
+}  // namespace
+
+TEST_F(AstarteTestDeviceGRPC, SendIndividual) {
+  hub().set_record_messages(true);
+  device_->send_individual(DEVICE_DATASTREAM, "/temperature", AstarteData(23.5), nullptr);
+
+  const std::vector<astarteplatform::msghub::AstarteMessage> messages = hub().take_messages();
+  ASSERT_EQ(messages.size(), 1);
+  EXPECT_EQ(messages.front().interface_name(), DEVICE_DATASTREAM);
+  EXPECT_EQ(messages.front().path(), "/temperature");
+  EXPECT_DOUBLE_EQ(messages.front().datastream_individual().data().double_(), 23.5);
+  EXPECT_EQ(hub().get_stats().messages_received, 1);
+}
+
+TEST_F(AstarteTestDeviceGRPC, PropertyRoundTrip) {
+  device_->set_property(DEVICE_PROPERTY, "/name", AstarteData(std::string("sensor")));
+  const AstartePropertyIndividual property = device_->get_property(DEVICE_PROPERTY, "/name");
+  ASSERT_TRUE(property.get_value().has_value());
+  EXPECT_EQ(property.get_value()->into<std::string>(), "sensor");
+
+  device_->unset_property(DEVICE_PROPERTY, "/name");
+  EXPECT_FALSE(device_->get_property(DEVICE_PROPERTY, "/name").get_value().has_value());
+}
+
+TEST_F(AstarteTestDeviceGRPC, SetPropertiesRateLimited) {
+  device_->set_interface_rate_limit(
+      DEVICE_PROPERTY, AstarteRateLimit(AstarteRateLimit::OverLimit::kDrop).with_messages(0.01, 2));
+  hub().set_record_messages(true);
+  const std::vector<AstartePropertyUpdate> updates = {
+      AstartePropertyUpdate(DEVICE_PROPERTY, "/first", AstarteData(1)),
+      AstartePropertyUpdate(DEVICE_PROPERTY, "/second", AstarteData(2)),
+      AstartePropertyUpdate(DEVICE_PROPERTY, "/third", AstarteData(3)),
+      AstartePropertyUpdate(DEVICE_PROPERTY, "/fourth", AstarteData(4))};
+
+  const std::vector<AstartePropertyUpdateStatus> statuses = device_->set_properties(updates);
+  ASSERT_EQ(statuses.size(), updates.size());
+  EXPECT_TRUE(statuses.at(0).is_ok());
+  EXPECT_TRUE(statuses.at(1).is_ok());
+  EXPECT_FALSE(statuses.at(2).is_ok());
+  EXPECT_FALSE(statuses.at(3).is_ok());
+  EXPECT_EQ(hub().take_messages().size(), 2);
+  EXPECT_EQ(device_->get_rate_limit_stats().admitted, 2);
+  EXPECT_EQ(device_->get_rate_limit_stats().dropped, 2);
+}
+
+TEST_F(AstarteTestDeviceGRPC, SetPropertiesPacedByRateLimit) {
+  device_->set_interface_rate_limit(
+      DEVICE_PROPERTY, AstarteRateLimit(AstarteRateLimit::OverLimit::kBlock).with_messages(5, 1));
+  const std::vector<AstartePropertyUpdate> updates = {
+      AstartePropertyUpdate(DEVICE_PROPERTY, "/first", AstarteData(1)),
+      AstartePropertyUpdate(DEVICE_PROPERTY, "/second", AstarteData(2)),
+      AstartePropertyUpdate(DEVICE_PROPERTY, "/third", AstarteData(3)),
+      AstartePropertyUpdate(DEVICE_PROPERTY, "/fourth", AstarteData(4))};
+
+  std::future<std::vector<AstartePropertyUpdateStatus>> statuses = std::async(
+      std::launch::async, [this, &updates] { return device_->set_properties(updates); });
+  // One update every 200ms: the first ones are sent while the last ones are still held back
+  std::this_thread::sleep_for(std::chrono::milliseconds(300));
+  const uint64_t sent_early = hub().get_stats().messages_received;
+  EXPECT_GE(sent_early, 1);
+  EXPECT_LE(sent_early, 3);
+
+  ASSERT_EQ(statuses.wait_for(TIMEOUT), std::future_status::ready);
+  for (const AstartePropertyUpdateStatus& status : statuses.get()) {
+    EXPECT_TRUE(status.is_ok());
+  }
+  EXPECT_EQ(hub().get_stats().messages_received, updates.size());
+}
+
+TEST_F(AstarteTestDeviceGRPC, SetPropertiesNeverDeferred) {
+  device_->set_interface_rate_limit(
+      DEVICE_PROPERTY, AstarteRateLimit(AstarteRateLimit::OverLimit::kDefer).with_messages(5, 1));
+  hub().set_record_messages(true);
+  const std::vector<AstartePropertyUpdate> updates = {
+      AstartePropertyUpdate(DEVICE_PROPERTY, "/name", AstarteData(1)),
+      AstartePropertyUpdate(DEVICE_PROPERTY, "/name", AstarteData(2))};
+
+  // The update over the limit is waited for, so both have reached the hub in order
+  const std::vector<AstartePropertyUpdateStatus> statuses = device_->set_properties(updates);
+  ASSERT_EQ(statuses.size(), updates.size());
+  EXPECT_TRUE(statuses.at(0).is_ok());
+  EXPECT_TRUE(statuses.at(1).is_ok());
+  const std::vector<astarteplatform::msghub::AstarteMessage> messages = hub().take_messages();
+  ASSERT_EQ(messages.size(), 2);
+  EXPECT_EQ(messages.back().property_individual().data().integer(), 2);
+}
+
+TEST_F(AstarteTestDeviceGRPC, FilterIgnoresDroppedSamples) {
+  device_->set_datastream_filter(DEVICE_DATASTREAM, "", AstarteDatastreamFilter::change_only());
+  device_->set_interface_rate_limit(
+      DEVICE_DATASTREAM, AstarteRateLimit(AstarteRateLimit::OverLimit::kDrop).with_messages(10, 1));
+  hub().set_record_messages(true);
+
+  device_->send_individual(DEVICE_DATASTREAM, "/state", AstarteData(1), nullptr);
+  // Dropped by the rate limit, it must not be taken as the last sent value
+  device_->send_individual(DEVICE_DATASTREAM, "/state", AstarteData(2), nullptr);
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  device_->send_individual(DEVICE_DATASTREAM, "/state", AstarteData(2), nullptr);
+
+  const std::vector<astarteplatform::msghub::AstarteMessage> messages = hub().take_messages();
+  ASSERT_EQ(messages.size(), 2);
+  EXPECT_EQ(messages.back().datastream_individual().data().integer(), 2);
+  EXPECT_EQ(device_->get_rate_limit_stats().dropped, 1);
+}
+
+TEST_F(AstarteTestDeviceGRPC, FilterOfAggregatedInterface) {
+  device_->set_datastream_filter(DEVICE_DATASTREAM, "", AstarteDatastreamFilter::change_only());
+  device_->set_datastream_aggregation(
+      DEVICE_DATASTREAM,
+      AstarteDatastreamAggregation(DEVICE_AGGREGATE, std::chrono::hours(1)).with_fields({"value"}));
+  hub().set_record_messages(true);
+
+  // Each sample completes its window, the repeated one is filtered on the individual interface
+  device_->send_individual(DEVICE_DATASTREAM, "/sensor/value", AstarteData(1), nullptr);
+  device_->send_individual(DEVICE_DATASTREAM, "/sensor/value", AstarteData(1), nullptr);
+  device_->send_individual(DEVICE_DATASTREAM, "/sensor/value", AstarteData(2), nullptr);
+
+  const std::vector<astarteplatform::msghub::AstarteMessage> messages = hub().take_messages();
+  ASSERT_EQ(messages.size(), 2);
+  EXPECT_EQ(messages.front().interface_name(), DEVICE_AGGREGATE);
+  EXPECT_EQ(messages.back().datastream_object().data().at("value").integer(), 2);
+  EXPECT_EQ(device_->get_datastream_filter_stats().filtered, 1);
+}
+
+TEST_F(AstarteTestDeviceGRPC, ManualDriveAggregationExpiry) {
+  device_->disconnect();
+  device_->set_manual_drive(true);
+  device_->set_datastream_aggregation(
+      DEVICE_DATASTREAM,
+      AstarteDatastreamAggregation(DEVICE_AGGREGATE, std::chrono::milliseconds(50)));
+  device_->connect();
+  ASSERT_TRUE(wait_until([this] {
+    device_->run_once(std::chrono::milliseconds(10));
+    return device_->is_connected();
+  }));
+  hub().set_record_messages(true);
+
+  // The window is expired by run_once, without the timer wheel
+  device_->send_individual(DEVICE_DATASTREAM, "/sensor/value", AstarteData(1), nullptr);
+  std::vector<astarteplatform::msghub::AstarteMessage> messages;
+  ASSERT_TRUE(wait_until([this, &messages] {
+    device_->run_once(std::chrono::milliseconds(10));
+    for (auto& message : hub().take_messages()) {
+      messages.push_back(std::move(message));
+    }
+    return !messages.empty();
+  }));
+  ASSERT_EQ(messages.size(), 1);
+  EXPECT_EQ(messages.front().interface_name(), DEVICE_AGGREGATE);
+  EXPECT_EQ(messages.front().datastream_object().data().at("value").integer(), 1);
+}
+
+TEST_F(AstarteTestDeviceGRPC, ReceiveEvents) {
+  hub().push_event(server_event(42));
+  hub().set_event_rate(1000, server_event);
+
+  std::vector<AstarteMessage> received;
+  ASSERT_TRUE(wait_until([this, &received] {
+    std::optional<AstarteMessage> message = device_->poll_incoming(std::chrono::milliseconds(10));
+    if (message.has_value()) {
+      received.push_back(*message);
+    }
+    return received.size() >= 10;
+  }));
+  hub().set_event_rate(0, nullptr);
+
+  EXPECT_EQ(received.front().get_interface(), SERVER_DATASTREAM);
+  EXPECT_EQ(received.front().into<AstarteDatastreamIndividual>().get_value().into<int32_t>(), 42);
+  for (std::size_t index = 1; index < received.size(); index++) {
+    const auto sequence =
+        received.at(index).into<AstarteDatastreamIndividual>().get_value().into<int32_t>();
+    EXPECT_EQ(sequence, static_cast<int32_t>(index - 1));
+  }
+}
+
+TEST_F(AstarteTestDeviceGRPC, AbandonedNextMessage) {
+  {
+    // Destroyed without being awaited, it must not take the next message
+    const auto abandoned = device_->next_message();
+  }
+  hub().push_event(server_event(7));
+
+  std::optional<AstarteMessage> message;
+  ASSERT_TRUE(wait_until([this, &message] {
+    message = device_->poll_incoming(std::chrono::milliseconds(10));
+    return message.has_value();
+  }));
+  EXPECT_EQ(message->into<AstarteDatastreamIndividual>().get_value().into<int32_t>(), 7);
+}
+
+TEST_F(AstarteTestDeviceGRPC, ReconnectAfterStreamFailure) {
+  hub().fail_streams({grpc::StatusCode::UNAVAILABLE, "The message hub is restarting."});
+  ASSERT_TRUE(wait_until([this] { return hub().get_stats().attaches >= 2; }));
+  ASSERT_TRUE(wait_until([this] { return device_->is_connected(); }));
+
+  hub().set_record_messages(true);
+  device_->send_individual(DEVICE_DATASTREAM, "/temperature", AstarteData(21.0), nullptr);
+  EXPECT_EQ(hub().take_messages().size(), 1);
+}
@@ -0,0 +1,94 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "astarte_device_sdk/executor.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "executor_strand.hpp"
+
+using AstarteDeviceSdk::AstarteWorkStealingExecutor;
+using AstarteDeviceSdk::ExecutorStrand;
+
+TEST(AstarteTestExecutor, WorkStealingRunsAllTasks) {
+  std::atomic<int> counter{0};
+  {
+    AstarteWorkStealingExecutor executor(4);
+    EXPECT_EQ(executor.get_num_threads(), 4);
+    for (int i = 0; i < 1000; i++) {
+      executor.post([&counter] { counter++; });
+    }
+  }
+  EXPECT_EQ(counter.load(), 1000);
+}
+
+TEST(AstarteTestExecutor, WorkStealingNestedPost) {
+  std::atomic<int> counter{0};
+  {
+    AstarteWorkStealingExecutor executor(2);
+    for (int i = 0; i < 100; i++) {
+      executor.post([&executor, &counter] {
+        counter++;
+        executor.post([&counter] { counter++; });
+      });
+    }
+  }
+  EXPECT_EQ(counter.load(), 200);
+}
+
+// Idle workers steal the tasks as soon as they are queued, the pool must still stop once they ran
+TEST(AstarteTestExecutor, WorkStealingConcurrentPosters) {
+  std::atomic<int> counter{0};
+  {
+    AstarteWorkStealingExecutor executor(4);
+    std::vector<std::jthread> posters;
+    for (int p = 0; p < 4; p++) {
+      posters.emplace_back([&executor, &counter] {
+        for (int i = 0; i < 10000; i++) {
+          executor.post([&counter] { counter++; });
+        }
+      });
+    }
+  }
+  EXPECT_EQ(counter.load(), 40000);
+}
+
+TEST(AstarteTestExecutor, StrandPreservesOrdering) {
+  auto executor = std::make_shared<AstarteWorkStealingExecutor>(4);
+  std::vector<ExecutorStrand> strands(8);
+  std::vector<std::vector<int>> results(strands.size());
+  for (ExecutorStrand& strand : strands) {
+    strand.set_executor(executor);
+  }
+
+  for (int i = 0; i < 500; i++) {
+    for (std::size_t s = 0; s < strands.size(); s++) {
+      strands[s].post([&results, s, i] { results[s].push_back(i); });
+    }
+  }
+  for (ExecutorStrand& strand : strands) {
+    strand.wait_idle();
+  }
+
+  for (const std::vector<int>& result : results) {
+    ASSERT_EQ(result.size(), 500);
+    for (int i = 0; i < 500; i++) {
+      EXPECT_EQ(result[i], i);
+    }
+  }
+}
+
+TEST(AstarteTestExecutor, StrandWithoutExecutorRunsInline) {
+  ExecutorStrand strand;
+  int counter = 0;
+  strand.post([&counter] { counter++; });
+  EXPECT_EQ(counter, 1);
+  strand.wait_idle();
+}
@@ -0,0 +1,115 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/individual.hpp"
+#include "astarte_device_sdk/json.hpp"
+#include "astarte_device_sdk/msg.hpp"
+#include "astarte_device_sdk/object.hpp"
+#include "astarte_device_sdk/ownership.hpp"
+#include "astarte_device_sdk/property.hpp"
+#include "astarte_device_sdk/stored_property.hpp"
+
+using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::AstarteDatastreamIndividual;
+using AstarteDeviceSdk::AstarteDatastreamObject;
+using AstarteDeviceSdk::AstarteJsonWriter;
+using AstarteDeviceSdk::AstarteMessage;
+using AstarteDeviceSdk::AstarteOwnership;
+using AstarteDeviceSdk::AstartePropertyIndividual;
+using AstarteDeviceSdk::AstarteStoredProperty;
+using AstarteDeviceSdk::to_json;
+
+namespace {
+
+auto timestamp(int64_t milliseconds) -> std::chrono::system_clock::time_point {
+  return std::chrono::system_clock::time_point(std::chrono::milliseconds(milliseconds));
+}
+
+}  // namespace
+
+TEST(AstarteTestJson, Scalars) {
+  EXPECT_EQ(to_json(AstarteData(-42)), "-42");
+  EXPECT_EQ(to_json(AstarteData(int64_t{9007199254740993})), "9007199254740993");
+  EXPECT_EQ(to_json(AstarteData(23.5)), "23.5");
+  EXPECT_EQ(to_json(AstarteData(0.1)), "0.1");
+  EXPECT_EQ(to_json(AstarteData(48.0)), "48");
+  EXPECT_EQ(to_json(AstarteData(-0.0)), "-0");
+  EXPECT_EQ(to_json(AstarteData(1e300)), "1e+300");
+  EXPECT_EQ(to_json(AstarteData(std::numeric_limits<double>::quiet_NaN())), "null");
+  EXPECT_EQ(to_json(AstarteData(true)), "true");
+}
+
+TEST(AstarteTestJson, EscapesStrings) {
+  EXPECT_EQ(to_json(AstarteData(std::string("plain"))), R"("plain")");
+  EXPECT_EQ(to_json(AstarteData(std::string("a\"b\\c\nd\x01"))), R"("a\"b\\c\nd\u0001")");
+  EXPECT_EQ(to_json(AstarteData(std::string("temp \xC2\xB0"))), "\"temp \xC2\xB0\"");
+}
+
+TEST(AstarteTestJson, Base64) {
+  EXPECT_EQ(to_json(AstarteData(std::vector<uint8_t>{})), R"("")");
+  EXPECT_EQ(to_json(AstarteData(std::vector<uint8_t>{'f'})), R"("Zg==")");
+  EXPECT_EQ(to_json(AstarteData(std::vector<uint8_t>{'f', 'o'})), R"("Zm8=")");
+  EXPECT_EQ(to_json(AstarteData(std::vector<uint8_t>{'f', 'o', 'o'})), R"("Zm9v")");
+  EXPECT_EQ(to_json(AstarteData(std::vector<uint8_t>{'f', 'o', 'o', 'b', 'a', 'r'})),
+            R"("Zm9vYmFy")");
+  EXPECT_EQ(to_json(AstarteData(std::vector<uint8_t>{0xFF, 0xFE})), R"("//4=")");
+}
+
+TEST(AstarteTestJson, Timestamps) {
+  EXPECT_EQ(to_json(AstarteData(timestamp(0))), R"("1970-01-01T00:00:00.000Z")");
+  EXPECT_EQ(to_json(AstarteData(timestamp(1738318830450))), R"("2025-01-31T10:20:30.450Z")");
+  EXPECT_EQ(to_json(AstarteData(timestamp(-1))), R"("1969-12-31T23:59:59.999Z")");
+}
+
+TEST(AstarteTestJson, Arrays) {
+  EXPECT_EQ(to_json(AstarteData(std::vector<int32_t>{1, -2, 3})), "[1,-2,3]");
+  EXPECT_EQ(to_json(AstarteData(std::vector<double>{})), "[]");
+  EXPECT_EQ(to_json(AstarteData(std::vector<bool>{true, false})), "[true,false]");
+  EXPECT_EQ(to_json(AstarteData(std::vector<std::string>{"a", "b"})), R"(["a","b"])");
+  EXPECT_EQ(to_json(AstarteData(std::vector<std::vector<uint8_t>>{{'f'}, {'f', 'o', 'o'}})),
+            R"(["Zg==","Zm9v"])");
+  EXPECT_EQ(to_json(AstarteData(std::vector<std::chrono::system_clock::time_point>{timestamp(0)})),
+            R"(["1970-01-01T00:00:00.000Z"])");
+}
+
+TEST(AstarteTestJson, Messages) {
+  EXPECT_EQ(to_json(AstarteMessage("org.astarte-platform.test.Sensors", "/room/temperature",
+                                   AstarteDatastreamIndividual(AstarteData(23.5)))),
+            R"({"interface":"org.astarte-platform.test.Sensors","path":"/room/temperature",)"
+            R"("value":23.5})");
+  const AstarteDatastreamObject object = {{"label", AstarteData(std::string("a"))}};
+  EXPECT_EQ(to_json(AstarteMessage("org.astarte-platform.test.Sensors", "/room", object)),
+            R"({"interface":"org.astarte-platform.test.Sensors","path":"/room",)"
+            R"("value":{"label":"a"}})");
+  EXPECT_EQ(to_json(AstarteMessage("org.astarte-platform.test.Settings", "/enabled",
+                                   AstartePropertyIndividual(std::nullopt))),
+            R"({"interface":"org.astarte-platform.test.Settings","path":"/enabled","value":null})");
+}
+
+TEST(AstarteTestJson, StoredProperty) {
+  const AstarteStoredProperty property("org.astarte-platform.test.Settings", "/rate", 1,
+                                       AstarteOwnership::kServer, AstarteData(10));
+  EXPECT_EQ(to_json(property),
+            R"({"interface":"org.astarte-platform.test.Settings","version_major":1,)"
+            R"("path":"/rate","ownership":"server","value":10})");
+}
+
+TEST(AstarteTestJson, WriterReusesItsBuffer) {
+  AstarteJsonWriter writer;
+  writer.write(AstarteData(1));
+  EXPECT_EQ(writer.view(), "1");
+  writer.clear();
+  writer.write(AstarteData(false));
+  EXPECT_EQ(writer.view(), "false");
+}
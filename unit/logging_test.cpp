@@ -0,0 +1,95 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <spdlog/spdlog.h>
+
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "astarte_device_sdk/logging.hpp"
+#include "sdk_logger.hpp"
+
+using AstarteDeviceSdk::ASTARTE_LOG_QUEUE_CAPACITY;
+using AstarteDeviceSdk::AstarteLogLevel;
+using AstarteDeviceSdk::get_dropped_log_count;
+using AstarteDeviceSdk::set_log_callback;
+
+namespace {
+
+const std::chrono::seconds TIMEOUT(10);
+
+class AstarteTestLogging : public testing::Test {
+ protected:
+  void SetUp() override { spdlog::set_level(spdlog::level::info); }
+  void TearDown() override { set_log_callback({}); }
+
+  void collect() {
+    set_log_callback([this](AstarteLogLevel level, std::string_view message) {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      lines_.emplace_back(level, message);
+    });
+  }
+
+  auto wait_lines(std::size_t count) -> std::vector<std::pair<AstarteLogLevel, std::string>> {
+    const auto deadline = std::chrono::steady_clock::now() + TIMEOUT;
+    while (std::chrono::steady_clock::now() < deadline) {
+      {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        if (lines_.size() >= count) {
+          return lines_;
+        }
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    const std::lock_guard<std::mutex> lock(mutex_);
+    return lines_;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::vector<std::pair<AstarteLogLevel, std::string>> lines_;
+};
+
+}  // namespace
+
+TEST_F(AstarteTestLogging, CallbackReceivesLines) {
+  collect();
+  ASTARTE_LOG_INFO("Node {} connected", 1);
+  ASTARTE_LOG_DEBUG("Below the level");
+  ASTARTE_LOG_WARN("Dropping {} messages", 3);
+
+  const auto lines = wait_lines(2);
+  ASSERT_EQ(lines.size(), 2);
+  EXPECT_EQ(lines[0].first, AstarteLogLevel::kInfo);
+  EXPECT_EQ(lines[0].second, "Node 1 connected");
+  EXPECT_EQ(lines[1].first, AstarteLogLevel::kWarn);
+  EXPECT_EQ(lines[1].second, "Dropping 3 messages");
+}
+
+TEST_F(AstarteTestLogging, DropsWhenTheQueueIsFull) {
+  // The callback blocks the logging thread, the queue fills up
+  std::promise<void> release;
+  std::shared_future<void> released = release.get_future().share();
+  set_log_callback([released](AstarteLogLevel /*level*/, std::string_view /*message*/) {
+    released.wait();
+  });
+  const uint64_t dropped = get_dropped_log_count();
+  const auto start = std::chrono::steady_clock::now();
+  // The thread holds at most a full queue of lines, the queue itself another one
+  for (std::size_t index = 0; index < 3 * ASTARTE_LOG_QUEUE_CAPACITY; index++) {
+    ASTARTE_LOG_INFO("Line {}", index);
+  }
+  // Logging did not wait for the blocked thread
+  EXPECT_LT(std::chrono::steady_clock::now() - start, TIMEOUT);
+  EXPECT_GE(get_dropped_log_count() - dropped, ASTARTE_LOG_QUEUE_CAPACITY);
+  release.set_value();
+}
@@ -0,0 +1,126 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "metrics_registry.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "astarte_device_sdk/metrics.hpp"
+#include "shared_queue.hpp"
+
+using AstarteDeviceSdk::AstarteHistogramMetric;
+using AstarteDeviceSdk::AstarteMetricsSnapshot;
+using AstarteDeviceSdk::Counter;
+using AstarteDeviceSdk::Gauge;
+using AstarteDeviceSdk::LatencyHistogram;
+using AstarteDeviceSdk::MetricsRegistry;
+using AstarteDeviceSdk::SharedQueue;
+using std::chrono::microseconds;
+using std::chrono::nanoseconds;
+
+TEST(AstarteTestMetrics, PerThreadCounter) {
+  Counter counter;
+  std::vector<std::thread> threads;
+  // More threads than slots, some of them share the atomic cell
+  for (std::size_t thread = 0; thread < AstarteDeviceSdk::METRICS_SLOTS * 2; thread++) {
+    threads.emplace_back([&counter] {
+      for (int count = 0; count < 10000; count++) {
+        counter.add();
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(counter.load(), AstarteDeviceSdk::METRICS_SLOTS * 20000);
+
+  // The slots of the exited threads are reused, keeping their counts
+  std::thread([&counter] { counter.add(5); }).join();
+  EXPECT_EQ(counter.load(), (AstarteDeviceSdk::METRICS_SLOTS * 20000) + 5);
+}
+
+TEST(AstarteTestMetrics, QueueDepthGauge) {
+  Gauge depth;
+  {
+    SharedQueue<int> queue(&depth);
+    queue.push(1);
+    queue.push(2);
+    queue.push(3);
+    EXPECT_EQ(queue.pop(std::chrono::milliseconds(0)), 1);
+    EXPECT_EQ(depth.load(), 2);
+  }
+  // Items dropped with the queue leave the gauge
+  EXPECT_EQ(depth.load(), 0);
+}
+
+TEST(AstarteTestMetrics, HistogramBuckets) {
+  EXPECT_EQ(LatencyHistogram::bucket_of(0), 0);
+  EXPECT_EQ(LatencyHistogram::bucket_of(1023), 0);
+  EXPECT_EQ(LatencyHistogram::bucket_of(1024), 1);
+  EXPECT_EQ(LatencyHistogram::bucket_of(1279), 1);
+  EXPECT_EQ(LatencyHistogram::bucket_of(1280), 2);
+  EXPECT_EQ(LatencyHistogram::bucket_of(uint64_t{1} << 40), LatencyHistogram::BUCKETS - 1);
+  for (std::size_t bucket = 0; bucket + 1 < LatencyHistogram::BUCKETS; bucket++) {
+    // Each bound is the first latency of the following bucket
+    EXPECT_EQ(LatencyHistogram::bucket_of(LatencyHistogram::upper_bound(bucket)), bucket + 1);
+  }
+
+  LatencyHistogram histogram;
+  for (int count = 0; count < 90; count++) {
+    histogram.record(microseconds(100));
+  }
+  for (int count = 0; count < 10; count++) {
+    histogram.record(microseconds(5000));
+  }
+  AstarteHistogramMetric metric;
+  histogram.load(metric);
+  EXPECT_EQ(metric.count, 100);
+  EXPECT_EQ(metric.sum, microseconds(59000));
+  // Percentiles are upper bounds, within 25% of the actual values
+  EXPECT_GE(metric.percentile(0.5), microseconds(100));
+  EXPECT_LE(metric.percentile(0.5), microseconds(125));
+  EXPECT_GE(metric.percentile(0.99), microseconds(5000));
+  EXPECT_LE(metric.percentile(0.99), microseconds(6250));
+}
+
+TEST(AstarteTestMetrics, PrometheusText) {
+  MetricsRegistry registry;
+  registry.add_counter("test_sends_total", "Sends.\nAll of them.").add(3);
+  registry.add_gauge("test_depth", "Depth.").add(-2);
+  LatencyHistogram& latency = registry.add_histogram("test_latency_seconds", "Latency.");
+  latency.record(nanoseconds(500));
+  latency.record(nanoseconds(3000));
+
+  const AstarteMetricsSnapshot snapshot = registry.snapshot();
+  const std::string text = to_prometheus_text(snapshot);
+  EXPECT_THAT(text, testing::HasSubstr("# HELP test_sends_total Sends.\\nAll of them.\n"
+                                       "# TYPE test_sends_total counter\n"
+                                       "test_sends_total 3\n"));
+  EXPECT_THAT(text, testing::HasSubstr("# TYPE test_depth gauge\ntest_depth -2\n"));
+  EXPECT_THAT(text, testing::HasSubstr("# TYPE test_latency_seconds histogram\n"
+                                       "test_latency_seconds_bucket{le=\"1.024e-06\"} 1\n"
+                                       "test_latency_seconds_bucket{le=\"2.048e-06\"} 1\n"
+                                       "test_latency_seconds_bucket{le=\"4.096e-06\"} 2\n"));
+  EXPECT_THAT(text, testing::HasSubstr("test_latency_seconds_bucket{le=\"+Inf\"} 2\n"
+                                       "test_latency_seconds_sum 3.5e-06\n"
+                                       "test_latency_seconds_count 2\n"));
+}
+
+TEST(AstarteTestMetrics, SdkMetricsRegistered) {
+  const AstarteMetricsSnapshot snapshot = AstarteDeviceSdk::get_metrics_snapshot();
+  std::vector<std::string> names;
+  for (const auto& counter : snapshot.counters) {
+    names.push_back(counter.name);
+  }
+  EXPECT_THAT(names, testing::Contains("astarte_sdk_messages_sent_total"));
+  ASSERT_EQ(snapshot.histograms.size(), 1);
+  EXPECT_EQ(snapshot.histograms.front().name, "astarte_sdk_send_latency_seconds");
+}
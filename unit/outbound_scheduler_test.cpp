@@ -0,0 +1,138 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "outbound_scheduler.hpp"
+
+#include <gmock/gmock.h>
+#include <grpcpp/grpcpp.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "astarte_device_sdk/send_priority.hpp"
+#include "timer_wheel.hpp"
+
+using AstarteDeviceSdk::AstarteSendLaneStats;
+using AstarteDeviceSdk::AstarteSendPriority;
+using AstarteDeviceSdk::OutboundScheduler;
+using AstarteDeviceSdk::TimerWheel;
+
+namespace {
+
+// Records the started sends, completing them only when asked to
+struct FakeSends {
+  std::vector<std::string> started;
+  std::vector<OutboundScheduler::OnDone> in_flight;
+
+  auto start(std::string name) -> OutboundScheduler::StartSend {
+    return [this, name = std::move(name)](OutboundScheduler::OnDone on_done) {
+      started.push_back(name);
+      in_flight.push_back(std::move(on_done));
+    };
+  }
+
+  void complete_first() {
+    OutboundScheduler::OnDone on_done = std::move(in_flight.front());
+    in_flight.erase(in_flight.begin());
+    on_done(grpc::Status::OK);
+  }
+};
+
+}  // namespace
+
+TEST(AstarteTestOutboundScheduler, DefaultAndOverriddenPriorities) {
+  auto scheduler = std::make_shared<OutboundScheduler>(1, 1, TimerWheel::shared());
+  EXPECT_EQ(scheduler->get_priority("org.astarte-platform.test.Props", true),
+            AstarteSendPriority::kHigh);
+  EXPECT_EQ(scheduler->get_priority("org.astarte-platform.test.Alarms", false),
+            AstarteSendPriority::kNormal);
+  scheduler->set_interface_priority("org.astarte-platform.test.Alarms", AstarteSendPriority::kHigh);
+  EXPECT_EQ(scheduler->get_priority("org.astarte-platform.test.Alarms", false),
+            AstarteSendPriority::kHigh);
+}
+
+TEST(AstarteTestOutboundScheduler, HighPriorityJumpsTheQueue) {
+  auto scheduler = std::make_shared<OutboundScheduler>(1, 2, TimerWheel::shared());
+  FakeSends sends;
+  std::vector<std::string> completed;
+  auto on_done = [&completed](std::string name) {
+    return [&completed, name = std::move(name)](const grpc::Status& status) {
+      EXPECT_TRUE(status.ok());
+      completed.push_back(name);
+    };
+  };
+
+  for (const std::string name : {"bulk1", "bulk2", "bulk3", "bulk4"}) {
+    scheduler->submit(AstarteSendPriority::kNormal, sends.start(name), on_done(name));
+  }
+  // The normal lane is full, the high priority lane has its own window
+  scheduler->submit(AstarteSendPriority::kHigh, sends.start("prop1"), on_done("prop1"));
+  scheduler->submit(AstarteSendPriority::kHigh, sends.start("prop2"), on_done("prop2"));
+  EXPECT_THAT(sends.started, testing::ElementsAre("bulk1", "bulk2", "prop1"));
+
+  AstarteSendLaneStats normal = scheduler->get_stats(AstarteSendPriority::kNormal);
+  EXPECT_EQ(normal.sent, 2);
+  EXPECT_EQ(normal.queued, 2);
+  EXPECT_EQ(scheduler->get_stats(AstarteSendPriority::kHigh).queued, 1);
+
+  // A free slot in a lane is only used by its own traffic
+  sends.complete_first();
+  EXPECT_THAT(sends.started, testing::ElementsAre("bulk1", "bulk2", "prop1", "bulk3"));
+  sends.complete_first();
+  sends.complete_first();
+  EXPECT_THAT(sends.started,
+              testing::ElementsAre("bulk1", "bulk2", "prop1", "bulk3", "bulk4", "prop2"));
+  while (!sends.in_flight.empty()) {
+    sends.complete_first();
+  }
+  EXPECT_EQ(completed.size(), 6);
+
+  const AstarteSendLaneStats high = scheduler->get_stats(AstarteSendPriority::kHigh);
+  EXPECT_EQ(high.sent, 2);
+  EXPECT_EQ(high.queued, 0);
+  EXPECT_LE(high.mean_wait, high.max_wait);
+  normal = scheduler->get_stats(AstarteSendPriority::kNormal);
+  EXPECT_EQ(normal.sent, 4);
+  EXPECT_EQ(normal.queued, 0);
+}
+
+TEST(AstarteTestOutboundScheduler, CloseCancelsQueuedSends) {
+  auto scheduler = std::make_shared<OutboundScheduler>(1, 1, TimerWheel::shared());
+  FakeSends sends;
+  std::vector<grpc::StatusCode> codes;
+  auto on_done = [&codes](const grpc::Status& status) { codes.push_back(status.error_code()); };
+
+  scheduler->submit(AstarteSendPriority::kNormal, sends.start("bulk1"), on_done);
+  scheduler->submit(AstarteSendPriority::kNormal, sends.start("bulk2"), on_done);
+  scheduler->close();
+  scheduler->submit(AstarteSendPriority::kHigh, sends.start("prop1"), on_done);
+  EXPECT_THAT(codes,
+              testing::ElementsAre(grpc::StatusCode::CANCELLED, grpc::StatusCode::CANCELLED));
+
+  // Sends already started still complete, without starting the cancelled ones
+  sends.complete_first();
+  EXPECT_THAT(sends.started, testing::ElementsAre("bulk1"));
+  EXPECT_EQ(codes.back(), grpc::StatusCode::OK);
+}
+
+TEST(AstarteTestOutboundScheduler, DelayedSubmission) {
+  TimerWheel wheel(std::chrono::milliseconds(1), 16);
+  auto scheduler = std::make_shared<OutboundScheduler>(1, 1, wheel);
+  std::promise<grpc::Status> done;
+  const auto submitted = std::chrono::steady_clock::now();
+  scheduler->submit_after(
+      std::chrono::milliseconds(20), AstarteSendPriority::kNormal,
+      [](OutboundScheduler::OnDone on_done) { on_done(grpc::Status::OK); },
+      [&done](const grpc::Status& status) { done.set_value(status); });
+
+  std::future<grpc::Status> future = done.get_future();
+  ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+  EXPECT_TRUE(future.get().ok());
+  EXPECT_GE(std::chrono::steady_clock::now() - submitted, std::chrono::milliseconds(20));
+  EXPECT_EQ(scheduler->get_stats(AstarteSendPriority::kNormal).sent, 1);
+}
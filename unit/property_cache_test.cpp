@@ -0,0 +1,184 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "property_cache.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <string>
+
+#include "astarte_device_sdk/data.hpp"
+#include "astarte_device_sdk/ownership.hpp"
+#include "astarte_device_sdk/property.hpp"
+#include "astarte_device_sdk/stored_property.hpp"
+
+using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::AstarteOwnership;
+using AstarteDeviceSdk::AstartePropertyIndividual;
+using AstarteDeviceSdk::AstarteStoredProperty;
+using AstarteDeviceSdk::PropertyCache;
+
+namespace {
+
+const std::string DEVICE_PROPERTIES = R"({
+  "interface_name": "org.astarte-platform.test.DeviceProperty",
+  "version_major": 1,
+  "version_minor": 0,
+  "type": "properties",
+  "ownership": "device",
+  "mappings": [{"endpoint": "/%{sensor_id}/enable", "type": "boolean"}]
+})";
+
+const std::string SERVER_PROPERTIES = R"({
+  "interface_name": "org.astarte-platform.test.ServerProperty",
+  "version_major": 2,
+  "version_minor": 0,
+  "type": "properties",
+  "ownership": "server",
+  "mappings": [{"endpoint": "/%{sensor_id}/rate", "type": "integer"}]
+})";
+
+const std::string DEVICE_DATASTREAM = R"({
+  "interface_name": "org.astarte-platform.test.DeviceDatastream",
+  "version_major": 0,
+  "version_minor": 1,
+  "type": "datastream",
+  "ownership": "device",
+  "mappings": [{"endpoint": "/%{sensor_id}/value", "type": "double"}]
+})";
+
+const std::string DEVICE_INTERFACE = "org.astarte-platform.test.DeviceProperty";
+const std::string SERVER_INTERFACE = "org.astarte-platform.test.ServerProperty";
+
+class AstarteTestPropertyCache : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    cache.set_enabled(true);
+    cache.add_interface(DEVICE_PROPERTIES);
+    cache.add_interface(SERVER_PROPERTIES);
+    cache.add_interface(DEVICE_DATASTREAM);
+  }
+
+  PropertyCache cache;
+};
+
+}  // namespace
+
+TEST_F(AstarteTestPropertyCache, MissBeforeSnapshot) {
+  EXPECT_EQ(cache.get_property(DEVICE_INTERFACE, "/1/enable"), std::nullopt);
+  EXPECT_EQ(cache.get_properties(DEVICE_INTERFACE), std::nullopt);
+  EXPECT_EQ(cache.get_all_properties(std::nullopt), std::nullopt);
+
+  cache.update(DEVICE_INTERFACE, "/1/enable", AstarteData(true));
+  EXPECT_EQ(cache.get_property(DEVICE_INTERFACE, "/1/enable"),
+            AstartePropertyIndividual(AstarteData(true)));
+  EXPECT_EQ(cache.get_properties(DEVICE_INTERFACE), std::nullopt);
+}
+
+TEST_F(AstarteTestPropertyCache, HitAfterSnapshot) {
+  const uint64_t generation = cache.begin_snapshot();
+  cache.load_snapshot(generation,
+                      {AstarteStoredProperty(DEVICE_INTERFACE, "/1/enable", 1,
+                                             AstarteOwnership::kDevice, AstarteData(true)),
+                       AstarteStoredProperty(SERVER_INTERFACE, "/1/rate", 2,
+                                             AstarteOwnership::kServer, AstarteData(10))});
+
+  EXPECT_EQ(cache.get_property(DEVICE_INTERFACE, "/1/enable"),
+            AstartePropertyIndividual(AstarteData(true)));
+  // Complete interfaces report missing paths as unset
+  EXPECT_EQ(cache.get_property(DEVICE_INTERFACE, "/2/enable"),
+            AstartePropertyIndividual(std::nullopt));
+  // Datastreams are never cached
+  EXPECT_EQ(cache.get_property("org.astarte-platform.test.DeviceDatastream", "/1/value"),
+            std::nullopt);
+
+  auto server = cache.get_all_properties(AstarteOwnership::kServer);
+  ASSERT_TRUE(server.has_value());
+  ASSERT_EQ(server->size(), 1);
+  EXPECT_EQ(server->front().get_interface_name(), SERVER_INTERFACE);
+  EXPECT_EQ(server->front().get_version_major(), 2);
+  EXPECT_EQ(cache.get_all_properties(std::nullopt)->size(), 2);
+}
+
+TEST_F(AstarteTestPropertyCache, UpdateDuringSnapshot) {
+  const uint64_t generation = cache.begin_snapshot();
+  // Received after the snapshot request, so it is newer than the snapshot content
+  cache.update(SERVER_INTERFACE, "/1/rate", std::nullopt);
+  cache.load_snapshot(generation, {AstarteStoredProperty(SERVER_INTERFACE, "/1/rate", 2,
+                                                        AstarteOwnership::kServer,
+                                                        AstarteData(10))});
+
+  EXPECT_EQ(cache.get_property(SERVER_INTERFACE, "/1/rate"),
+            AstartePropertyIndividual(std::nullopt));
+  EXPECT_EQ(cache.get_properties(SERVER_INTERFACE)->size(), 0);
+}
+
+TEST_F(AstarteTestPropertyCache, InvalidateAndRemove) {
+  const uint64_t generation = cache.begin_snapshot();
+  cache.load_snapshot(generation, {AstarteStoredProperty(DEVICE_INTERFACE, "/1/enable", 1,
+                                                        AstarteOwnership::kDevice,
+                                                        AstarteData(true))});
+  cache.invalidate();
+  EXPECT_EQ(cache.get_property(DEVICE_INTERFACE, "/1/enable"), std::nullopt);
+
+  cache.update(DEVICE_INTERFACE, "/1/enable", AstarteData(false));
+  cache.remove_interface(DEVICE_INTERFACE);
+  EXPECT_EQ(cache.get_property(DEVICE_INTERFACE, "/1/enable"), std::nullopt);
+
+  cache.update(SERVER_INTERFACE, "/1/rate", AstarteData(5));
+  cache.set_enabled(false);
+  EXPECT_EQ(cache.get_property(SERVER_INTERFACE, "/1/rate"), std::nullopt);
+}
+
+TEST_F(AstarteTestPropertyCache, OutdatedSnapshot) {
+  const uint64_t outdated = cache.begin_snapshot();
+  cache.invalidate();
+  // Requested before the invalidation, it might hold values of the previous connection
+  cache.load_snapshot(outdated, {AstarteStoredProperty(DEVICE_INTERFACE, "/1/enable", 1,
+                                                       AstarteOwnership::kDevice,
+                                                       AstarteData(true))});
+  EXPECT_EQ(cache.get_property(DEVICE_INTERFACE, "/1/enable"), std::nullopt);
+
+  // Superseded by a newer request
+  const uint64_t superseded = cache.begin_snapshot();
+  const uint64_t generation = cache.begin_snapshot();
+  cache.load_snapshot(superseded, {AstarteStoredProperty(DEVICE_INTERFACE, "/1/enable", 1,
+                                                         AstarteOwnership::kDevice,
+                                                         AstarteData(true))});
+  EXPECT_EQ(cache.get_property(DEVICE_INTERFACE, "/1/enable"), std::nullopt);
+  cache.load_snapshot(generation, {AstarteStoredProperty(DEVICE_INTERFACE, "/1/enable", 1,
+                                                         AstarteOwnership::kDevice,
+                                                         AstarteData(false))});
+  EXPECT_EQ(cache.get_property(DEVICE_INTERFACE, "/1/enable"),
+            AstartePropertyIndividual(AstarteData(false)));
+}
+
+TEST_F(AstarteTestPropertyCache, ManyPaths) {
+  constexpr int PATHS = 500;
+  std::list<AstarteStoredProperty> properties;
+  for (int index = 0; index < PATHS; index++) {
+    properties.emplace_back(SERVER_INTERFACE, "/" + std::to_string(index) + "/rate", 2,
+                            AstarteOwnership::kServer, AstarteData(index));
+  }
+  const uint64_t generation = cache.begin_snapshot();
+  cache.update(SERVER_INTERFACE, "/0/rate", AstarteData(-1));
+  cache.load_snapshot(generation, properties);
+  for (int index = 1; index < PATHS; index += 2) {
+    cache.update(SERVER_INTERFACE, "/" + std::to_string(index) + "/rate", std::nullopt);
+  }
+
+  EXPECT_EQ(cache.get_property(SERVER_INTERFACE, "/0/rate"),
+            AstartePropertyIndividual(AstarteData(-1)));
+  for (int index = 1; index < PATHS; index++) {
+    const std::string path = "/" + std::to_string(index) + "/rate";
+    EXPECT_EQ(cache.get_property(SERVER_INTERFACE, path),
+              AstartePropertyIndividual((index % 2 == 0) ? std::optional(AstarteData(index))
+                                                         : std::nullopt));
+  }
+  EXPECT_EQ(cache.get_properties(SERVER_INTERFACE)->size(), PATHS / 2);
+}
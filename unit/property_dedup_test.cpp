@@ -0,0 +1,69 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "property_dedup.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "astarte_device_sdk/data.hpp"
+
+using AstarteDeviceSdk::AstarteData;
+using AstarteDeviceSdk::PropertyDedupTable;
+
+namespace {
+
+const std::string INTERFACE = "org.astarte-platform.test.DeviceProperty";
+
+}  // namespace
+
+TEST(AstarteTestPropertyDedup, SuppressSameValue) {
+  PropertyDedupTable table;
+  table.set_enabled(true);
+  EXPECT_FALSE(table.suppress(INTERFACE, "/1/rate", AstarteData(10)));
+
+  table.record(INTERFACE, "/1/rate", AstarteData(10));
+  EXPECT_TRUE(table.suppress(INTERFACE, "/1/rate", AstarteData(10)));
+  EXPECT_FALSE(table.suppress(INTERFACE, "/1/rate", AstarteData(11)));
+  // Same value but different type
+  EXPECT_FALSE(table.suppress(INTERFACE, "/1/rate", AstarteData(int64_t{10})));
+  EXPECT_FALSE(table.suppress(INTERFACE, "/2/rate", AstarteData(10)));
+  EXPECT_EQ(table.get_suppressed_count(), 1);
+}
+
+TEST(AstarteTestPropertyDedup, ForgetAndClear) {
+  PropertyDedupTable table;
+  table.set_enabled(true);
+  const AstarteData data(std::vector<std::string>{"first", "second"});
+  table.record(INTERFACE, "/1/names", data);
+  table.record(INTERFACE, "/2/names", data);
+
+  table.forget(INTERFACE, "/1/names");
+  EXPECT_FALSE(table.suppress(INTERFACE, "/1/names", data));
+  EXPECT_TRUE(table.suppress(INTERFACE, "/2/names", data));
+
+  table.clear();
+  EXPECT_FALSE(table.suppress(INTERFACE, "/2/names", data));
+
+  table.record(INTERFACE, "/2/names", data);
+  table.set_enabled(false);
+  EXPECT_FALSE(table.suppress(INTERFACE, "/2/names", data));
+}
+
+TEST(AstarteTestPropertyDedup, HashEqualData) {
+  const std::chrono::system_clock::time_point instant(std::chrono::seconds(1700000000));
+  EXPECT_EQ(PropertyDedupTable::hash(AstarteData(std::vector<uint8_t>{1, 2, 3})),
+            PropertyDedupTable::hash(AstarteData(std::vector<uint8_t>{1, 2, 3})));
+  EXPECT_EQ(PropertyDedupTable::hash(AstarteData(std::vector<bool>{true, false})),
+            PropertyDedupTable::hash(AstarteData(std::vector<bool>{true, false})));
+  EXPECT_EQ(PropertyDedupTable::hash(AstarteData(instant)),
+            PropertyDedupTable::hash(AstarteData(instant)));
+  EXPECT_NE(PropertyDedupTable::hash(AstarteData(std::vector<int32_t>{1, 2})),
+            PropertyDedupTable::hash(AstarteData(std::vector<int32_t>{2, 1})));
+}
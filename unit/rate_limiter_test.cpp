@@ -0,0 +1,119 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "rate_limiter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "astarte_device_sdk/rate_limit.hpp"
+
+using AstarteDeviceSdk::AstarteRateLimit;
+using AstarteDeviceSdk::AstarteRateLimitStats;
+using AstarteDeviceSdk::GcraBucket;
+using AstarteDeviceSdk::RateLimiter;
+using Action = AstarteDeviceSdk::RateLimiter::Admission::Action;
+using std::chrono::milliseconds;
+using std::chrono::nanoseconds;
+using std::chrono::steady_clock;
+
+namespace {
+
+const char* const INTERFACE = "org.astarte-platform.test.Telemetry";
+const steady_clock::time_point START(std::chrono::hours(1));
+
+}  // namespace
+
+TEST(AstarteTestRateLimiter, BucketBurstAndRate) {
+  GcraBucket bucket(10.0, 3);
+  for (int count = 0; count < 3; count++) {
+    EXPECT_EQ(bucket.try_acquire(1, START), nanoseconds(0));
+  }
+  EXPECT_EQ(bucket.try_acquire(1, START), milliseconds(100));
+  // A unit every 100ms
+  EXPECT_EQ(bucket.try_acquire(1, START + milliseconds(100)), nanoseconds(0));
+  EXPECT_EQ(bucket.try_acquire(1, START + milliseconds(150)), milliseconds(50));
+
+  // Reservations queue behind each other
+  EXPECT_EQ(bucket.reserve(1, START + milliseconds(150)), milliseconds(50));
+  EXPECT_EQ(bucket.reserve(1, START + milliseconds(150)), milliseconds(150));
+  bucket.refund(1);
+  EXPECT_EQ(bucket.reserve(1, START + milliseconds(150)), milliseconds(150));
+
+  // Requests larger than the burst wait for a full bucket
+  GcraBucket bytes(1000.0, 100);
+  EXPECT_EQ(bytes.try_acquire(500, START), nanoseconds(0));
+  EXPECT_EQ(bytes.try_acquire(500, START + milliseconds(100)), milliseconds(400));
+  EXPECT_EQ(bytes.try_acquire(500, START + milliseconds(500)), nanoseconds(0));
+}
+
+TEST(AstarteTestRateLimiter, ConcurrentAcquire) {
+  GcraBucket bucket(1.0, 1000);
+  std::vector<std::thread> threads;
+  std::vector<uint64_t> acquired(4, 0);
+  for (std::size_t index = 0; index < acquired.size(); index++) {
+    threads.emplace_back([&bucket, &acquired, index] {
+      for (int count = 0; count < 1000; count++) {
+        if (bucket.try_acquire(1, START) == nanoseconds(0)) {
+          acquired[index]++;
+        }
+      }
+    });
+  }
+  uint64_t total = 0;
+  for (std::size_t index = 0; index < threads.size(); index++) {
+    threads[index].join();
+    total += acquired[index];
+  }
+  EXPECT_EQ(total, 1000);
+}
+
+TEST(AstarteTestRateLimiter, DeviceAndInterfaceLimits) {
+  RateLimiter limiter;
+  EXPECT_FALSE(limiter.is_enabled());
+  EXPECT_EQ(limiter.admit(INTERFACE, 10, START).action, Action::kSend);
+
+  limiter.set_device_limit(
+      AstarteRateLimit(AstarteRateLimit::OverLimit::kBlock).with_messages(10.0, 2));
+  limiter.set_interface_limit(INTERFACE, AstarteRateLimit(AstarteRateLimit::OverLimit::kDrop)
+                                             .with_bytes(100.0, 100));
+  EXPECT_TRUE(limiter.is_enabled());
+
+  EXPECT_EQ(limiter.admit(INTERFACE, 60, START).action, Action::kSend);
+  // Over the bytes of the interface, without taking a message of the device limit
+  EXPECT_EQ(limiter.admit(INTERFACE, 60, START).action, Action::kDrop);
+  EXPECT_EQ(limiter.admit("org.astarte-platform.test.Other", 1000, START).action, Action::kSend);
+  const RateLimiter::Admission waiting =
+      limiter.admit("org.astarte-platform.test.Other", 1000, START);
+  EXPECT_EQ(waiting.action, Action::kWait);
+  EXPECT_EQ(waiting.delay, milliseconds(100));
+
+  // Manual drive never borrows from the future
+  const RateLimiter::Admission retry = limiter.try_admit(INTERFACE, 10, START);
+  EXPECT_EQ(retry.action, Action::kWait);
+  EXPECT_EQ(retry.delay, milliseconds(200));
+  EXPECT_EQ(limiter.try_admit(INTERFACE, 10, START + milliseconds(200)).action, Action::kSend);
+
+  limiter.set_device_limit(
+      AstarteRateLimit(AstarteRateLimit::OverLimit::kDefer).with_messages(1.0, 1));
+  EXPECT_EQ(limiter.admit("org.astarte-platform.test.Other", 10, START).action, Action::kSend);
+  const RateLimiter::Admission deferred =
+      limiter.admit("org.astarte-platform.test.Other", 10, START);
+  EXPECT_EQ(deferred.action, Action::kDefer);
+  EXPECT_EQ(deferred.delay, std::chrono::seconds(1));
+
+  const AstarteRateLimitStats stats = limiter.get_stats();
+  EXPECT_EQ(stats.admitted, 4);
+  EXPECT_EQ(stats.delayed, 1);
+  EXPECT_EQ(stats.deferred, 1);
+  EXPECT_EQ(stats.dropped, 1);
+
+  limiter.set_device_limit(std::nullopt);
+  limiter.set_interface_limit(INTERFACE, std::nullopt);
+  EXPECT_FALSE(limiter.is_enabled());
+}
@@ -0,0 +1,108 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <astarteplatform/msghub/astarte_data.pb.h>
+#include <astarteplatform/msghub/astarte_message.pb.h>
+#include <astarteplatform/msghub/message_hub_service.grpc.pb.h>
+#include <astarteplatform/msghub/property.pb.h>
+#include <google/protobuf/empty.pb.h>
+#include <grpcpp/grpcpp.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "astarte_device_sdk/rpc_stats.hpp"
+#include "fake_message_hub.hpp"
+#include "grpc_interceptors.hpp"
+
+using AstarteDeviceSdk::AstarteRpcStats;
+using AstarteDeviceSdk::FakeMessageHubServer;
+using AstarteDeviceSdk::RpcStatsInterceptorFactory;
+using AstarteDeviceSdk::RpcStatsTable;
+using astarteplatform::msghub::MessageHub;
+using gRPCAstarteData = astarteplatform::msghub::AstarteData;
+
+namespace {
+
+class AstarteTestRpcStats : public testing::Test {
+ protected:
+  void SetUp() override {
+    std::vector<std::unique_ptr<grpc::experimental::ClientInterceptorFactoryInterface>>
+        interceptors;
+    interceptors.push_back(std::make_unique<RpcStatsInterceptorFactory>(table_));
+    stub_ = MessageHub::NewStub(server_.in_process_channel(std::move(interceptors)));
+  }
+
+  auto send(const std::string& interface_name) -> grpc::Status {
+    grpc::ClientContext context;
+    astarteplatform::msghub::AstarteMessage message;
+    message.set_interface_name(interface_name);
+    message.set_path("/value");
+    google::protobuf::Empty response;
+    return stub_->Send(&context, message, &response);
+  }
+
+  FakeMessageHubServer server_;
+  std::shared_ptr<RpcStatsTable> table_ = std::make_shared<RpcStatsTable>();
+  std::unique_ptr<MessageHub::Stub> stub_;
+};
+
+}  // namespace
+
+TEST_F(AstarteTestRpcStats, DisabledByDefault) {
+  EXPECT_TRUE(send("org.astarte-platform.test.Values").ok());
+  EXPECT_TRUE(table_->snapshot().empty());
+}
+
+TEST_F(AstarteTestRpcStats, PerMethodStats) {
+  table_->set_enabled(true);
+  EXPECT_TRUE(send("org.astarte-platform.test.Values").ok());
+  EXPECT_TRUE(send("org.astarte-platform.test.Values").ok());
+  server_.hub().set_send_status({grpc::StatusCode::INVALID_ARGUMENT, "Invalid message"});
+  EXPECT_EQ(send("org.astarte-platform.test.Values").error_code(),
+            grpc::StatusCode::INVALID_ARGUMENT);
+  server_.hub().set_send_status(grpc::Status::OK);
+
+  gRPCAstarteData name;
+  name.set_string("sensor");
+  server_.hub().set_server_property("org.astarte-platform.test.Properties", "/sensor/name", name);
+
+  grpc::ClientContext context;
+  astarteplatform::msghub::PropertyIdentifier identifier;
+  identifier.set_interface_name("org.astarte-platform.test.Properties");
+  identifier.set_path("/sensor/name");
+  astarteplatform::msghub::AstartePropertyIndividual property;
+  ASSERT_TRUE(stub_->GetProperty(&context, identifier, &property).ok());
+  EXPECT_EQ(property.data().string(), "sensor");
+
+  const std::vector<AstarteRpcStats> stats = table_->snapshot();
+  ASSERT_EQ(stats.size(), 2);
+  const AstarteRpcStats& get_property = stats.at(0);
+  EXPECT_EQ(get_property.method, "/astarteplatform.msghub.MessageHub/GetProperty");
+  EXPECT_EQ(get_property.calls, 1);
+  EXPECT_EQ(get_property.bytes_sent, identifier.ByteSizeLong());
+  EXPECT_EQ(get_property.messages_received, 1);
+  EXPECT_EQ(get_property.bytes_received, property.ByteSizeLong());
+
+  const AstarteRpcStats& send_stats = stats.at(1);
+  EXPECT_EQ(send_stats.method, "/astarteplatform.msghub.MessageHub/Send");
+  EXPECT_EQ(send_stats.calls, 3);
+  EXPECT_EQ(send_stats.messages_sent, 3);
+  EXPECT_GT(send_stats.bytes_sent, 0);
+  EXPECT_EQ(send_stats.messages_received, 2);
+  EXPECT_EQ(send_stats.bytes_received, 0);
+  EXPECT_EQ(send_stats.status_codes.at(grpc::StatusCode::OK), 2);
+  EXPECT_EQ(send_stats.status_codes.at(grpc::StatusCode::INVALID_ARGUMENT), 1);
+  EXPECT_EQ(send_stats.latency.count, 3);
+  EXPECT_GT(send_stats.latency.percentile(0.5).count(), 0);
+
+  // The calls started while disabled are not intercepted
+  table_->set_enabled(false);
+  EXPECT_TRUE(send("org.astarte-platform.test.Values").ok());
+  EXPECT_EQ(table_->snapshot().at(1).calls, 3);
+}
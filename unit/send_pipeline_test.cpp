@@ -0,0 +1,130 @@
+// (C) Copyright 2025, SECO Mind Srl
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "send_pipeline.hpp"
+
+#include <gmock/gmock.h>
+#include <grpcpp/grpcpp.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using AstarteDeviceSdk::SendPipeline;
+
+TEST(AstarteTestSendPipeline, InlineCompletion) {
+  std::vector<std::size_t> started;
+  SendPipeline pipeline(4, [&started](std::size_t index, const SendPipeline::OnDone& on_done) {
+    started.push_back(index);
+    on_done((index == 1) ? grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "rejected")
+                         : grpc::Status::OK);
+  });
+
+  const std::vector<grpc::Status> statuses = pipeline.run({"/a", "/b", "/a"});
+  ASSERT_EQ(statuses.size(), 3);
+  EXPECT_TRUE(statuses[0].ok());
+  EXPECT_EQ(statuses[1].error_message(), "rejected");
+  EXPECT_TRUE(statuses[2].ok());
+  EXPECT_THAT(started, ::testing::ElementsAre(0, 1, 2));
+  EXPECT_TRUE(pipeline.run(std::vector<std::string>{}).empty());
+}
+
+// Each inline completion starts the next send, which must not grow the stack
+TEST(AstarteTestSendPipeline, ManyInlineCompletions) {
+  constexpr std::size_t SENDS = 200000;
+  std::size_t started = 0;
+  SendPipeline pipeline(4, [&started](std::size_t /*index*/, const SendPipeline::OnDone& on_done) {
+    started++;
+    on_done(grpc::Status::OK);
+  });
+
+  EXPECT_EQ(pipeline.run(SENDS).size(), SENDS);
+  EXPECT_EQ(started, SENDS);
+  const std::vector<std::string> keys(SENDS, "/a");
+  const std::vector<grpc::Status> statuses = pipeline.run(keys);
+  EXPECT_EQ(statuses.size(), SENDS);
+  EXPECT_EQ(started, 2 * SENDS);
+}
+
+TEST(AstarteTestSendPipeline, OrderPerKey) {
+  constexpr std::size_t MAX_IN_FLIGHT = 3;
+  std::mutex mutex;
+  std::vector<std::thread> threads;
+  std::map<std::string, std::vector<std::size_t>> completed;
+  std::size_t in_flight = 0;
+  std::size_t max_in_flight = 0;
+  std::vector<std::string> keys;
+  for (std::size_t i = 0; i < 40; i++) {
+    keys.push_back("/path" + std::to_string(i % 4));
+  }
+
+  SendPipeline pipeline(MAX_IN_FLIGHT, [&](std::size_t index, SendPipeline::OnDone on_done) {
+    const std::lock_guard<std::mutex> lock(mutex);
+    in_flight++;
+    max_in_flight = std::max(max_in_flight, in_flight);
+    // Complete on another thread, with later sends completing first
+    threads.emplace_back([&, index, on_done = std::move(on_done)] {
+      std::this_thread::sleep_for(std::chrono::microseconds(200 * (40 - index)));
+      {
+        const std::lock_guard<std::mutex> lock(mutex);
+        in_flight--;
+        completed[keys[index]].push_back(index);
+      }
+      on_done(grpc::Status::OK);
+    });
+  });
+
+  const std::vector<grpc::Status> statuses = pipeline.run(keys);
+  // All the sends have been started and completed
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(statuses.size(), keys.size());
+  EXPECT_LE(max_in_flight, MAX_IN_FLIGHT);
+  for (const auto& [key, indexes] : completed) {
+    EXPECT_TRUE(std::is_sorted(indexes.begin(), indexes.end())) << key;
+    EXPECT_EQ(indexes.size(), 10);
+  }
+}
+
+TEST(AstarteTestSendPipeline, IndependentSends) {
+  std::mutex mutex;
+  std::vector<SendPipeline::OnDone> pending;
+  std::size_t started = 0;
+  SendPipeline pipeline(8, [&](std::size_t /*index*/, SendPipeline::OnDone on_done) {
+    const std::lock_guard<std::mutex> lock(mutex);
+    started++;
+    pending.push_back(std::move(on_done));
+  });
+
+  std::thread completer([&] {
+    std::size_t completed = 0;
+    while (completed < 20) {
+      std::vector<SendPipeline::OnDone> batch;
+      {
+        const std::lock_guard<std::mutex> lock(mutex);
+        // Sends without a key are all started right away, up to the limit
+        EXPECT_LE(pending.size(), 8);
+        batch.swap(pending);
+      }
+      for (SendPipeline::OnDone& on_done : batch) {
+        on_done(grpc::Status::OK);
+        completed++;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  });
+
+  const std::vector<grpc::Status> statuses = pipeline.run(20);
+  completer.join();
+  EXPECT_EQ(statuses.size(), 20);
+  EXPECT_EQ(started, 20);
+}